@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+"""
+Room fixtures for the host kernels: a square room with one rotated square
+pillar, run through the exporter's write_room_obbs (.obb) or
+write_collision_binary (.col).
+
+    python3 room_pillar.py OUT.obb
+    python3 room_pillar.py OUT.col
+
+The "room_obbs_fixture" kernel in kernels_main.c loads the box table through
+collision_mesh_load_room_obbs() and checks it against the same geometry
+(keep the constants in sync with ROOM_FIXTURE_* there). The
+"collision_mesh_col_fixture" kernel loads the mesh through
+collision_mesh_load_binary() and checks its planes and wall grid against the
+same mesh built with collision_mesh_add_poly() and collision_mesh_build_grid().
+"""
+
+import os
+import sys
+
+import numpy as np
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "tools"))
+import export_collision  # noqa: E402
+
+ROOM_HALF = 100.0       # room spans +-ROOM_HALF in X and Z
+ROOM_HEIGHT = 60.0
+PILLAR_CENTER = (30.0, -20.0)
+PILLAR_HALF = 10.0
+PILLAR_YAW = 0.5        # radians, around +Y
+THICKNESS = 20.0        # --obb-thickness
+
+
+def add_quad(verts, faces, types, corners, face_type):
+    """corners counter-clockwise as seen from the visible side (glTF winding)."""
+    base = len(verts)
+    verts.extend(corners)
+    faces.extend([(base, base + 1, base + 2), (base, base + 2, base + 3)])
+    types.extend([face_type, face_type])
+
+
+def square(cx, cz, half, yaw):
+    """Corners of a square in XZ, counter-clockwise seen from +Y."""
+    c, s = np.cos(yaw), np.sin(yaw)
+    local = [(-half, -half), (-half, half), (half, half), (half, -half)]
+    return [(cx + x * c + z * s, cz - x * s + z * c) for x, z in local]
+
+
+def walls(outline, y0, y1, inward, verts, faces, types):
+    """One wall quad per outline edge, visible from inside (room) or outside (pillar)."""
+    for i in range(len(outline)):
+        (ax, az), (bx, bz) = outline[i], outline[(i + 1) % len(outline)]
+        quad = [(ax, y0, az), (bx, y0, bz), (bx, y1, bz), (ax, y1, az)]
+        add_quad(verts, faces, types, quad[::-1] if inward else quad, 1)
+
+
+def build():
+    verts, faces, types = [], [], []
+    h = ROOM_HALF
+    room = [(-h, -h), (-h, h), (h, h), (h, -h)]
+    walls(room, 0.0, ROOM_HEIGHT, True, verts, faces, types)
+    add_quad(verts, faces, types, [(x, 0.0, z) for x, z in room], 0)
+    add_quad(verts, faces, types, [(x, ROOM_HEIGHT, z) for x, z in room[::-1]], 2)
+    walls(square(*PILLAR_CENTER, PILLAR_HALF, PILLAR_YAW), 0.0, ROOM_HEIGHT, False, verts, faces, types)
+
+    # Weld shared corners like the exporter does, so each wall ring is one component
+    v = np.asarray(verts, dtype=np.float64)
+    _, unique_idx, inverse = np.unique(np.round(v / 1e-6).astype(np.int64), axis=0,
+                                       return_index=True, return_inverse=True)
+    return v[unique_idx], inverse.reshape(-1)[np.asarray(faces)], np.asarray(types, dtype=np.int64)
+
+
+def main() -> int:
+    if len(sys.argv) != 2:
+        print(__doc__, file=sys.stderr)
+        return 2
+    vertices, faces, types = build()
+    # The walls must classify the same way the exporter would see them
+    if not np.array_equal(export_collision.classify_faces(vertices, faces), types):
+        print("room_pillar: face winding doesn't match the face types", file=sys.stderr)
+        return 1
+    if sys.argv[1].endswith(".col"):
+        export_collision.write_collision_binary(sys.argv[1], vertices, faces, types)
+        print(f"Wrote {len(vertices)} vertices, {len(faces)} triangles -> {sys.argv[1]}")
+        return 0
+    count = export_collision.write_room_obbs(sys.argv[1], vertices, faces, types, THICKNESS)
+    print(f"Wrote {count} room boxes -> {sys.argv[1]}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
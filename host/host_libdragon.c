@@ -0,0 +1,339 @@
+#include <libdragon.h>
+
+#include <stdarg.h>
+#include <time.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+// ---------------------------------------------------------------------------
+// Time: game time runs on a virtual clock the driver advances explicitly, so
+// a simulated second costs only as much wall time as the code inside it.
+// C0_COUNT stays on the real clock so the dev CPU timers still profile.
+// ---------------------------------------------------------------------------
+
+static uint64_t hostTimeUs = 0;
+
+void host_time_advance_us(uint64_t us)
+{
+    hostTimeUs += us;
+}
+
+uint64_t get_ticks_us(void) { return hostTimeUs; }
+uint64_t get_ticks_ms(void) { return hostTimeUs / 1000; }
+uint64_t get_ticks(void) { return TICKS_FROM_US(hostTimeUs); }
+
+void wait_ms(unsigned long ms)
+{
+    hostTimeUs += (uint64_t)ms * 1000;
+}
+
+uint32_t host_cpu_count(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t ns = (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+    return (uint32_t)(ns * 3 / 64); // 46.875 MHz, same rate as the VR4300 count register
+}
+
+// ---------------------------------------------------------------------------
+// Debug log
+// ---------------------------------------------------------------------------
+
+bool hostDebugfEnabled = true;
+
+void host_debugf(const char *fmt, ...)
+{
+    if (!hostDebugfEnabled) return;
+    va_list args;
+    va_start(args, fmt);
+    vfprintf(stdout, fmt, args);
+    va_end(args);
+}
+
+// ---------------------------------------------------------------------------
+// DFS: plain files under a host directory (the kernels' fixtures)
+// ---------------------------------------------------------------------------
+
+#define HOST_DFS_MAX_OPEN 4
+
+static const char *hostDfsRoot = NULL;
+static FILE *hostDfsFiles[HOST_DFS_MAX_OPEN];
+
+void host_dfs_set_root(const char *dir)
+{
+    hostDfsRoot = dir;
+}
+
+static FILE *host_dfs_file(uint32_t handle)
+{
+    return handle < HOST_DFS_MAX_OPEN ? hostDfsFiles[handle] : NULL;
+}
+
+int dfs_open(const char *path)
+{
+    if (!hostDfsRoot || !path) return -1;
+    int handle = 0;
+    while (handle < HOST_DFS_MAX_OPEN && hostDfsFiles[handle]) handle++;
+    if (handle == HOST_DFS_MAX_OPEN) return -1;
+
+    char full[512];
+    if (snprintf(full, sizeof(full), "%s/%s", hostDfsRoot, path) >= (int)sizeof(full)) return -1;
+    hostDfsFiles[handle] = fopen(full, "rb");
+    return hostDfsFiles[handle] ? handle : -1;
+}
+
+int dfs_read(void *buf, int size, int count, uint32_t handle)
+{
+    // Like libdragon: the byte count read, not the item count
+    FILE *f = host_dfs_file(handle);
+    return f ? (int)fread(buf, 1, (size_t)size * (size_t)count, f) : -1;
+}
+
+int dfs_size(uint32_t handle)
+{
+    FILE *f = host_dfs_file(handle);
+    if (!f) return -1;
+    long pos = ftell(f);
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, pos, SEEK_SET);
+    return (int)size;
+}
+
+int dfs_close(uint32_t handle)
+{
+    FILE *f = host_dfs_file(handle);
+    if (!f) return -1;
+    fclose(f);
+    hostDfsFiles[handle] = NULL;
+    return 0;
+}
+
+void sys_get_heap_stats(heap_stats_t *stats)
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    struct mallinfo2 mi = mallinfo2();
+    stats->total = (int)(mi.arena + mi.hblkhd);
+    stats->used = (int)(mi.uordblks + mi.hblkhd);
+#else
+    stats->total = 0;
+    stats->used = 0;
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// Display and surfaces (sized like the real thing, never shown)
+// ---------------------------------------------------------------------------
+
+static surface_t hostDisplay = { .width = 320, .height = 240, .stride = 640 };
+static surface_t hostZbuf = { .width = 320, .height = 240, .stride = 640 };
+
+// Set by the driver from its frame pacing
+float hostDisplayFps = 30.0f;
+volatile uint32_t hostDpcRegs[5];
+
+void display_init(resolution_t res, bitdepth_t bit, uint32_t num_buffers, gamma_t gamma, filter_options_t filters)
+{
+    (void)num_buffers; (void)gamma; (void)filters;
+    hostDisplay.width = (uint16_t)res.width;
+    hostDisplay.height = (uint16_t)res.height;
+    hostDisplay.stride = (uint16_t)(res.width * bit);
+    hostZbuf.width = hostDisplay.width;
+    hostZbuf.height = hostDisplay.height;
+}
+
+void display_close(void) {}
+surface_t *display_get(void) { return &hostDisplay; }
+surface_t *display_get_zbuf(void) { return &hostZbuf; }
+uint32_t display_get_width(void) { return hostDisplay.width; }
+uint32_t display_get_height(void) { return hostDisplay.height; }
+uint32_t display_get_bitdepth(void) { return hostDisplay.stride / hostDisplay.width; }
+float display_get_fps(void) { return hostDisplayFps; }
+
+surface_t surface_alloc(tex_format_t format, uint16_t width, uint16_t height)
+{
+    int bpp = (format == FMT_RGBA32) ? 4 : 2;
+    return (surface_t){
+        .width = width,
+        .height = height,
+        .stride = (uint16_t)(width * bpp),
+        .buffer = calloc((size_t)width * height, (size_t)bpp),
+    };
+}
+
+void surface_free(surface_t *surface)
+{
+    if (!surface) return;
+    free(surface->buffer);
+    surface->buffer = NULL;
+}
+
+// Sprites load as a small blank texture so width/height/data reads are safe
+#define HOST_SPRITE_SIZE 16
+
+sprite_t *sprite_load(const char *fn)
+{
+    (void)fn;
+    sprite_t *spr = calloc(1, sizeof(sprite_t) + HOST_SPRITE_SIZE * HOST_SPRITE_SIZE * 2);
+    spr->width = HOST_SPRITE_SIZE;
+    spr->height = HOST_SPRITE_SIZE;
+    spr->hslices = 1;
+    spr->vslices = 1;
+    return spr;
+}
+
+void sprite_free(sprite_t *sprite)
+{
+    free(sprite);
+}
+
+// ---------------------------------------------------------------------------
+// RSPQ / RDPQ objects that have to exist
+// ---------------------------------------------------------------------------
+
+const rdpq_trifmt_t TRIFMT_FILL, TRIFMT_SHADE, TRIFMT_TEX, TRIFMT_SHADE_TEX, TRIFMT_ZBUF, TRIFMT_ZBUF_SHADE, TRIFMT_ZBUF_TEX, TRIFMT_ZBUF_SHADE_TEX;
+const video_codec_t h264_codec, mpeg1_codec;
+
+void rspq_block_begin(void) {}
+
+rspq_block_t *rspq_block_end(void)
+{
+    return calloc(1, sizeof(rspq_block_t));
+}
+
+void rspq_block_free(rspq_block_t *block)
+{
+    free(block);
+}
+
+static rdpq_font_t hostFont;
+
+rdpq_font_t *rdpq_font_load(const char *fn) { (void)fn; return &hostFont; }
+rdpq_font_t *rdpq_font_load_builtin(int font) { (void)font; return &hostFont; }
+
+wav64_t *wav64_load(const char *fn, void *parms)
+{
+    (void)fn; (void)parms;
+    return calloc(1, sizeof(wav64_t));
+}
+
+// ---------------------------------------------------------------------------
+// EEPROM filesystem kept in memory
+// ---------------------------------------------------------------------------
+
+#define HOST_EEPFS_MAX_FILES 16
+
+static struct {
+    const char *path;
+    size_t size;
+    uint8_t *data;
+} eepfsFiles[HOST_EEPFS_MAX_FILES];
+static size_t eepfsFileCount = 0;
+
+eeprom_type_t eeprom_present(void) { return EEPROM_4K; }
+
+int eepfs_init(const eepfs_entry_t *entries, size_t count)
+{
+    eepfs_close();
+    if (count > HOST_EEPFS_MAX_FILES) return EEPFS_ENOMEM;
+    for (size_t i = 0; i < count; i++) {
+        eepfsFiles[i].path = entries[i].path;
+        eepfsFiles[i].size = entries[i].size;
+        eepfsFiles[i].data = calloc(1, entries[i].size);
+    }
+    eepfsFileCount = count;
+    return EEPFS_ESUCCESS;
+}
+
+int eepfs_close(void)
+{
+    for (size_t i = 0; i < eepfsFileCount; i++) {
+        free(eepfsFiles[i].data);
+        eepfsFiles[i].data = NULL;
+    }
+    eepfsFileCount = 0;
+    return EEPFS_ESUCCESS;
+}
+
+static int eepfs_find(const char *path)
+{
+    // libdragon accepts paths with or without the leading slash
+    while (*path == '/') path++;
+    for (size_t i = 0; i < eepfsFileCount; i++) {
+        const char *p = eepfsFiles[i].path;
+        while (*p == '/') p++;
+        if (strcmp(p, path) == 0) return (int)i;
+    }
+    return -1;
+}
+
+int eepfs_read(const char *path, void *dest, size_t size)
+{
+    int i = eepfs_find(path);
+    if (i < 0) return EEPFS_ENOFILE;
+    if (size != eepfsFiles[i].size) return EEPFS_EBADINPUT;
+    memcpy(dest, eepfsFiles[i].data, size);
+    return EEPFS_ESUCCESS;
+}
+
+int eepfs_write(const char *path, const void *src, size_t size)
+{
+    int i = eepfs_find(path);
+    if (i < 0) return EEPFS_ENOFILE;
+    if (size != eepfsFiles[i].size) return EEPFS_EBADINPUT;
+    memcpy(eepfsFiles[i].data, src, size);
+    return EEPFS_ESUCCESS;
+}
+
+bool eepfs_verify_signature(void) { return true; }
+
+void eepfs_wipe(void)
+{
+    for (size_t i = 0; i < eepfsFileCount; i++) {
+        memset(eepfsFiles[i].data, 0, eepfsFiles[i].size);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Joypad: port 1 reads the state the driver last pushed
+// ---------------------------------------------------------------------------
+
+static joypad_inputs_t hostPadNext;
+static joypad_inputs_t hostPad;
+static uint16_t hostPadPrevRaw = 0;
+
+void host_joypad_set(joypad_inputs_t inputs)
+{
+    hostPadNext = inputs;
+}
+
+void joypad_init(void)
+{
+    memset(&hostPadNext, 0, sizeof(hostPadNext));
+    memset(&hostPad, 0, sizeof(hostPad));
+    hostPadPrevRaw = 0;
+}
+
+void joypad_poll(void)
+{
+    hostPadPrevRaw = hostPad.btn.raw;
+    hostPad = hostPadNext;
+}
+
+joypad_inputs_t joypad_get_inputs(joypad_port_t port)
+{
+    return (port == JOYPAD_PORT_1) ? hostPad : (joypad_inputs_t){0};
+}
+
+joypad_buttons_t joypad_get_buttons_pressed(joypad_port_t port)
+{
+    if (port != JOYPAD_PORT_1) return (joypad_buttons_t){0};
+    return (joypad_buttons_t){ .raw = (uint16_t)(hostPad.btn.raw & ~hostPadPrevRaw) };
+}
+
+joypad_buttons_t joypad_get_buttons_released(joypad_port_t port)
+{
+    if (port != JOYPAD_PORT_1) return (joypad_buttons_t){0};
+    return (joypad_buttons_t){ .raw = (uint16_t)(~hostPad.btn.raw & hostPadPrevRaw) };
+}
@@ -0,0 +1,447 @@
+#include <t3d/t3d.h>
+#include <t3d/t3dmath.h>
+#include <t3d/t3dmodel.h>
+#include <t3d/t3dskeleton.h>
+#include <t3d/t3danim.h>
+
+// ---------------------------------------------------------------------------
+// Math (column-major like Tiny3D: m[3] holds the translation)
+// ---------------------------------------------------------------------------
+
+void t3d_mat4_identity(T3DMat4 *mat)
+{
+    *mat = (T3DMat4){{
+        {1.0f, 0.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f, 0.0f},
+        {0.0f, 0.0f, 1.0f, 0.0f},
+        {0.0f, 0.0f, 0.0f, 1.0f},
+    }};
+}
+
+void t3d_mat4_to_fixed(T3DMat4FP *matOut, const T3DMat4 *matIn)
+{
+    for (int c = 0; c < 4; c++) {
+        for (int r = 0; r < 4; r++) {
+            int32_t fixed = (int32_t)(matIn->m[c][r] * 65536.0f);
+            matOut->m[c].i[r] = (int16_t)(fixed >> 16);
+            matOut->m[c].f[r] = (uint16_t)(fixed & 0xFFFF);
+        }
+    }
+}
+
+void t3d_mat4fp_identity(T3DMat4FP *mat)
+{
+    T3DMat4 m;
+    t3d_mat4_identity(&m);
+    t3d_mat4_to_fixed(mat, &m);
+}
+
+void t3d_mat4fp_set_pos(T3DMat4FP *mat, const float pos[3])
+{
+    for (int r = 0; r < 3; r++) {
+        int32_t fixed = (int32_t)(pos[r] * 65536.0f);
+        mat->m[3].i[r] = (int16_t)(fixed >> 16);
+        mat->m[3].f[r] = (uint16_t)(fixed & 0xFFFF);
+    }
+}
+
+void t3d_mat4_scale(T3DMat4 *mat, float scaleX, float scaleY, float scaleZ)
+{
+    for (int r = 0; r < 4; r++) {
+        mat->m[0][r] *= scaleX;
+        mat->m[1][r] *= scaleY;
+        mat->m[2][r] *= scaleZ;
+    }
+}
+
+void t3d_mat4_mul(T3DMat4 *matRes, const T3DMat4 *matL, const T3DMat4 *matR)
+{
+    T3DMat4 res;
+    for (int c = 0; c < 4; c++) {
+        for (int r = 0; r < 4; r++) {
+            res.m[c][r] = matL->m[0][r] * matR->m[c][0] + matL->m[1][r] * matR->m[c][1]
+                        + matL->m[2][r] * matR->m[c][2] + matL->m[3][r] * matR->m[c][3];
+        }
+    }
+    *matRes = res;
+}
+
+void t3d_mat4_rotate(T3DMat4 *mat, const T3DVec3 *axis, float angleRad)
+{
+    T3DVec3 a = *axis;
+    t3d_vec3_norm(&a);
+    float s = sinf(angleRad), c = cosf(angleRad), t = 1.0f - c;
+    float x = a.v[0], y = a.v[1], z = a.v[2];
+
+    T3DMat4 rot = {{
+        {t * x * x + c,     t * x * y + s * z, t * x * z - s * y, 0.0f},
+        {t * x * y - s * z, t * y * y + c,     t * y * z + s * x, 0.0f},
+        {t * x * z + s * y, t * y * z - s * x, t * z * z + c,     0.0f},
+        {0.0f, 0.0f, 0.0f, 1.0f},
+    }};
+    t3d_mat4_mul(mat, mat, &rot);
+}
+
+static inline void vec3_cross(T3DVec3 *res, const T3DVec3 *a, const T3DVec3 *b)
+{
+    T3DVec3 r = {{
+        a->v[1] * b->v[2] - a->v[2] * b->v[1],
+        a->v[2] * b->v[0] - a->v[0] * b->v[2],
+        a->v[0] * b->v[1] - a->v[1] * b->v[0],
+    }};
+    *res = r;
+}
+
+static inline float vec3_dot(const T3DVec3 *a, const T3DVec3 *b)
+{
+    return a->v[0] * b->v[0] + a->v[1] * b->v[1] + a->v[2] * b->v[2];
+}
+
+void t3d_mat4_rot_from_dir(T3DMat4 *mat, const T3DVec3 *dir, const T3DVec3 *up)
+{
+    T3DVec3 z = *dir, x, y;
+    t3d_vec3_norm(&z);
+    vec3_cross(&x, up, &z);
+    t3d_vec3_norm(&x);
+    vec3_cross(&y, &z, &x);
+
+    *mat = (T3DMat4){{
+        {x.v[0], x.v[1], x.v[2], 0.0f},
+        {y.v[0], y.v[1], y.v[2], 0.0f},
+        {z.v[0], z.v[1], z.v[2], 0.0f},
+        {0.0f, 0.0f, 0.0f, 1.0f},
+    }};
+}
+
+void t3d_mat4_from_srt_euler(T3DMat4 *mat, const float scale[3], const float rot[3], const float translate[3])
+{
+    float cosR0 = cosf(rot[0]), sinR0 = sinf(rot[0]);
+    float cosR1 = cosf(rot[1]), sinR1 = sinf(rot[1]);
+    float cosR2 = cosf(rot[2]), sinR2 = sinf(rot[2]);
+
+    *mat = (T3DMat4){{
+        {scale[0] * cosR2 * cosR1, scale[0] * (cosR2 * sinR1 * sinR0 - sinR2 * cosR0), scale[0] * (cosR2 * sinR1 * cosR0 + sinR2 * sinR0), 0.0f},
+        {scale[1] * sinR2 * cosR1, scale[1] * (sinR2 * sinR1 * sinR0 + cosR2 * cosR0), scale[1] * (sinR2 * sinR1 * cosR0 - cosR2 * sinR0), 0.0f},
+        {-scale[2] * sinR1, scale[2] * cosR1 * sinR0, scale[2] * cosR1 * cosR0, 0.0f},
+        {translate[0], translate[1], translate[2], 1.0f},
+    }};
+}
+
+void t3d_mat4_from_srt(T3DMat4 *mat, const float scale[3], const float quat[4], const float translate[3])
+{
+    float x = quat[0], y = quat[1], z = quat[2], w = quat[3];
+    float xx = x * x, yy = y * y, zz = z * z;
+    float xy = x * y, xz = x * z, yz = y * z;
+    float wx = w * x, wy = w * y, wz = w * z;
+
+    *mat = (T3DMat4){{
+        {(1.0f - 2.0f * (yy + zz)) * scale[0], 2.0f * (xy + wz) * scale[0], 2.0f * (xz - wy) * scale[0], 0.0f},
+        {2.0f * (xy - wz) * scale[1], (1.0f - 2.0f * (xx + zz)) * scale[1], 2.0f * (yz + wx) * scale[1], 0.0f},
+        {2.0f * (xz + wy) * scale[2], 2.0f * (yz - wx) * scale[2], (1.0f - 2.0f * (xx + yy)) * scale[2], 0.0f},
+        {translate[0], translate[1], translate[2], 1.0f},
+    }};
+}
+
+void t3d_mat4fp_from_srt_euler(T3DMat4FP *mat, const float scale[3], const float rot[3], const float translate[3])
+{
+    T3DMat4 m;
+    t3d_mat4_from_srt_euler(&m, scale, rot, translate);
+    t3d_mat4_to_fixed(mat, &m);
+}
+
+void t3d_mat3_mul_vec3(T3DVec3 *vecOut, const T3DMat4 *mat, const T3DVec3 *vecIn)
+{
+    T3DVec3 in = *vecIn;
+    for (int r = 0; r < 3; r++) {
+        vecOut->v[r] = mat->m[0][r] * in.v[0] + mat->m[1][r] * in.v[1] + mat->m[2][r] * in.v[2];
+    }
+}
+
+void t3d_mat4_mul_vec3(T3DVec4 *vecOut, const T3DMat4 *mat, const T3DVec3 *vecIn)
+{
+    for (int r = 0; r < 4; r++) {
+        vecOut->v[r] = mat->m[0][r] * vecIn->v[0] + mat->m[1][r] * vecIn->v[1] + mat->m[2][r] * vecIn->v[2] + mat->m[3][r];
+    }
+}
+
+void t3d_quat_nlerp(T3DQuat *res, const T3DQuat *a, const T3DQuat *b, float t)
+{
+    float dot = a->v[0] * b->v[0] + a->v[1] * b->v[1] + a->v[2] * b->v[2] + a->v[3] * b->v[3];
+    float sign = (dot < 0.0f) ? -1.0f : 1.0f;
+    float len = 0.0f;
+    T3DQuat q;
+    for (int i = 0; i < 4; i++) {
+        q.v[i] = a->v[i] + (b->v[i] * sign - a->v[i]) * t;
+        len += q.v[i] * q.v[i];
+    }
+    len = sqrtf(len);
+    if (len < 0.00001f) len = 0.00001f;
+    for (int i = 0; i < 4; i++) res->v[i] = q.v[i] / len;
+}
+
+// ---------------------------------------------------------------------------
+// Viewport
+// ---------------------------------------------------------------------------
+
+static void viewport_update_camproj(T3DViewport *viewport)
+{
+    t3d_mat4_mul(&viewport->matCamProj, &viewport->matProj, &viewport->matCamera);
+}
+
+T3DViewport t3d_viewport_create(void)
+{
+    T3DViewport vp = {0};
+    vp.size[0] = (int)display_get_width();
+    vp.size[1] = (int)display_get_height();
+    vp.guardBandScale = 2.0f;
+    t3d_mat4_identity(&vp.matProj);
+    t3d_mat4_identity(&vp.matCamera);
+    t3d_mat4_identity(&vp.matCamProj);
+    return vp;
+}
+
+void t3d_viewport_set_perspective(T3DViewport *viewport, float fov, float aspectRatio, float near, float far)
+{
+    float f = 1.0f / tanf(fov * 0.5f);
+    viewport->matProj = (T3DMat4){{
+        {f / aspectRatio, 0.0f, 0.0f, 0.0f},
+        {0.0f, f, 0.0f, 0.0f},
+        {0.0f, 0.0f, (far + near) / (near - far), -1.0f},
+        {0.0f, 0.0f, (2.0f * far * near) / (near - far), 0.0f},
+    }};
+    viewport_update_camproj(viewport);
+}
+
+void t3d_viewport_set_projection(T3DViewport *viewport, float fov, float near, float far)
+{
+    float aspect = (float)viewport->size[0] / (float)viewport->size[1];
+    t3d_viewport_set_perspective(viewport, fov, aspect, near, far);
+}
+
+void t3d_viewport_look_at(T3DViewport *viewport, const T3DVec3 *eye, const T3DVec3 *target, const T3DVec3 *up)
+{
+    T3DVec3 f = {{ target->v[0] - eye->v[0], target->v[1] - eye->v[1], target->v[2] - eye->v[2] }};
+    T3DVec3 s, u;
+    t3d_vec3_norm(&f);
+    vec3_cross(&s, &f, up);
+    t3d_vec3_norm(&s);
+    vec3_cross(&u, &s, &f);
+
+    viewport->matCamera = (T3DMat4){{
+        {s.v[0], u.v[0], -f.v[0], 0.0f},
+        {s.v[1], u.v[1], -f.v[1], 0.0f},
+        {s.v[2], u.v[2], -f.v[2], 0.0f},
+        {-vec3_dot(&s, eye), -vec3_dot(&u, eye), vec3_dot(&f, eye), 1.0f},
+    }};
+    viewport_update_camproj(viewport);
+}
+
+void t3d_viewport_calc_viewspace_pos(T3DViewport *viewport, T3DVec3 *out, const T3DVec3 *pos)
+{
+    T3DVec4 clip;
+    t3d_mat4_mul_vec3(&clip, &viewport->matCamProj, pos);
+    float invW = (fabsf(clip.v[3]) > 0.00001f) ? 1.0f / clip.v[3] : 0.0f;
+
+    out->v[0] = (float)viewport->size[0] * 0.5f * (1.0f + clip.v[0] * invW) + (float)viewport->offset[0];
+    out->v[1] = (float)viewport->size[1] * 0.5f * (1.0f - clip.v[1] * invW) + (float)viewport->offset[1];
+    out->v[2] = clip.v[2] * invW;
+}
+
+// ---------------------------------------------------------------------------
+// Models
+// ---------------------------------------------------------------------------
+
+T3DModel *t3d_model_load(const char *path)
+{
+    T3DModel *model = calloc(1, sizeof(T3DModel));
+    model->path = path;
+    model->skeleton.boneCount = HOST_SKELETON_BONES;
+    return model;
+}
+
+void t3d_model_free(T3DModel *model)
+{
+    free(model);
+}
+
+// ---------------------------------------------------------------------------
+// Skeletons: flat hierarchy of HOST_SKELETON_BONES bones
+// ---------------------------------------------------------------------------
+
+static const T3DChunkSkeleton hostSkeletonChunk = { .boneCount = HOST_SKELETON_BONES };
+
+static const char *boneNames[HOST_SKELETON_BONES];
+static int boneNameCount = 0;
+
+static void bone_set_rest(T3DBone *bone)
+{
+    bone->position = (T3DVec3){{0.0f, 0.0f, 0.0f}};
+    bone->scale = (T3DVec3){{1.0f, 1.0f, 1.0f}};
+    bone->rotation = (T3DQuat){{0.0f, 0.0f, 0.0f, 1.0f}};
+    t3d_mat4_identity(&bone->matrix);
+    bone->hasChanged = true;
+}
+
+static T3DMat4FP *skeleton_alloc_matrices(int count)
+{
+    T3DMat4FP *mats = aligned_alloc(16, sizeof(T3DMat4FP) * (size_t)count);
+    for (int i = 0; i < count; i++) t3d_mat4fp_identity(&mats[i]);
+    return mats;
+}
+
+T3DSkeleton t3d_skeleton_create_buffered(const T3DModel *model, int bufferCount)
+{
+    (void)model;
+    T3DSkeleton skel = {0};
+    skel.skeletonRef = &hostSkeletonChunk;
+    skel.bufferCount = bufferCount;
+    skel.bones = calloc(HOST_SKELETON_BONES, sizeof(T3DBone));
+    skel.boneMatricesFP = skeleton_alloc_matrices(HOST_SKELETON_BONES * bufferCount);
+    t3d_skeleton_reset(&skel);
+    return skel;
+}
+
+T3DSkeleton t3d_skeleton_create(const T3DModel *model)
+{
+    return t3d_skeleton_create_buffered(model, 1);
+}
+
+T3DSkeleton t3d_skeleton_clone(const T3DSkeleton *skel, bool useMatrices)
+{
+    T3DSkeleton clone = *skel;
+    clone.bones = malloc(sizeof(T3DBone) * HOST_SKELETON_BONES);
+    memcpy(clone.bones, skel->bones, sizeof(T3DBone) * HOST_SKELETON_BONES);
+    clone.boneMatricesFP = useMatrices ? skeleton_alloc_matrices(HOST_SKELETON_BONES * skel->bufferCount) : NULL;
+    clone.currentBufferIdx = 0;
+    return clone;
+}
+
+void t3d_skeleton_reset(T3DSkeleton *skeleton)
+{
+    for (int i = 0; i < HOST_SKELETON_BONES; i++) bone_set_rest(&skeleton->bones[i]);
+}
+
+void t3d_skeleton_update(T3DSkeleton *skeleton)
+{
+    for (int i = 0; i < HOST_SKELETON_BONES; i++) {
+        T3DBone *bone = &skeleton->bones[i];
+        if (!bone->hasChanged) continue;
+        t3d_mat4_from_srt(&bone->matrix, bone->scale.v, bone->rotation.v, bone->position.v);
+        if (skeleton->boneMatricesFP) t3d_mat4_to_fixed(&skeleton->boneMatricesFP[i], &bone->matrix);
+        bone->hasChanged = false;
+    }
+}
+
+void t3d_skeleton_blend(const T3DSkeleton *skelRes, const T3DSkeleton *skelA, const T3DSkeleton *skelB, float factor)
+{
+    for (int i = 0; i < HOST_SKELETON_BONES; i++) {
+        T3DBone *res = &skelRes->bones[i];
+        const T3DBone *a = &skelA->bones[i];
+        const T3DBone *b = &skelB->bones[i];
+        t3d_vec3_lerp(&res->position, &a->position, &b->position, factor);
+        t3d_vec3_lerp(&res->scale, &a->scale, &b->scale, factor);
+        t3d_quat_nlerp(&res->rotation, &a->rotation, &b->rotation, factor);
+        res->hasChanged = true;
+    }
+}
+
+int t3d_skeleton_find_bone(T3DSkeleton *skeleton, const char *name)
+{
+    (void)skeleton;
+    for (int i = 0; i < boneNameCount; i++) {
+        if (strcmp(boneNames[i], name) == 0) return i;
+    }
+    if (boneNameCount >= HOST_SKELETON_BONES) return -1;
+    boneNames[boneNameCount] = name;
+    return boneNameCount++;
+}
+
+void t3d_skeleton_destroy(T3DSkeleton *skeleton)
+{
+    free(skeleton->bones);
+    free(skeleton->boneMatricesFP);
+    skeleton->bones = NULL;
+    skeleton->boneMatricesFP = NULL;
+}
+
+// ---------------------------------------------------------------------------
+// Animations: clock only, no keyframes
+// ---------------------------------------------------------------------------
+
+#define HOST_ANIM_MAX_LENGTHS 64
+
+static struct {
+    const char *name;
+    float seconds;
+} animLengths[HOST_ANIM_MAX_LENGTHS];
+static int animLengthCount = 0;
+
+void host_anim_set_length(const char *name, float seconds)
+{
+    for (int i = 0; i < animLengthCount; i++) {
+        if (strcmp(animLengths[i].name, name) == 0) {
+            animLengths[i].seconds = seconds;
+            return;
+        }
+    }
+    if (animLengthCount >= HOST_ANIM_MAX_LENGTHS) return;
+    animLengths[animLengthCount].name = name;
+    animLengths[animLengthCount].seconds = seconds;
+    animLengthCount++;
+}
+
+T3DAnim t3d_anim_create(const T3DModel *model, const char *name)
+{
+    (void)model;
+    T3DChunkAnim *ref = malloc(sizeof(T3DChunkAnim));
+    ref->name = name;
+    ref->duration = HOST_ANIM_DEFAULT_LENGTH;
+    for (int i = 0; i < animLengthCount; i++) {
+        if (strcmp(animLengths[i].name, name) == 0) ref->duration = animLengths[i].seconds;
+    }
+
+    return (T3DAnim){
+        .animRef = ref,
+        .speed = 1.0f,
+        .isPlaying = true,
+        .isLooping = true,
+    };
+}
+
+void t3d_anim_destroy(T3DAnim *anim)
+{
+    free((void *)anim->animRef);
+    anim->animRef = NULL;
+}
+
+void t3d_anim_attach(T3DAnim *anim, const T3DSkeleton *skeleton)
+{
+    anim->skel = (T3DSkeleton *)skeleton;
+}
+
+void t3d_anim_set_time(T3DAnim *anim, float time)
+{
+    float len = anim->animRef->duration;
+    if (time < 0.0f) time = 0.0f;
+    if (time > len) time = len;
+    anim->time = time;
+}
+
+void t3d_anim_update(T3DAnim *anim, float deltaTime)
+{
+    if (!anim->isPlaying) return;
+
+    float len = anim->animRef->duration;
+    anim->time += deltaTime * anim->speed;
+    if (anim->time >= len) {
+        if (anim->isLooping) {
+            anim->time = fmodf(anim->time, len);
+        } else {
+            anim->time = len;
+            anim->isPlaying = false;
+        }
+    }
+    if (anim->skel) {
+        for (int i = 0; i < HOST_SKELETON_BONES; i++) anim->skel->bones[i].hasChanged = true;
+    }
+}
@@ -0,0 +1,2258 @@
+// Host microbenchmarks for the collision and math kernels.
+//
+// Every scu_* query, the mat4fp point/dir transforms, the bone cache, the
+// fixed-point vector helpers, the pose snapshots and N-way pose blend, the collision_mesh capsule
+// and segment queries and the floor height grid run over a
+// table of seeded random cases. Each one is timed (ns/query, including loop overhead) and its
+// results are checked against a double-precision reference that follows the
+// same algorithm (the swept queries, the mesh segment cast and the floor grid
+// against a brute-force search instead, and the baked static-box batch queries against the per-box kernels).
+// room_obbs_fixture loads the exporter's box fit of a small room with a pillar
+// (fixtures/room_pillar.py, generated by the Makefile) and checks it against
+// the room's own geometry; collision_mesh_col_fixture loads the same room's
+// binary mesh and checks its planes and wall grid against the mesh rebuilt
+// with collision_mesh_add_poly and collision_mesh_build_grid.
+//
+//   pandemonium-kernels [--iters N] [--seed N] [--only NAME] [--fixtures DIR]
+//
+// DIR defaults to "fixtures" next to the executable.
+//
+// Prints one "@KERNEL ..." line per kernel and a "@KERNELS ..." summary. It
+// exits non-zero if any kernel disagrees with its reference. Cases that land
+// within the reference's rounding margin of a decision boundary are counted as
+// "borderline" and not as mismatches.
+
+#include <libdragon.h>
+#include <t3d/t3d.h>
+#include <t3d/t3dmath.h>
+#include <float.h>
+#include <math.h>
+#include <time.h>
+
+#include "simple_collision_utility.h"
+#include "game_math.h"
+#include "collision_mesh.h"
+#include "bone_cache.h"
+#include "pose_blend.h"
+
+#define KERNEL_CASES 4096    // random cases per kernel, reused every iteration
+#define CASE_EXTENT 60.0f    // world-space spread of query positions
+
+#define ROOM_SIDES 12        // test room for collision_mesh: N-gon prism
+#define ROOM_RADIUS 300.0f
+#define ROOM_HEIGHT 200.0f
+
+#define TERRAIN_QUADS 8        // floor grid test: TERRAIN_QUADS^2 quads over +-TERRAIN_RADIUS
+#define TERRAIN_RADIUS 300.0f
+#define TERRAIN_PLATEAU_Y 120.0f
+#define TERRAIN_UNDER_PLATEAU_Y 110.0f // above the whole ramp (<= 105), under the plateau by more than the layer gap
+#define TERRAIN_FLOOR_CELL (2.0 * TERRAIN_RADIUS / 32) // FLOOR_GRID_DIM in collision_mesh.c
+
+#define ROOM_FIXTURE_HALF 100.0     // keep in sync with fixtures/room_pillar.py (model units)
+#define ROOM_FIXTURE_HEIGHT 60.0
+#define ROOM_FIXTURE_PILLAR_X 30.0
+#define ROOM_FIXTURE_PILLAR_Z -20.0
+#define ROOM_FIXTURE_PILLAR_HALF 10.0
+#define ROOM_FIXTURE_PILLAR_YAW 0.5
+#define ROOM_FIXTURE_THICKNESS 20.0
+#define ROOM_FIXTURE_BOXES 5        // four wall slabs and the pillar
+#define ROOM_FIXTURE_SCALE 2.0f     // loaded through a non-trivial mesh transform
+#define ROOM_FIXTURE_VERTICES 16    // welded room and pillar corners
+#define ROOM_FIXTURE_POLYS 20       // 8 room wall, 2 floor, 2 ceiling and 8 pillar triangles
+#define MESH_GRID_CELLS (16 * 16)   // COLLISION_GRID_DIM^2 in collision_mesh.c
+#define MESH_GRID_CELL_MAX_REFS 48  // COLLISION_GRID_CELL_MAX_REFS
+static const float roomFixtureOffset[3] = { 10.0f, -5.0f, 30.0f };
+
+typedef struct {
+    int iters;
+    uint32_t seed;
+    const char *only;
+    const char *fixtures;
+} KernelOptions;
+
+typedef struct {
+    const char *name;
+    double nsPerQuery;
+    int hits;            // reference verdicts that were "overlap" (bool kernels)
+    int mismatches;
+    int borderline;
+    double maxErr;       // largest deviation from the reference (vector kernels)
+} KernelResult;
+
+static volatile uint32_t sink;
+static uint32_t caseRng;
+static int failedKernels;
+static int kernelCount;
+
+static uint32_t case_rand(void)
+{
+    // xorshift32, same generator as the simulation bot
+    caseRng ^= caseRng << 13;
+    caseRng ^= caseRng >> 17;
+    caseRng ^= caseRng << 5;
+    return caseRng;
+}
+
+static float case_randf(float lo, float hi)
+{
+    return lo + (hi - lo) * ((float)(case_rand() & 0xFFFFFF) / 16777215.0f);
+}
+
+static void case_rand_vec3(float out[3], float extent)
+{
+    out[0] = case_randf(-extent, extent);
+    out[1] = case_randf(-extent, extent);
+    out[2] = case_randf(-extent, extent);
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static bool kernel_selected(const KernelOptions *opt, const char *name)
+{
+    return !opt->only || strcmp(opt->only, name) == 0;
+}
+
+static void kernel_report(const KernelResult *r)
+{
+    kernelCount++;
+    if (r->mismatches > 0) failedKernels++;
+    printf("@KERNEL %s ns_per_query=%.2f cases=%d hits=%d mismatches=%d borderline=%d max_err=%.3g\n",
+        r->name, r->nsPerQuery, KERNEL_CASES, r->hits, r->mismatches, r->borderline, r->maxErr);
+}
+
+// Runs `body` (which may use `i` and must fold its result into `acc`) over
+// every case, opt->iters times, after one untimed warm-up pass.
+#define KERNEL_TIME(opt, res, body) do {                                    \
+        uint32_t acc = 0;                                                   \
+        for (int i = 0; i < KERNEL_CASES; i++) { body; }                    \
+        uint64_t t0 = now_ns();                                             \
+        for (int it = 0; it < (opt)->iters; it++) {                         \
+            for (int i = 0; i < KERNEL_CASES; i++) { body; }                \
+        }                                                                   \
+        uint64_t t1 = now_ns();                                             \
+        sink += acc;                                                        \
+        (res).nsPerQuery = (double)(t1 - t0) / ((double)(opt)->iters * KERNEL_CASES); \
+    } while (0)
+
+// Boolean verdict check: a float/double disagreement only counts as a
+// mismatch when the reference is clearly on one side of the boundary.
+static void kernel_check_bool(KernelResult *r, bool got, bool want, double margin, double tol)
+{
+    if (want) r->hits++;
+    if (got == want) return;
+    if (fabs(margin) <= tol) r->borderline++;
+    else r->mismatches++;
+}
+
+static double boundary_tol(double a, double b)
+{
+    // float has ~7 significant digits; distances are squared before comparing
+    return 1e-4 * (fabs(a) + fabs(b)) + 1e-3;
+}
+
+/* ------------------------------------------------------------------
+ * Double-precision references
+ * ------------------------------------------------------------------ */
+
+static double ref_clamp(double x, double lo, double hi)
+{
+    return (x < lo) ? lo : (x > hi ? hi : x);
+}
+
+static double ref_dot(const double a[3], const double b[3])
+{
+    return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+}
+
+static void ref_load(double out[3], const float in[3])
+{
+    out[0] = in[0]; out[1] = in[1]; out[2] = in[2];
+}
+
+static double ref_dist2(const double a[3], const double b[3])
+{
+    double d[3] = { a[0] - b[0], a[1] - b[1], a[2] - b[2] };
+    return ref_dot(d, d);
+}
+
+static void ref_closest_on_segment(const double a[3], const double b[3], const double p[3], double out[3])
+{
+    double ab[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+    double ap[3] = { p[0] - a[0], p[1] - a[1], p[2] - a[2] };
+    double ab2 = ref_dot(ab, ab);
+    double t = (ab2 > 0.0) ? ref_clamp(ref_dot(ap, ab) / ab2, 0.0, 1.0) : 0.0;
+    for (int k = 0; k < 3; k++) out[k] = a[k] + ab[k] * t;
+}
+
+// Ericson's closest points between segments, same degenerate thresholds as
+// simple_collision_utility.c.
+static double ref_segment_segment_dist2(const double p1[3], const double q1[3], const double p2[3], const double q2[3])
+{
+    const double EPS = 1e-4;
+    double d1[3] = { q1[0] - p1[0], q1[1] - p1[1], q1[2] - p1[2] };
+    double d2[3] = { q2[0] - p2[0], q2[1] - p2[1], q2[2] - p2[2] };
+    double r[3]  = { p1[0] - p2[0], p1[1] - p2[1], p1[2] - p2[2] };
+    double a = ref_dot(d1, d1), e = ref_dot(d2, d2), f = ref_dot(d2, r);
+    double s, t;
+
+    if (a <= EPS && e <= EPS) return ref_dist2(p1, p2);
+    if (a <= EPS) {
+        s = 0.0;
+        t = ref_clamp(f / e, 0.0, 1.0);
+    } else {
+        double c = ref_dot(d1, r);
+        if (e <= EPS) {
+            t = 0.0;
+            s = ref_clamp(-c / a, 0.0, 1.0);
+        } else {
+            double b = ref_dot(d1, d2);
+            double denom = a*e - b*b;
+            s = (fabs(denom) > EPS) ? ref_clamp((b*f - c*e) / denom, 0.0, 1.0) : 0.0;
+            t = (b*s + f) / e;
+            if (t < 0.0) {
+                t = 0.0;
+                s = ref_clamp(-c / a, 0.0, 1.0);
+            } else if (t > 1.0) {
+                t = 1.0;
+                s = ref_clamp((b - c) / a, 0.0, 1.0);
+            }
+        }
+    }
+
+    double c1[3], c2[3];
+    for (int k = 0; k < 3; k++) {
+        c1[k] = p1[k] + d1[k] * s;
+        c2[k] = p2[k] + d2[k] * t;
+    }
+    return ref_dist2(c1, c2);
+}
+
+// Mirrors the game's approximation: the segment point nearest the box center,
+// then point-vs-box distance.
+static double ref_segment_aabb_dist2(const double a[3], const double b[3], const double bmin[3], const double bmax[3])
+{
+    double ab[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+    double ac[3];
+    for (int k = 0; k < 3; k++) ac[k] = 0.5 * (bmin[k] + bmax[k]) - a[k];
+    double den = ref_dot(ab, ab);
+    if (den <= 1e-8) den = 1.0;
+    double t = ref_clamp(ref_dot(ac, ab) / den, 0.0, 1.0);
+
+    double d2 = 0.0;
+    for (int k = 0; k < 3; k++) {
+        double c = a[k] + ab[k] * t;
+        double d = (c < bmin[k]) ? bmin[k] - c : (c > bmax[k] ? c - bmax[k] : 0.0);
+        d2 += d * d;
+    }
+    return d2;
+}
+
+static double ref_point_aabb_dist2(const double p[3], const double bmin[3], const double bmax[3])
+{
+    double d2 = 0.0;
+    for (int k = 0; k < 3; k++) {
+        double d = (p[k] < bmin[k]) ? bmin[k] - p[k] : (p[k] > bmax[k] ? p[k] - bmax[k] : 0.0);
+        d2 += d * d;
+    }
+    return d2;
+}
+
+/* ------------------------------------------------------------------
+ * scu_* kernels
+ * ------------------------------------------------------------------ */
+
+typedef struct {
+    float a0[3], a1[3], ra;     // capsule A / sphere A (a1 unused for spheres)
+    float b0[3], b1[3], rb;     // capsule B / sphere B
+    float min[3], max[3];       // AABB
+} ShapeCase;
+
+static ShapeCase shapeCases[KERNEL_CASES];
+
+static void shape_cases_init(void)
+{
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        ShapeCase *c = &shapeCases[i];
+        float d[3];
+        case_rand_vec3(c->a0, CASE_EXTENT);
+        case_rand_vec3(d, 40.0f);
+        for (int k = 0; k < 3; k++) c->a1[k] = c->a0[k] + d[k];
+        case_rand_vec3(c->b0, CASE_EXTENT);
+        case_rand_vec3(d, 40.0f);
+        for (int k = 0; k < 3; k++) c->b1[k] = c->b0[k] + d[k];
+        // A few degenerate (zero-length) capsules to cover those branches
+        if ((i & 31) == 0) memcpy(c->a1, c->a0, sizeof(c->a1));
+        c->ra = case_randf(1.0f, 30.0f);
+        c->rb = case_randf(1.0f, 30.0f);
+        float m[3];
+        case_rand_vec3(m, CASE_EXTENT);
+        for (int k = 0; k < 3; k++) {
+            c->min[k] = m[k];
+            c->max[k] = m[k] + case_randf(1.0f, 60.0f);
+        }
+    }
+}
+
+static void bench_scu_bool_kernels(const KernelOptions *opt)
+{
+    if (kernel_selected(opt, "scu_sphere_vs_sphere_f")) {
+        KernelResult r = { .name = "scu_sphere_vs_sphere_f" };
+        KERNEL_TIME(opt, r, acc += scu_sphere_vs_sphere_f(shapeCases[i].a0, shapeCases[i].ra, shapeCases[i].b0, shapeCases[i].rb));
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            const ShapeCase *c = &shapeCases[i];
+            double a[3], b[3];
+            ref_load(a, c->a0); ref_load(b, c->b0);
+            double rs = (double)c->ra + c->rb, d2 = ref_dist2(a, b);
+            kernel_check_bool(&r, scu_sphere_vs_sphere_f(c->a0, c->ra, c->b0, c->rb), d2 <= rs * rs,
+                d2 - rs * rs, boundary_tol(d2, rs * rs));
+        }
+        kernel_report(&r);
+    }
+
+    if (kernel_selected(opt, "scu_sphere_vs_rect_f")) {
+        KernelResult r = { .name = "scu_sphere_vs_rect_f" };
+        KERNEL_TIME(opt, r, acc += scu_sphere_vs_rect_f(shapeCases[i].a0, shapeCases[i].ra, shapeCases[i].min, shapeCases[i].max));
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            const ShapeCase *c = &shapeCases[i];
+            double p[3], mn[3], mx[3];
+            ref_load(p, c->a0); ref_load(mn, c->min); ref_load(mx, c->max);
+            double r2 = (double)c->ra * c->ra, d2 = ref_point_aabb_dist2(p, mn, mx);
+            kernel_check_bool(&r, scu_sphere_vs_rect_f(c->a0, c->ra, c->min, c->max), d2 <= r2,
+                d2 - r2, boundary_tol(d2, r2));
+        }
+        kernel_report(&r);
+    }
+
+    if (kernel_selected(opt, "scu_rect_vs_rect_f")) {
+        // Second box: the B sphere's bounds, so sizes differ from the first
+        static float bmin[KERNEL_CASES][3], bmax[KERNEL_CASES][3];
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            for (int k = 0; k < 3; k++) {
+                bmin[i][k] = shapeCases[i].b0[k] - shapeCases[i].rb;
+                bmax[i][k] = shapeCases[i].b0[k] + shapeCases[i].rb;
+            }
+        }
+        KernelResult r = { .name = "scu_rect_vs_rect_f" };
+        KERNEL_TIME(opt, r, acc += scu_rect_vs_rect_f(shapeCases[i].min, shapeCases[i].max, bmin[i], bmax[i]));
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            const ShapeCase *c = &shapeCases[i];
+            bool want = true;
+            double margin = INFINITY;
+            for (int k = 0; k < 3; k++) {
+                double gap = fmax((double)bmin[i][k] - c->max[k], (double)c->min[k] - bmax[i][k]);
+                if (gap > 0.0) want = false;
+                margin = fmin(margin, fabs(gap));
+            }
+            kernel_check_bool(&r, scu_rect_vs_rect_f(c->min, c->max, bmin[i], bmax[i]), want, margin, 0.0);
+        }
+        kernel_report(&r);
+    }
+
+    if (kernel_selected(opt, "scu_capsule_vs_sphere_f")) {
+        KernelResult r = { .name = "scu_capsule_vs_sphere_f" };
+        KERNEL_TIME(opt, r, acc += scu_capsule_vs_sphere_f(shapeCases[i].a0, shapeCases[i].a1, shapeCases[i].ra, shapeCases[i].b0, shapeCases[i].rb));
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            const ShapeCase *c = &shapeCases[i];
+            double a[3], b[3], p[3], q[3];
+            ref_load(a, c->a0); ref_load(b, c->a1); ref_load(p, c->b0);
+            ref_closest_on_segment(a, b, p, q);
+            double rs = (double)c->ra + c->rb, d2 = ref_dist2(q, p);
+            kernel_check_bool(&r, scu_capsule_vs_sphere_f(c->a0, c->a1, c->ra, c->b0, c->rb), d2 <= rs * rs,
+                d2 - rs * rs, boundary_tol(d2, rs * rs));
+        }
+        kernel_report(&r);
+    }
+
+    if (kernel_selected(opt, "scu_capsule_vs_rect_f")) {
+        KernelResult r = { .name = "scu_capsule_vs_rect_f" };
+        KERNEL_TIME(opt, r, acc += scu_capsule_vs_rect_f(shapeCases[i].a0, shapeCases[i].a1, shapeCases[i].ra, shapeCases[i].min, shapeCases[i].max));
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            const ShapeCase *c = &shapeCases[i];
+            double a[3], b[3], mn[3], mx[3];
+            ref_load(a, c->a0); ref_load(b, c->a1); ref_load(mn, c->min); ref_load(mx, c->max);
+            double r2 = (double)c->ra * c->ra, d2 = ref_segment_aabb_dist2(a, b, mn, mx);
+            kernel_check_bool(&r, scu_capsule_vs_rect_f(c->a0, c->a1, c->ra, c->min, c->max), d2 <= r2,
+                d2 - r2, boundary_tol(d2, r2));
+        }
+        kernel_report(&r);
+    }
+
+    if (kernel_selected(opt, "scu_capsule_vs_capsule_f")) {
+        KernelResult r = { .name = "scu_capsule_vs_capsule_f" };
+        KERNEL_TIME(opt, r, acc += scu_capsule_vs_capsule_f(shapeCases[i].a0, shapeCases[i].a1, shapeCases[i].ra, shapeCases[i].b0, shapeCases[i].b1, shapeCases[i].rb));
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            const ShapeCase *c = &shapeCases[i];
+            double a0[3], a1[3], b0[3], b1[3];
+            ref_load(a0, c->a0); ref_load(a1, c->a1); ref_load(b0, c->b0); ref_load(b1, c->b1);
+            double rs = (double)c->ra + c->rb, d2 = ref_segment_segment_dist2(a0, a1, b0, b1);
+            kernel_check_bool(&r, scu_capsule_vs_capsule_f(c->a0, c->a1, c->ra, c->b0, c->b1, c->rb), d2 <= rs * rs,
+                d2 - rs * rs, boundary_tol(d2, rs * rs));
+        }
+        kernel_report(&r);
+    }
+}
+
+typedef struct {
+    float capA[3], capB[3], radius;
+    SCU_OBB obb;
+} ObbCase;
+
+static ObbCase obbCases[KERNEL_CASES];
+
+static void obb_cases_init(void)
+{
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        ObbCase *c = &obbCases[i];
+        // Vertical capsule, like the character and boss colliders
+        c->capA[0] = c->capB[0] = case_randf(-CASE_EXTENT, CASE_EXTENT);
+        c->capA[2] = c->capB[2] = case_randf(-CASE_EXTENT, CASE_EXTENT);
+        c->capA[1] = case_randf(-20.0f, 20.0f);
+        c->capB[1] = c->capA[1] + case_randf(10.0f, 50.0f);
+        c->radius = case_randf(2.0f, 20.0f);
+        case_rand_vec3(c->obb.center, CASE_EXTENT * 0.5f);
+        c->obb.half[0] = case_randf(4.0f, 40.0f);
+        c->obb.half[1] = case_randf(4.0f, 40.0f);
+        c->obb.half[2] = case_randf(4.0f, 40.0f);
+        c->obb.yaw = case_randf(-T3D_PI, T3D_PI);
+    }
+}
+
+// Returns the reference verdict; `margin` is the signed distance from the
+// nearest decision boundary (Y gate, circle edge or face-choice tie).
+static bool ref_capsule_vs_obb(const ObbCase *c, double push[3], double n[3], double *margin)
+{
+    push[0] = push[1] = push[2] = 0.0;
+    n[0] = n[1] = n[2] = 0.0;
+
+    double capMinY = fmin(c->capA[1], c->capB[1]) - (double)c->radius;
+    double capMaxY = fmax(c->capA[1], c->capB[1]) + (double)c->radius;
+    double obbMinY = (double)c->obb.center[1] - c->obb.half[1];
+    double obbMaxY = (double)c->obb.center[1] + c->obb.half[1];
+    double yGap = fmax(obbMinY - capMaxY, capMinY - obbMaxY);
+    *margin = fabs(yGap);
+    if (yGap > 0.0) return false;
+
+    double cx = 0.5 * ((double)c->capA[0] + c->capB[0]);
+    double cz = 0.5 * ((double)c->capA[2] + c->capB[2]);
+    double dx = cx - c->obb.center[0], dz = cz - c->obb.center[2];
+    double co = cos(c->obb.yaw), si = sin(c->obb.yaw);
+    double lx =  co * dx + si * dz;
+    double lz = -si * dx + co * dz;
+    double hx = c->obb.half[0], hz = c->obb.half[2], r = c->radius;
+
+    double qx = ref_clamp(lx, -hx, hx), qz = ref_clamp(lz, -hz, hz);
+    double vx = lx - qx, vz = lz - qz;
+    double d2 = vx*vx + vz*vz;
+    double plx, plz, nlx, nlz;
+
+    if (d2 > 0.0) {
+        double d = sqrt(d2);
+        *margin = fmin(*margin, fabs(d - r));
+        if (d >= r) return false;
+        nlx = vx / d; nlz = vz / d;
+        plx = nlx * (r - d); plz = nlz * (r - d);
+    } else {
+        double px = hx - fabs(lx), pz = hz - fabs(lz);
+        *margin = fmin(*margin, fmin(fabs(px - pz), fmin(px, pz)));
+        if (px < pz) {
+            double sign = (lx >= 0.0) ? 1.0 : -1.0;
+            nlx = sign; nlz = 0.0;
+            plx = (px + r) * sign; plz = 0.0;
+        } else {
+            double sign = (lz >= 0.0) ? 1.0 : -1.0;
+            nlx = 0.0; nlz = sign;
+            plx = 0.0; plz = (pz + r) * sign;
+        }
+    }
+
+    push[0] = co * plx - si * plz; push[2] = si * plx + co * plz;
+    n[0]    = co * nlx - si * nlz; n[2]    = si * nlx + co * nlz;
+    return true;
+}
+
+static void bench_scu_obb(const KernelOptions *opt)
+{
+    if (!kernel_selected(opt, "scu_capsule_vs_obb_push_xz_f")) return;
+
+    KernelResult r = { .name = "scu_capsule_vs_obb_push_xz_f" };
+    float push[3], n[3];
+    KERNEL_TIME(opt, r, {
+        const ObbCase *c = &obbCases[i];
+        acc += scu_capsule_vs_obb_push_xz_f(c->capA, c->capB, c->radius, &c->obb, push, n);
+        acc += (uint32_t)(int32_t)push[0];
+    });
+
+    const double tol = 1e-3;
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        const ObbCase *c = &obbCases[i];
+        double refPush[3], refN[3], margin;
+        bool want = ref_capsule_vs_obb(c, refPush, refN, &margin);
+        bool got = scu_capsule_vs_obb_push_xz_f(c->capA, c->capB, c->radius, &c->obb, push, n);
+        if (want) r.hits++;
+        if (margin <= tol) {
+            if (got != want) r.borderline++;
+            continue;
+        }
+        if (got != want) {
+            r.mismatches++;
+            continue;
+        }
+        double err = 0.0;
+        for (int k = 0; k < 3; k++) {
+            err = fmax(err, fabs(push[k] - refPush[k]));
+            err = fmax(err, fabs(n[k] - refN[k]));
+        }
+        r.maxErr = fmax(r.maxErr, err);
+        if (err > tol) r.mismatches++;
+    }
+    kernel_report(&r);
+}
+
+// Sweep cases reuse the OBB table with a random XZ move per case (drawn after
+// every other table so the older kernels keep their seeded cases).
+static float sweepMoves[KERNEL_CASES][2];
+
+static void sweep_cases_init(void)
+{
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        sweepMoves[i][0] = case_randf(-CASE_EXTENT, CASE_EXTENT);
+        sweepMoves[i][1] = case_randf(-CASE_EXTENT, CASE_EXTENT);
+    }
+}
+
+// Signed distance from the circle at local (x, z) to the box, and the local
+// normal from the closest box point.
+static double ref_circle_box_dist(double x, double z, double hx, double hz, double r, double n[2])
+{
+    double qx = ref_clamp(x, -hx, hx), qz = ref_clamp(z, -hz, hz);
+    double vx = x - qx, vz = z - qz;
+    double d = sqrt(vx*vx + vz*vz);
+    if (d > 0.0) { n[0] = vx / d; n[1] = vz / d; }
+    else { n[0] = n[1] = 0.0; }
+    return d - r;
+}
+
+// Independent of the game's slab/corner split: distance to a convex box is
+// convex along the ray, so ternary search finds the closest approach and
+// bisection the first touch before it. Starting overlaps use the static
+// reference's normal.
+static bool ref_capsule_sweep_obb(const ObbCase *c, const float move[2], double *toi, double n[3], double *margin)
+{
+    n[0] = n[1] = n[2] = 0.0;
+    *toi = 1.0;
+
+    double push[3], pn[3];
+    if (ref_capsule_vs_obb(c, push, pn, margin)) {
+        double mn = move[0] * pn[0] + move[1] * pn[2];
+        *margin = fmin(*margin, fabs(mn) / (sqrt((double)move[0]*move[0] + (double)move[1]*move[1]) + 1e-9));
+        if (mn >= 0.0) return false;
+        *toi = 0.0;
+        n[0] = pn[0]; n[2] = pn[2];
+        return true;
+    }
+
+    double capMinY = fmin(c->capA[1], c->capB[1]) - (double)c->radius;
+    double capMaxY = fmax(c->capA[1], c->capB[1]) + (double)c->radius;
+    double obbMinY = (double)c->obb.center[1] - c->obb.half[1];
+    double obbMaxY = (double)c->obb.center[1] + c->obb.half[1];
+    double yGap = fmax(obbMinY - capMaxY, capMinY - obbMaxY);
+    *margin = fabs(yGap);
+    if (yGap > 0.0) return false;
+
+    double cx = 0.5 * ((double)c->capA[0] + c->capB[0]);
+    double cz = 0.5 * ((double)c->capA[2] + c->capB[2]);
+    double dx = cx - c->obb.center[0], dz = cz - c->obb.center[2];
+    double co = cos(c->obb.yaw), si = sin(c->obb.yaw);
+    double lx =  co * dx + si * dz, lz = -si * dx + co * dz;
+    double mx =  co * move[0] + si * move[1], mz = -si * move[0] + co * move[1];
+    double hx = c->obb.half[0], hz = c->obb.half[2], r = c->radius;
+    double ln[2];
+
+    double lo = 0.0, hi = 1.0;
+    for (int k = 0; k < 200; k++) {
+        double t1 = lo + (hi - lo) / 3.0, t2 = hi - (hi - lo) / 3.0;
+        if (ref_circle_box_dist(lx + mx*t1, lz + mz*t1, hx, hz, r, ln) <
+            ref_circle_box_dist(lx + mx*t2, lz + mz*t2, hx, hz, r, ln)) hi = t2;
+        else lo = t1;
+    }
+    double tClosest = 0.5 * (lo + hi);
+    double dClosest = ref_circle_box_dist(lx + mx*tClosest, lz + mz*tClosest, hx, hz, r, ln);
+    *margin = fmin(*margin, fabs(dClosest));
+    if (dClosest > 0.0) return false;
+
+    lo = 0.0; hi = tClosest;
+    for (int k = 0; k < 100; k++) {
+        double mid = 0.5 * (lo + hi);
+        if (ref_circle_box_dist(lx + mx*mid, lz + mz*mid, hx, hz, r, ln) > 0.0) lo = mid;
+        else hi = mid;
+    }
+    *toi = hi;
+    ref_circle_box_dist(lx + mx*lo, lz + mz*lo, hx, hz, r, ln);
+    n[0] = co * ln[0] - si * ln[1];
+    n[2] = si * ln[0] + co * ln[1];
+    return true;
+}
+
+static void bench_scu_sweep(const KernelOptions *opt)
+{
+    if (!kernel_selected(opt, "scu_capsule_sweep_obb_xz_f")) return;
+
+    KernelResult r = { .name = "scu_capsule_sweep_obb_xz_f" };
+    float toi, n[3];
+    KERNEL_TIME(opt, r, {
+        const ObbCase *c = &obbCases[i];
+        acc += scu_capsule_sweep_obb_xz_f(c->capA, c->capB, c->radius,
+            sweepMoves[i][0], sweepMoves[i][1], &c->obb, &toi, n);
+        acc += (uint32_t)(int32_t)(toi * 1000.0f);
+    });
+
+    const double tol = 1e-3;
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        const ObbCase *c = &obbCases[i];
+        double refToi, refN[3], margin;
+        bool want = ref_capsule_sweep_obb(c, sweepMoves[i], &refToi, refN, &margin);
+        bool got = scu_capsule_sweep_obb_xz_f(c->capA, c->capB, c->radius,
+            sweepMoves[i][0], sweepMoves[i][1], &c->obb, &toi, n);
+        if (want) r.hits++;
+        if (margin <= tol) {
+            if (got != want) r.borderline++;
+            continue;
+        }
+        if (got != want) {
+            r.mismatches++;
+            continue;
+        }
+        if (!want) continue;
+        // Time of impact compared as distance travelled along the move
+        double len = sqrt((double)sweepMoves[i][0] * sweepMoves[i][0] + (double)sweepMoves[i][1] * sweepMoves[i][1]);
+        double err = fabs(toi - refToi) * len;
+        for (int k = 0; k < 3; k++) {
+            err = fmax(err, fabs(n[k] - refN[k]));
+        }
+        r.maxErr = fmax(r.maxErr, err);
+        if (err > tol) r.mismatches++;
+    }
+    kernel_report(&r);
+}
+
+// Swept capsule cases reuse the shape table: capsule A's endpoints each move
+// by their own random offset (so the blade turns as well as translates)
+// against capsule B. Drawn after the sweep moves for the same reason.
+static float bladeMoves[KERNEL_CASES][2][3];
+
+static void blade_cases_init(void)
+{
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        case_rand_vec3(bladeMoves[i][0], CASE_EXTENT);
+        case_rand_vec3(bladeMoves[i][1], CASE_EXTENT);
+    }
+}
+
+#define REF_BLADE_SAMPLES 4096
+
+// Dense sampling in double: the first touch, and how long (as a fraction of
+// the step) the first overlap lasts. A shorter overlap than the kernel's
+// sample spacing is a graze it may step over by design.
+static bool ref_swept_capsule(const ShapeCase *c, const float move[2][3], double *toi, double *overlapLen, double *margin)
+{
+    double a0[3], a1[3], b0[3], b1[3];
+    ref_load(a0, c->a0); ref_load(a1, c->a1); ref_load(b0, c->b0); ref_load(b1, c->b1);
+    double rs = (double)c->ra + c->rb;
+
+    bool hit = false;
+    *margin = INFINITY;
+    *overlapLen = 0.0;
+    for (int k = 0; k <= REF_BLADE_SAMPLES; k++) {
+        double t = (double)k / REF_BLADE_SAMPLES, p[3], q[3];
+        for (int j = 0; j < 3; j++) {
+            p[j] = a0[j] + move[0][j] * t;
+            q[j] = a1[j] + move[1][j] * t;
+        }
+        double d = sqrt(ref_segment_segment_dist2(p, q, b0, b1)) - rs;
+        *margin = fmin(*margin, fabs(d));
+        if (d <= 0.0) {
+            if (!hit) *toi = t;
+            hit = true;
+            *overlapLen = t - *toi;
+        } else if (hit) {
+            break;
+        }
+    }
+    return hit;
+}
+
+static void bench_scu_swept_capsule(const KernelOptions *opt)
+{
+    if (!kernel_selected(opt, "scu_swept_capsule_vs_capsule_f")) return;
+
+    static float ends[KERNEL_CASES][2][3];
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        for (int k = 0; k < 3; k++) {
+            ends[i][0][k] = shapeCases[i].a0[k] + bladeMoves[i][0][k];
+            ends[i][1][k] = shapeCases[i].a1[k] + bladeMoves[i][1][k];
+        }
+    }
+
+    KernelResult r = { .name = "scu_swept_capsule_vs_capsule_f" };
+    float toi = 0.0f;
+    KERNEL_TIME(opt, r, {
+        const ShapeCase *c = &shapeCases[i];
+        acc += scu_swept_capsule_vs_capsule_f(c->a0, c->a1, ends[i][0], ends[i][1], c->ra,
+            c->b0, c->b1, c->rb, &toi);
+        acc += (uint32_t)(int32_t)(toi * 1000.0f);
+    });
+
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        const ShapeCase *c = &shapeCases[i];
+        double refToi = 1.0, overlapLen, margin;
+        bool want = ref_swept_capsule(c, bladeMoves[i], &refToi, &overlapLen, &margin);
+        bool got = scu_swept_capsule_vs_capsule_f(c->a0, c->a1, ends[i][0], ends[i][1], c->ra,
+            c->b0, c->b1, c->rb, &toi);
+        if (want) r.hits++;
+
+        // Kernel sample spacing as a fraction of the step
+        double travel = 0.0;
+        for (int e = 0; e < 2; e++) {
+            double m[3];
+            ref_load(m, bladeMoves[i][e]);
+            travel = fmax(travel, sqrt(ref_dot(m, m)));
+        }
+        // Past the sample cap the gaps between samples are searched too, so
+        // only uncapped sweeps may step over a graze
+        double spacing = fmin(1.0, fmax((double)(c->ra + c->rb) / travel, 1.0 / SCU_SWEEP_MAX_SAMPLES));
+        bool capped = (double)(c->ra + c->rb) * SCU_SWEEP_MAX_SAMPLES < travel;
+
+        if (margin <= 1e-3 || (want && !got && !capped && overlapLen < spacing)) {
+            if (got != want) r.borderline++;
+            continue;
+        }
+        if (got != want) {
+            r.mismatches++;
+            continue;
+        }
+        if (!want) continue;
+        // First touch lies between the last clear sample and the first overlapping one
+        double err = fabs(toi - refToi);
+        r.maxErr = fmax(r.maxErr, err);
+        if (err > spacing / 32.0 + 2.0 / REF_BLADE_SAMPLES) r.mismatches++;
+    }
+
+    // Blades sweeping far more than SCU_SWEEP_MAX_SAMPLES combined radii: a
+    // thin post between two capped samples is hit, one beside the path isn't
+    static const struct { float postX, postZ; bool want; } longSweeps[] = {
+        { 103.1f, 0.0f, true },   // samples at x=100 and x=106.25 both clear it
+        { 103.1f, 3.0f, false },
+        { 197.0f, 1.5f, false },
+        { 2.0f, 0.9f, true },
+    };
+    for (int i = 0; i < (int)(sizeof(longSweeps) / sizeof(longSweeps[0])); i++) {
+        const float a0[3] = { 0.0f, 0.0f, 0.0f }, a1[3] = { 0.0f, 10.0f, 0.0f };
+        const float e0[3] = { 200.0f, 0.0f, 0.0f }, e1[3] = { 200.0f, 10.0f, 0.0f };
+        const float b0[3] = { longSweeps[i].postX, 2.0f, longSweeps[i].postZ };
+        const float b1[3] = { longSweeps[i].postX, 8.0f, longSweeps[i].postZ };
+        bool got = scu_swept_capsule_vs_capsule_f(a0, a1, e0, e1, 0.5f, b0, b1, 0.5f, &toi);
+        if (longSweeps[i].want) r.hits++;
+        if (got != longSweeps[i].want) {
+            r.mismatches++;
+            continue;
+        }
+        // First touch: the blade's face reaches the post at postX - sqrt(1 - z^2)
+        if (got && longSweeps[i].postZ < 1.0f) {
+            double wantToi = (longSweeps[i].postX - sqrt(1.0 - (double)longSweeps[i].postZ * longSweeps[i].postZ)) / 200.0;
+            double err = fabs(toi - wantToi);
+            r.maxErr = fmax(r.maxErr, err);
+            if (err > 1e-3) r.mismatches++;
+        }
+    }
+    kernel_report(&r);
+}
+
+// Segment cases reuse the OBB table: from capsule endpoint A by a random move
+// in 3D. Drawn after the blade moves.
+static float rayMoves[KERNEL_CASES][3];
+
+static void ray_cases_init(void)
+{
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        case_rand_vec3(rayMoves[i], CASE_EXTENT * 1.5f);
+    }
+}
+
+// Same slab test in double. `margin` (world units) covers grazing the box,
+// starting on its surface, face-choice ties at edges and hits at the far end.
+static bool ref_segment_vs_obb(const ObbCase *c, const float move[3], double *t, double n[3], double *margin)
+{
+    const SCU_OBB *o = &c->obb;
+    double co = cos(o->yaw), si = sin(o->yaw);
+    double dx = (double)c->capA[0] - o->center[0], dz = (double)c->capA[2] - o->center[2];
+    double l[3] = { co * dx + si * dz, (double)c->capA[1] - o->center[1], -si * dx + co * dz };
+    double m[3] = { co * move[0] + si * move[2], move[1], -si * move[0] + co * move[2] };
+    double len = sqrt((double)move[0] * move[0] + (double)move[1] * move[1] + (double)move[2] * move[2]);
+
+    double enter[3], leave[3];
+    double tmin = 0.0, tmax = 1.0;
+    int axis = -1;
+    *margin = INFINITY;
+    for (int k = 0; k < 3; k++) {
+        double e = o->half[k];
+        *margin = fmin(*margin, fabs(fabs(l[k]) - e));
+        if (fabs(m[k]) < 1e-6) {
+            enter[k] = -INFINITY; leave[k] = INFINITY;
+            if (l[k] < -e || l[k] > e) return false;
+            continue;
+        }
+        double t1 = (-e - l[k]) / m[k], t2 = (e - l[k]) / m[k];
+        enter[k] = fmin(t1, t2); leave[k] = fmax(t1, t2);
+        if (enter[k] > tmin) { tmin = enter[k]; axis = k; }
+        tmax = fmin(tmax, leave[k]);
+    }
+    *margin = fmin(*margin, fabs(tmax - tmin) * len);
+    if (tmin > tmax || axis < 0) return false;
+
+    for (int k = 0; k < 3; k++) {
+        if (k != axis) *margin = fmin(*margin, fabs(enter[k] - tmin) * len);
+    }
+    *margin = fmin(*margin, fabs(1.0 - tmin) * len);
+
+    double nl[3] = { 0.0, 0.0, 0.0 };
+    nl[axis] = (m[axis] > 0.0) ? -1.0 : 1.0;
+    *t = tmin;
+    n[0] = co * nl[0] - si * nl[2];
+    n[1] = nl[1];
+    n[2] = si * nl[0] + co * nl[2];
+    return true;
+}
+
+static void bench_scu_segment_obb(const KernelOptions *opt)
+{
+    if (!kernel_selected(opt, "scu_segment_vs_obb_f")) return;
+
+    static float ends[KERNEL_CASES][3];
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        for (int k = 0; k < 3; k++) ends[i][k] = obbCases[i].capA[k] + rayMoves[i][k];
+    }
+
+    KernelResult r = { .name = "scu_segment_vs_obb_f" };
+    float t = 0.0f, n[3];
+    KERNEL_TIME(opt, r, {
+        acc += scu_segment_vs_obb_f(obbCases[i].capA, ends[i], &obbCases[i].obb, &t, n);
+        acc += (uint32_t)(int32_t)(t * 1000.0f);
+    });
+
+    const double tol = 1e-3;
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        const ObbCase *c = &obbCases[i];
+        double refT, refN[3], margin;
+        bool want = ref_segment_vs_obb(c, rayMoves[i], &refT, refN, &margin);
+        bool got = scu_segment_vs_obb_f(c->capA, ends[i], &c->obb, &t, n);
+        if (want) r.hits++;
+        if (margin <= tol) {
+            if (got != want) r.borderline++;
+            continue;
+        }
+        if (got != want) {
+            r.mismatches++;
+            continue;
+        }
+        if (!want) continue;
+        double m[3];
+        ref_load(m, rayMoves[i]);
+        double err = fabs(t - refT) * sqrt(ref_dot(m, m));
+        for (int k = 0; k < 3; k++) err = fmax(err, fabs(n[k] - refN[k]));
+        r.maxErr = fmax(r.maxErr, err);
+        if (err > tol) r.mismatches++;
+    }
+    kernel_report(&r);
+}
+
+// Batch queries against a baked set: the per-box kernels above over the same
+// boxes are the reference, so results must match them exactly. Boxes come
+// from the OBB table; each case's capsule and move are reused.
+#define STATIC_SET_BOXES 12
+
+static SCU_StaticOBBSet staticSet;
+static SCU_OBB staticBoxes[STATIC_SET_BOXES];
+
+static void static_set_init(void)
+{
+    for (int i = 0; i < STATIC_SET_BOXES; i++) {
+        staticBoxes[i] = obbCases[i * (KERNEL_CASES / STATIC_SET_BOXES)].obb;
+    }
+    scu_static_obbs_bake(&staticSet, staticBoxes, STATIC_SET_BOXES);
+}
+
+static void bench_scu_static_obbs(const KernelOptions *opt)
+{
+    if (kernel_selected(opt, "scu_capsule_vs_static_obbs_push_xz_f")) {
+        KernelResult r = { .name = "scu_capsule_vs_static_obbs_push_xz_f" };
+        SCU_Contact contacts[STATIC_SET_BOXES];
+        KERNEL_TIME(opt, r, {
+            const ObbCase *c = &obbCases[i];
+            acc += scu_capsule_vs_static_obbs_push_xz_f(&staticSet, c->capA, c->capB, c->radius,
+                contacts, STATIC_SET_BOXES);
+        });
+
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            const ObbCase *c = &obbCases[i];
+            int got = scu_capsule_vs_static_obbs_push_xz_f(&staticSet, c->capA, c->capB, c->radius,
+                contacts, STATIC_SET_BOXES);
+            int want = 0;
+            for (int b = 0; b < STATIC_SET_BOXES; b++) {
+                float push[3], n[3];
+                if (!scu_capsule_vs_obb_push_xz_f(c->capA, c->capB, c->radius, &staticBoxes[b], push, n)) continue;
+                if (want >= got || contacts[want].index != b ||
+                    memcmp(contacts[want].push, push, sizeof(push)) != 0 ||
+                    memcmp(contacts[want].n, n, sizeof(n)) != 0) r.mismatches++;
+                want++;
+            }
+            if (want > 0) r.hits++;
+            if (got != want) r.mismatches++;
+        }
+        kernel_report(&r);
+    }
+
+    if (kernel_selected(opt, "scu_capsule_vs_static_obbs_deepest_xz_f")) {
+        KernelResult r = { .name = "scu_capsule_vs_static_obbs_deepest_xz_f" };
+        SCU_Contact contact;
+        KERNEL_TIME(opt, r, {
+            const ObbCase *c = &obbCases[i];
+            acc += scu_capsule_vs_static_obbs_deepest_xz_f(&staticSet, c->capA, c->capB, c->radius, &contact);
+        });
+
+        // Reference: the per-box kernel over every box, first deepest wins
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            const ObbCase *c = &obbCases[i];
+            bool got = scu_capsule_vs_static_obbs_deepest_xz_f(&staticSet, c->capA, c->capB, c->radius, &contact);
+            int want = -1;
+            float wantDepth = 0.0f, wantPush[3] = { 0 }, wantN[3] = { 0 };
+            for (int b = 0; b < STATIC_SET_BOXES; b++) {
+                float push[3], n[3];
+                if (!scu_capsule_vs_obb_push_xz_f(c->capA, c->capB, c->radius, &staticBoxes[b], push, n)) continue;
+                float depth = sqrtf(push[0] * push[0] + push[2] * push[2]);
+                if (want < 0 || depth > wantDepth) {
+                    want = b;
+                    wantDepth = depth;
+                    memcpy(wantPush, push, sizeof(push));
+                    memcpy(wantN, n, sizeof(n));
+                }
+            }
+            if (want >= 0) r.hits++;
+            if (got != (want >= 0) ||
+                (got && (contact.index != want ||
+                         memcmp(contact.push, wantPush, sizeof(wantPush)) != 0 ||
+                         memcmp(contact.n, wantN, sizeof(wantN)) != 0))) {
+                r.mismatches++;
+            }
+        }
+        kernel_report(&r);
+    }
+
+    if (kernel_selected(opt, "scu_capsule_sweep_static_obbs_xz_f")) {
+        KernelResult r = { .name = "scu_capsule_sweep_static_obbs_xz_f" };
+        float toi, n[3];
+        KERNEL_TIME(opt, r, {
+            const ObbCase *c = &obbCases[i];
+            acc += scu_capsule_sweep_static_obbs_xz_f(&staticSet, c->capA, c->capB, c->radius,
+                sweepMoves[i][0], sweepMoves[i][1], &toi, n);
+            acc += (uint32_t)(int32_t)(toi * 1000.0f);
+        });
+
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            const ObbCase *c = &obbCases[i];
+            bool got = scu_capsule_sweep_static_obbs_xz_f(&staticSet, c->capA, c->capB, c->radius,
+                sweepMoves[i][0], sweepMoves[i][1], &toi, n);
+            bool want = false;
+            float wantToi = 1.0f, wantN[3] = { 0 };
+            for (int b = 0; b < STATIC_SET_BOXES; b++) {
+                float t, bn[3];
+                if (scu_capsule_sweep_obb_xz_f(c->capA, c->capB, c->radius,
+                        sweepMoves[i][0], sweepMoves[i][1], &staticBoxes[b], &t, bn) && t < wantToi) {
+                    wantToi = t;
+                    wantN[0] = bn[0]; wantN[2] = bn[2];
+                    want = true;
+                }
+            }
+            if (want) r.hits++;
+            if (got != want || (want && (toi != wantToi || n[0] != wantN[0] || n[2] != wantN[2]))) {
+                r.mismatches++;
+            }
+        }
+        kernel_report(&r);
+    }
+}
+
+/* ------------------------------------------------------------------
+ * mat4fp transforms
+ * ------------------------------------------------------------------ */
+
+typedef struct {
+    T3DMat4FP mat;
+    float in[3];
+} MatCase;
+
+static MatCase matCases[KERNEL_CASES];
+
+static void mat_cases_init(void)
+{
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        // Bone/model-like matrices: rotation, mild scale, room-sized offset
+        float scale = case_randf(0.25f, 2.0f);
+        float s[3] = { scale, scale, scale };
+        float rot[3] = { case_randf(-T3D_PI, T3D_PI), case_randf(-T3D_PI, T3D_PI), case_randf(-T3D_PI, T3D_PI) };
+        float pos[3];
+        case_rand_vec3(pos, 500.0f);
+        t3d_mat4fp_from_srt_euler(&matCases[i].mat, s, rot, pos);
+        case_rand_vec3(matCases[i].in, 100.0f);
+    }
+}
+
+// Exact decode of one 16.16 element.
+static double ref_mat4fp_elem(const T3DMat4FP *m, int r, int c)
+{
+    return (double)m->m[r].i[c] + (double)m->m[r].f[c] / 65536.0;
+}
+
+static void ref_mat4fp_mul(const T3DMat4FP *m, const float in[3], bool withTranslation, double out[3])
+{
+    for (int c = 0; c < 3; c++) {
+        out[c] = ref_mat4fp_elem(m, 0, c) * in[0] + ref_mat4fp_elem(m, 1, c) * in[1] + ref_mat4fp_elem(m, 2, c) * in[2];
+        if (withTranslation) out[c] += ref_mat4fp_elem(m, 3, c);
+    }
+}
+
+// Worst error relative to the output magnitude (float keeps ~24 bits).
+static double vec3_rel_err(const float got[3], const double want[3])
+{
+    double mag = fmax(1.0, fmax(fabs(want[0]), fmax(fabs(want[1]), fabs(want[2]))));
+    double err = 0.0;
+    for (int k = 0; k < 3; k++) err = fmax(err, fabs(got[k] - want[k]) / mag);
+    return err;
+}
+
+static void bench_mat4fp(const KernelOptions *opt)
+{
+    const double tol = 1e-5;
+    float out[3];
+
+    if (kernel_selected(opt, "mat4fp_mul_point_f32_row3_colbasis")) {
+        KernelResult r = { .name = "mat4fp_mul_point_f32_row3_colbasis" };
+        KERNEL_TIME(opt, r, {
+            mat4fp_mul_point_f32_row3_colbasis(&matCases[i].mat, matCases[i].in, out);
+            acc += (uint32_t)(int32_t)out[0];
+        });
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            double want[3];
+            ref_mat4fp_mul(&matCases[i].mat, matCases[i].in, true, want);
+            mat4fp_mul_point_f32_row3_colbasis(&matCases[i].mat, matCases[i].in, out);
+            double err = vec3_rel_err(out, want);
+            r.maxErr = fmax(r.maxErr, err);
+            if (err > tol) r.mismatches++;
+        }
+        kernel_report(&r);
+    }
+
+    if (kernel_selected(opt, "mat4fp_mul_dir_f32_colbasis")) {
+        KernelResult r = { .name = "mat4fp_mul_dir_f32_colbasis" };
+        KERNEL_TIME(opt, r, {
+            mat4fp_mul_dir_f32_colbasis(&matCases[i].mat, matCases[i].in, out);
+            acc += (uint32_t)(int32_t)out[0];
+        });
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            double want[3];
+            ref_mat4fp_mul(&matCases[i].mat, matCases[i].in, false, want);
+            mat4fp_mul_dir_f32_colbasis(&matCases[i].mat, matCases[i].in, out);
+            double err = vec3_rel_err(out, want);
+            r.maxErr = fmax(r.maxErr, err);
+            if (err > tol) r.mismatches++;
+        }
+        kernel_report(&r);
+    }
+
+    if (kernel_selected(opt, "mat4fp_get_translation_row3_f32")) {
+        KernelResult r = { .name = "mat4fp_get_translation_row3_f32" };
+        KERNEL_TIME(opt, r, {
+            mat4fp_get_translation_row3_f32(&matCases[i].mat, out);
+            acc += (uint32_t)(int32_t)out[0];
+        });
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            double want[3] = {
+                ref_mat4fp_elem(&matCases[i].mat, 3, 0),
+                ref_mat4fp_elem(&matCases[i].mat, 3, 1),
+                ref_mat4fp_elem(&matCases[i].mat, 3, 2),
+            };
+            mat4fp_get_translation_row3_f32(&matCases[i].mat, out);
+            double err = vec3_rel_err(out, want);
+            r.maxErr = fmax(r.maxErr, err);
+            if (err > tol) r.mismatches++;
+        }
+        kernel_report(&r);
+    }
+
+    if (kernel_selected(opt, "mat4fp_get_axis_colbasis_f32")) {
+        KernelResult r = { .name = "mat4fp_get_axis_colbasis_f32" };
+        KERNEL_TIME(opt, r, {
+            mat4fp_get_axis_colbasis_f32(&matCases[i].mat, i % 3, out);
+            acc += (uint32_t)(int32_t)(out[0] * 1024.0f);
+        });
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            int axis = i % 3;
+            double want[3] = {
+                ref_mat4fp_elem(&matCases[i].mat, 0, axis),
+                ref_mat4fp_elem(&matCases[i].mat, 1, axis),
+                ref_mat4fp_elem(&matCases[i].mat, 2, axis),
+            };
+            mat4fp_get_axis_colbasis_f32(&matCases[i].mat, axis, out);
+            double err = vec3_rel_err(out, want);
+            r.maxErr = fmax(r.maxErr, err);
+            if (err > tol) r.mismatches++;
+        }
+        kernel_report(&r);
+    }
+}
+
+// Batched point transforms: each case pushes MAT_BATCH_POINTS points (the
+// next cases' inputs) through its matrix. Reported per point, so the numbers
+// compare directly with mat4fp_mul_point_f32_row3_colbasis above.
+#define MAT_BATCH_POINTS 16
+
+static float batchIn[KERNEL_CASES + MAT_BATCH_POINTS][3];
+
+static void bench_mat4fp_batch(const KernelOptions *opt)
+{
+    const double tol = 1e-5;
+    static float out[MAT_BATCH_POINTS][3];
+
+    for (int i = 0; i < KERNEL_CASES + MAT_BATCH_POINTS; i++) {
+        memcpy(batchIn[i], matCases[i % KERNEL_CASES].in, sizeof(batchIn[i]));
+    }
+
+    if (kernel_selected(opt, "mat4fp_mul_points_f32_row3_colbasis")) {
+        // Decode + transform in one call
+        KernelResult r = { .name = "mat4fp_mul_points_f32_row3_colbasis" };
+        KERNEL_TIME(opt, r, {
+            mat4fp_mul_points_f32_row3_colbasis(&matCases[i].mat, (const float (*)[3])batchIn[i], out, MAT_BATCH_POINTS);
+            acc += (uint32_t)(int32_t)out[MAT_BATCH_POINTS - 1][0];
+        });
+        r.nsPerQuery /= MAT_BATCH_POINTS;
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            mat4fp_mul_points_f32_row3_colbasis(&matCases[i].mat, (const float (*)[3])batchIn[i], out, MAT_BATCH_POINTS);
+            for (int k = 0; k < MAT_BATCH_POINTS; k++) {
+                double want[3];
+                ref_mat4fp_mul(&matCases[i].mat, batchIn[i + k], true, want);
+                double err = vec3_rel_err(out[k], want);
+                r.maxErr = fmax(r.maxErr, err);
+                if (err > tol) r.mismatches++;
+            }
+        }
+        kernel_report(&r);
+    }
+
+    if (kernel_selected(opt, "mat43_mul_points_f32")) {
+        // Matrix decoded ahead of time (the bone cache's case)
+        static float decoded[KERNEL_CASES][4][3];
+        for (int i = 0; i < KERNEL_CASES; i++) mat4fp_to_f32_row3(&matCases[i].mat, decoded[i]);
+
+        KernelResult r = { .name = "mat43_mul_points_f32" };
+        KERNEL_TIME(opt, r, {
+            mat43_mul_points_f32(decoded[i], (const float (*)[3])batchIn[i], out, MAT_BATCH_POINTS);
+            acc += (uint32_t)(int32_t)out[MAT_BATCH_POINTS - 1][0];
+        });
+        r.nsPerQuery /= MAT_BATCH_POINTS;
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            mat43_mul_points_f32(decoded[i], (const float (*)[3])batchIn[i], out, MAT_BATCH_POINTS);
+            for (int k = 0; k < MAT_BATCH_POINTS; k++) {
+                double want[3];
+                ref_mat4fp_mul(&matCases[i].mat, batchIn[i + k], true, want);
+                double err = vec3_rel_err(out[k], want);
+                r.maxErr = fmax(r.maxErr, err);
+                if (err > tol) r.mismatches++;
+            }
+        }
+        kernel_report(&r);
+    }
+
+    if (kernel_selected(opt, "mat43_mul_dirs_f32")) {
+        static float decoded[KERNEL_CASES][4][3];
+        for (int i = 0; i < KERNEL_CASES; i++) mat4fp_to_f32_row3(&matCases[i].mat, decoded[i]);
+
+        KernelResult r = { .name = "mat43_mul_dirs_f32" };
+        KERNEL_TIME(opt, r, {
+            mat43_mul_dirs_f32(decoded[i], (const float (*)[3])batchIn[i], out, MAT_BATCH_POINTS);
+            acc += (uint32_t)(int32_t)out[MAT_BATCH_POINTS - 1][0];
+        });
+        r.nsPerQuery /= MAT_BATCH_POINTS;
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            mat43_mul_dirs_f32(decoded[i], (const float (*)[3])batchIn[i], out, MAT_BATCH_POINTS);
+            for (int k = 0; k < MAT_BATCH_POINTS; k++) {
+                double want[3];
+                ref_mat4fp_mul(&matCases[i].mat, batchIn[i + k], false, want);
+                double err = vec3_rel_err(out[k], want);
+                r.maxErr = fmax(r.maxErr, err);
+                if (err > tol) r.mismatches++;
+            }
+        }
+        kernel_report(&r);
+    }
+
+    if (kernel_selected(opt, "mat43_mul_points_fixed")) {
+        static int32_t decoded[KERNEL_CASES][4][3];
+        static FixedVec3 fixedIn[KERNEL_CASES + MAT_BATCH_POINTS];
+        static FixedVec3 fixedOut[MAT_BATCH_POINTS];
+        for (int i = 0; i < KERNEL_CASES; i++) mat4fp_to_fixed_row3(&matCases[i].mat, decoded[i]);
+        for (int i = 0; i < KERNEL_CASES + MAT_BATCH_POINTS; i++) {
+            for (int k = 0; k < 3; k++) fixedIn[i].v[k] = TO_FIXED(batchIn[i][k]);
+        }
+
+        KernelResult r = { .name = "mat43_mul_points_fixed" };
+        KERNEL_TIME(opt, r, {
+            mat43_mul_points_fixed(decoded[i], &fixedIn[i], fixedOut, MAT_BATCH_POINTS);
+            acc += (uint32_t)fixedOut[MAT_BATCH_POINTS - 1].v[0];
+        });
+        r.nsPerQuery /= MAT_BATCH_POINTS;
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            mat43_mul_points_fixed(decoded[i], &fixedIn[i], fixedOut, MAT_BATCH_POINTS);
+            for (int k = 0; k < MAT_BATCH_POINTS; k++) {
+                double want[3];
+                ref_mat4fp_mul(&matCases[i].mat, batchIn[i + k], true, want);
+                float got[3] = { FROM_FIXED(fixedOut[k].v[0]), FROM_FIXED(fixedOut[k].v[1]), FROM_FIXED(fixedOut[k].v[2]) };
+                double err = vec3_rel_err(got, want);
+                r.maxErr = fmax(r.maxErr, err);
+                if (err > tol) r.mismatches++;
+            }
+        }
+        kernel_report(&r);
+    }
+}
+
+// Bone cache: case i uses matrix i as the bone and matrix i+1 as the model.
+// "cold" invalidates before every query (one decode + compose per bone),
+// "cached" reads an already composed bone, the common case once several
+// systems ask for the same bone in a frame.
+static T3DMat4FP boneMats[KERNEL_CASES];
+
+static void bench_bone_cache(const KernelOptions *opt)
+{
+    const double tol = 1e-5;
+    const float len = 640.0f;
+
+    for (int i = 0; i < KERNEL_CASES; i++) boneMats[i] = matCases[i].mat;
+    T3DSkeleton skel = { .boneMatricesFP = boneMats };
+
+    static const char *names[2] = { "bone_cache_world_segment_cold", "bone_cache_world_segment_cached" };
+    for (int cached = 0; cached < 2; cached++) {
+        if (!kernel_selected(opt, names[cached])) continue;
+
+        KernelResult r = { .name = names[cached] };
+        BoneCache cache;
+        bone_cache_reset(&cache);
+        float base[3], tip[3];
+        const T3DMat4FP *model = &matCases[0].mat;
+        KERNEL_TIME(opt, r, {
+            int bone = cached ? 0 : i;
+            if (!cached) bone_cache_invalidate(&cache);
+            acc += bone_cache_world_segment(&cache, &skel, model, bone, len, base, tip);
+            acc += (uint32_t)(int32_t)tip[0];
+        });
+
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            const T3DMat4FP *m = &matCases[(i + 1) % KERNEL_CASES].mat;
+            bone_cache_invalidate(&cache);
+            bone_cache_world_segment(&cache, &skel, m, i, len, base, tip);
+
+            // Two-step reference: bone-local -> model -> world
+            const float local[2][3] = { { 0.0f, 0.0f, 0.0f }, { -len, 0.0f, 0.0f } };
+            const float *got[2] = { base, tip };
+            for (int e = 0; e < 2; e++) {
+                double modelPt[3], want[3];
+                ref_mat4fp_mul(&boneMats[i], local[e], true, modelPt);
+                float modelPtF[3] = { (float)modelPt[0], (float)modelPt[1], (float)modelPt[2] };
+                ref_mat4fp_mul(m, modelPtF, true, want);
+                double err = vec3_rel_err(got[e], want);
+                r.maxErr = fmax(r.maxErr, err);
+                if (err > tol) r.mismatches++;
+            }
+        }
+        kernel_report(&r);
+    }
+}
+
+/* ------------------------------------------------------------------
+ * Pose blending
+ * ------------------------------------------------------------------ */
+
+// Poses come from a small pool of random skeletons (even ones at unit
+// scale, odd ones scaled) captured into the quantized AnimPose format.
+// "roundtrip" captures and applies back: positions and scales must land
+// within half a quantization step, rotation components within POSE_ROT_TOL
+// (max_err is the worst of those). "3way" blends three snapshots with
+// case i's own weights (timed per bone); its reference sums the decoded
+// snapshots in double on the same hemisphere rule.
+#define POSE_POOL 16
+#define POSE_BLEND_INPUTS 3
+#define POSE_ROT_TOL 1e-4   // per component; 15-bit steps are ~4.3e-5
+
+static T3DSkeleton poseSkels[POSE_POOL];
+static AnimPose posePool[POSE_POOL];
+static float poseWeights[KERNEL_CASES][POSE_BLEND_INPUTS];
+
+static void pose_cases_init(void)
+{
+    for (int p = 0; p < POSE_POOL; p++) {
+        poseSkels[p] = t3d_skeleton_create(NULL);
+        for (int b = 0; b < HOST_SKELETON_BONES; b++) {
+            T3DBone *bone = &poseSkels[p].bones[b];
+            case_rand_vec3(bone->position.v, CASE_EXTENT);
+            for (int k = 0; k < 3; k++) bone->scale.v[k] = (p & 1) ? case_randf(0.5f, 1.5f) : 1.0f;
+            float len2 = 0.0f;
+            for (int k = 0; k < 4; k++) { bone->rotation.v[k] = case_randf(-1.0f, 1.0f); len2 += bone->rotation.v[k] * bone->rotation.v[k]; }
+            float inv = 1.0f / sqrtf(fmaxf(len2, 1e-6f));
+            for (int k = 0; k < 4; k++) bone->rotation.v[k] *= inv;
+        }
+        anim_pose_capture(&posePool[p], &poseSkels[p]);
+    }
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        for (int n = 0; n < POSE_BLEND_INPUTS; n++) poseWeights[i][n] = case_randf(0.05f, 1.0f);
+    }
+}
+
+// Largest component error after picking the sign (q and -q are the same rotation)
+static double quat_component_err(const T3DQuat *got, const T3DQuat *want)
+{
+    double dot = 0.0;
+    for (int k = 0; k < 4; k++) dot += (double)got->v[k] * want->v[k];
+    double sign = dot < 0.0 ? -1.0 : 1.0;
+    double err = 0.0;
+    for (int k = 0; k < 4; k++) err = fmax(err, fabs(got->v[k] * sign - want->v[k]));
+    return err;
+}
+
+static bool vec3_within_steps(const T3DVec3 *got, const T3DVec3 *want, const float step[3])
+{
+    for (int k = 0; k < 3; k++) {
+        // half a step, plus float rounding across the captured range
+        double slack = 4.0 * FLT_EPSILON * (fabs(want->v[k]) + 65535.0 * step[k]);
+        if (fabs((double)got->v[k] - want->v[k]) > 0.5 * step[k] + slack) return false;
+    }
+    return true;
+}
+
+static void bench_pose_blend(const KernelOptions *opt)
+{
+    T3DSkeleton skel = t3d_skeleton_create(NULL);
+
+    if (kernel_selected(opt, "anim_pose_roundtrip")) {
+        static AnimPose pose;
+        KernelResult r = { .name = "anim_pose_roundtrip" };
+        KERNEL_TIME(opt, r, {
+            anim_pose_capture(&pose, &poseSkels[i % POSE_POOL]);
+            anim_pose_apply(&pose, &skel);
+            acc += (uint32_t)(int32_t)skel.bones[i % HOST_SKELETON_BONES].position.v[0];
+        });
+        r.nsPerQuery /= HOST_SKELETON_BONES;
+
+        for (int p = 0; p < POSE_POOL; p++) {
+            anim_pose_capture(&pose, &poseSkels[p]);
+            anim_pose_apply(&pose, &skel);
+            if (((pose.flags & ANIM_POSE_UNIT_SCALE) != 0) != ((p & 1) == 0)) r.mismatches++;
+            for (int b = 0; b < HOST_SKELETON_BONES; b++) {
+                const T3DBone *want = &poseSkels[p].bones[b];
+                const T3DBone *got = &skel.bones[b];
+                double err = quat_component_err(&got->rotation, &want->rotation);
+                r.maxErr = fmax(r.maxErr, err);
+                if (err > POSE_ROT_TOL) r.mismatches++;
+                if (!vec3_within_steps(&got->position, &want->position, pose.posStep)) r.mismatches++;
+                bool unit = pose.flags & ANIM_POSE_UNIT_SCALE;
+                if (!vec3_within_steps(&got->scale, &want->scale, unit ? (float[3]){0} : pose.sclStep)) r.mismatches++;
+            }
+        }
+        kernel_report(&r);
+    }
+
+    if (kernel_selected(opt, "pose_blend_3way")) {
+        const double tol = 1e-5;
+        KernelResult r = { .name = "pose_blend_3way" };
+        KERNEL_TIME(opt, r, {
+            pose_blend_begin(&skel);
+            for (int n = 0; n < POSE_BLEND_INPUTS; n++) {
+                pose_blend_pose(&posePool[(i + n) % POSE_POOL], poseWeights[i][n]);
+            }
+            acc += pose_blend_end();
+            acc += (uint32_t)(int32_t)skel.bones[i % HOST_SKELETON_BONES].position.v[0];
+        });
+        r.nsPerQuery /= HOST_SKELETON_BONES;
+
+        // Decoded snapshots for the reference
+        static T3DSkeleton decoded[POSE_POOL];
+        for (int p = 0; p < POSE_POOL; p++) {
+            decoded[p] = t3d_skeleton_create(NULL);
+            anim_pose_apply(&posePool[p], &decoded[p]);
+        }
+
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            pose_blend_begin(&skel);
+            for (int n = 0; n < POSE_BLEND_INPUTS; n++) {
+                pose_blend_pose(&posePool[(i + n) % POSE_POOL], poseWeights[i][n]);
+            }
+            pose_blend_end();
+
+            for (int b = 0; b < HOST_SKELETON_BONES; b++) {
+                double pos[3] = {0}, scl[3] = {0}, rot[4] = {0}, wsum = 0.0;
+                for (int n = 0; n < POSE_BLEND_INPUTS; n++) {
+                    const T3DBone *in = &decoded[(i + n) % POSE_POOL].bones[b];
+                    double w = poseWeights[i][n];
+                    double dot = 0.0;
+                    for (int k = 0; k < 4; k++) dot += rot[k] * in->rotation.v[k];
+                    double wq = dot < 0.0 ? -w : w;
+                    for (int k = 0; k < 4; k++) rot[k] += in->rotation.v[k] * wq;
+                    for (int k = 0; k < 3; k++) {
+                        pos[k] += in->position.v[k] * w;
+                        scl[k] += in->scale.v[k] * w;
+                    }
+                    wsum += w;
+                }
+                double len = sqrt(rot[0] * rot[0] + rot[1] * rot[1] + rot[2] * rot[2] + rot[3] * rot[3]);
+                for (int k = 0; k < 3; k++) { pos[k] /= wsum; scl[k] /= wsum; }
+
+                const T3DBone *got = &skel.bones[b];
+                double err = fmax(vec3_rel_err(got->position.v, pos), vec3_rel_err(got->scale.v, scl));
+                for (int k = 0; k < 4; k++) err = fmax(err, fabs(got->rotation.v[k] - rot[k] / len));
+                r.maxErr = fmax(r.maxErr, err);
+                if (err > tol) r.mismatches++;
+            }
+        }
+        for (int p = 0; p < POSE_POOL; p++) t3d_skeleton_destroy(&decoded[p]);
+        kernel_report(&r);
+    }
+
+    t3d_skeleton_destroy(&skel);
+}
+
+/* ------------------------------------------------------------------
+ * Fixed-point vector helpers
+ * ------------------------------------------------------------------ */
+
+typedef struct {
+    FixedVec3 a, b;
+} FixedCase;
+
+static FixedCase fixedCases[KERNEL_CASES];
+
+static void fixed_cases_init(void)
+{
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        // Keep |v| small enough that FIXED_MUL products fit in int32 (cross)
+        for (int k = 0; k < 3; k++) {
+            fixedCases[i].a.v[k] = TO_FIXED(case_randf(-100.0f, 100.0f));
+            fixedCases[i].b.v[k] = TO_FIXED(case_randf(-100.0f, 100.0f));
+        }
+    }
+}
+
+static double fx(int32_t v)
+{
+    return (double)v / FIXED_ONE;
+}
+
+static void bench_fixed(const KernelOptions *opt)
+{
+    FixedVec3 out;
+
+    if (kernel_selected(opt, "vec3_dot_fixed")) {
+        KernelResult r = { .name = "vec3_dot_fixed" };
+        KERNEL_TIME(opt, r, acc += (uint32_t)vec3_dot_fixed(&fixedCases[i].a, &fixedCases[i].b));
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            const FixedCase *c = &fixedCases[i];
+            double want = fx(c->a.v[0]) * fx(c->b.v[0]) + fx(c->a.v[1]) * fx(c->b.v[1]) + fx(c->a.v[2]) * fx(c->b.v[2]);
+            double err = fabs((double)vec3_dot_fixed(&c->a, &c->b) / FIXED_ONE - want);
+            r.maxErr = fmax(r.maxErr, err);
+            if (err > 1e-4) r.mismatches++;
+        }
+        kernel_report(&r);
+    }
+
+    if (kernel_selected(opt, "vec3_cross_fixed")) {
+        KernelResult r = { .name = "vec3_cross_fixed" };
+        KERNEL_TIME(opt, r, {
+            vec3_cross_fixed(&out, &fixedCases[i].a, &fixedCases[i].b);
+            acc += (uint32_t)out.v[0];
+        });
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            const FixedCase *c = &fixedCases[i];
+            double a[3] = { fx(c->a.v[0]), fx(c->a.v[1]), fx(c->a.v[2]) };
+            double b[3] = { fx(c->b.v[0]), fx(c->b.v[1]), fx(c->b.v[2]) };
+            double want[3] = { a[1]*b[2] - a[2]*b[1], a[2]*b[0] - a[0]*b[2], a[0]*b[1] - a[1]*b[0] };
+            vec3_cross_fixed(&out, &c->a, &c->b);
+            double err = 0.0;
+            for (int k = 0; k < 3; k++) err = fmax(err, fabs(fx(out.v[k]) - want[k]));
+            r.maxErr = fmax(r.maxErr, err);
+            if (err > 1e-4) r.mismatches++;
+        }
+        kernel_report(&r);
+    }
+
+    if (kernel_selected(opt, "vec3_dist_squared_fixed")) {
+        KernelResult r = { .name = "vec3_dist_squared_fixed" };
+        KERNEL_TIME(opt, r, acc += (uint32_t)vec3_dist_squared_fixed(&fixedCases[i].a, &fixedCases[i].b));
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            const FixedCase *c = &fixedCases[i];
+            double want = 0.0;
+            for (int k = 0; k < 3; k++) {
+                double d = fx(c->a.v[k]) - fx(c->b.v[k]);
+                want += d * d;
+            }
+            double got = (double)vec3_dist_squared_fixed(&c->a, &c->b) / FIXED_ONE;
+            double err = fabs(got - want);
+            r.maxErr = fmax(r.maxErr, err);
+            if (err > 1e-4) r.mismatches++;
+        }
+        kernel_report(&r);
+    }
+
+    if (kernel_selected(opt, "vec3_normalize_fixed")) {
+        KernelResult r = { .name = "vec3_normalize_fixed" };
+        KERNEL_TIME(opt, r, {
+            vec3_normalize_fixed(&out, &fixedCases[i].a);
+            acc += (uint32_t)out.v[0];
+        });
+        for (int i = 0; i < KERNEL_CASES; i++) {
+            const FixedCase *c = &fixedCases[i];
+            double a[3] = { fx(c->a.v[0]), fx(c->a.v[1]), fx(c->a.v[2]) };
+            double len = sqrt(a[0]*a[0] + a[1]*a[1] + a[2]*a[2]);
+            vec3_normalize_fixed(&out, &c->a);
+            double err = 0.0;
+            for (int k = 0; k < 3; k++) err = fmax(err, fabs(fx(out.v[k]) - a[k] / len));
+            r.maxErr = fmax(r.maxErr, err);
+            // game_math_isqrt64 only keeps 8 fractional bits of the length
+            if (err > 1e-2) r.mismatches++;
+        }
+        kernel_report(&r);
+    }
+}
+
+/* ------------------------------------------------------------------
+ * collision_mesh
+ * ------------------------------------------------------------------ */
+
+typedef struct {
+    double v[ROOM_SIDES * 2][3];
+    int tris[ROOM_SIDES * 4][3];
+    ColliderType types[ROOM_SIDES * 4];
+    int triCount;
+} RefRoom;
+
+static RefRoom refRoom;
+
+typedef struct {
+    float pos[3];
+    float ay, by, radius;
+} MeshCase;
+
+static MeshCase meshCases[KERNEL_CASES];
+
+static void ref_room_plane(const int t[3], double plane[4])
+{
+    const double *a = refRoom.v[t[0]], *b = refRoom.v[t[1]], *c = refRoom.v[t[2]];
+    double e1[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+    double e2[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+    double n[3] = { e1[1]*e2[2] - e1[2]*e2[1], e1[2]*e2[0] - e1[0]*e2[2], e1[0]*e2[1] - e1[1]*e2[0] };
+    double len = sqrt(ref_dot(n, n));
+    for (int k = 0; k < 3; k++) plane[k] = n[k] / len;
+    plane[3] = -ref_dot(plane, a);
+}
+
+static void ref_room_add_tri(int a, int b, int c, ColliderType type)
+{
+    int *t = refRoom.tris[refRoom.triCount];
+    t[0] = a; t[1] = b; t[2] = c;
+
+    // The loader flips planes so the room interior is on the negative side;
+    // add_poly doesn't, so wind every triangle outward up front instead.
+    double plane[4];
+    ref_room_plane(t, plane);
+    double centerDist = plane[1] * (ROOM_HEIGHT * 0.5) + plane[3];
+    if (centerDist > 0.0) { t[1] = c; t[2] = b; }
+
+    refRoom.types[refRoom.triCount++] = type;
+}
+
+// Closed N-gon prism: wall quads plus floor/ceiling fans.
+static void mesh_room_init(void)
+{
+    collision_mesh_cleanup();
+    collision_mesh_set_transform(1.0f, 0.0f, 0.0f, 0.0f);
+    memset(&refRoom, 0, sizeof(refRoom));
+
+    for (int s = 0; s < ROOM_SIDES; s++) {
+        float ang = (2.0f * T3D_PI * s) / ROOM_SIDES;
+        float x = ROOM_RADIUS * cosf(ang), z = ROOM_RADIUS * sinf(ang);
+        collision_mesh_add_vertex(x, 0.0f, z);
+        collision_mesh_add_vertex(x, ROOM_HEIGHT, z);
+        refRoom.v[s * 2][0] = x; refRoom.v[s * 2][1] = 0.0;         refRoom.v[s * 2][2] = z;
+        refRoom.v[s * 2 + 1][0] = x; refRoom.v[s * 2 + 1][1] = ROOM_HEIGHT; refRoom.v[s * 2 + 1][2] = z;
+    }
+    for (int s = 0; s < ROOM_SIDES; s++) {
+        int n = (s + 1) % ROOM_SIDES;
+        ref_room_add_tri(s * 2, n * 2, s * 2 + 1, COLLIDER_WALL);
+        ref_room_add_tri(n * 2, n * 2 + 1, s * 2 + 1, COLLIDER_WALL);
+        if (s > 0 && n > 0) {
+            ref_room_add_tri(0, s * 2, n * 2, COLLIDER_FLOOR);
+            ref_room_add_tri(1, s * 2 + 1, n * 2 + 1, COLLIDER_CEILING);
+        }
+    }
+    for (int t = 0; t < refRoom.triCount; t++) {
+        collision_mesh_add_poly(refRoom.tris[t][0], refRoom.tris[t][1], refRoom.tris[t][2], refRoom.types[t]);
+    }
+    collision_mesh_build_grid();
+
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        MeshCase *c = &meshCases[i];
+        // Mostly inside, with a band around the walls where the verdict flips
+        float ang = case_randf(-T3D_PI, T3D_PI);
+        float dist = case_randf(0.0f, ROOM_RADIUS * 1.1f);
+        c->pos[0] = dist * cosf(ang);
+        c->pos[1] = case_randf(0.0f, ROOM_HEIGHT * 0.5f);
+        c->pos[2] = dist * sinf(ang);
+        c->radius = case_randf(5.0f, 25.0f);
+        c->ay = c->radius;
+        c->by = c->ay + case_randf(10.0f, 60.0f);
+    }
+}
+
+static bool ref_mesh_check_capsule(const MeshCase *c, double *margin)
+{
+    *margin = INFINITY;
+    bool hit = false;
+    for (int t = 0; t < refRoom.triCount; t++) {
+        if (refRoom.types[t] != COLLIDER_WALL) continue;
+        double plane[4];
+        ref_room_plane(refRoom.tris[t], plane);
+        double a[3] = { c->pos[0], (double)c->pos[1] + c->ay, c->pos[2] };
+        double b[3] = { c->pos[0], (double)c->pos[1] + c->by, c->pos[2] };
+        double d = fmax(ref_dot(plane, a), ref_dot(plane, b)) + plane[3] - c->radius;
+        *margin = fmin(*margin, fabs(d));
+        if (d > 0.0) hit = true;
+    }
+    return hit;
+}
+
+static void bench_collision_mesh(const KernelOptions *opt)
+{
+    if (!kernel_selected(opt, "collision_mesh_check_bounds_capsule")) return;
+
+    KernelResult r = { .name = "collision_mesh_check_bounds_capsule" };
+    KERNEL_TIME(opt, r, {
+        const MeshCase *c = &meshCases[i];
+        acc += collision_mesh_check_bounds_capsule(c->pos[0], c->pos[1], c->pos[2],
+            0.0f, c->ay, 0.0f, 0.0f, c->by, 0.0f, c->radius, 1.0f);
+    });
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        const MeshCase *c = &meshCases[i];
+        double margin;
+        bool want = ref_mesh_check_capsule(c, &margin);
+        bool got = collision_mesh_check_bounds_capsule(c->pos[0], c->pos[1], c->pos[2],
+            0.0f, c->ay, 0.0f, 0.0f, c->by, 0.0f, c->radius, 1.0f);
+        kernel_check_bool(&r, got, want, margin, 1e-3);
+    }
+    kernel_report(&r);
+    printf("@KERNEL_MESH polys=%d walls=%d verts=%d\n",
+        collision_mesh_get_poly_count(), ROOM_SIDES * 2, collision_mesh_get_vertex_count());
+}
+
+// Every wall, no grid: the first time max(distA, distB) reaches the radius.
+static bool ref_mesh_sweep_capsule(const MeshCase *c, const float move[2], double *toi, double n[3], double *margin)
+{
+    *margin = INFINITY;
+    *toi = 1.0;
+    n[0] = n[1] = n[2] = 0.0;
+    bool hit = false;
+    double len = sqrt((double)move[0] * move[0] + (double)move[1] * move[1]);
+    for (int t = 0; t < refRoom.triCount; t++) {
+        if (refRoom.types[t] != COLLIDER_WALL) continue;
+        double plane[4];
+        ref_room_plane(refRoom.tris[t], plane);
+        double a[3] = { c->pos[0], (double)c->pos[1] + c->ay, c->pos[2] };
+        double b[3] = { c->pos[0], (double)c->pos[1] + c->by, c->pos[2] };
+        double d0 = fmax(ref_dot(plane, a), ref_dot(plane, b)) + plane[3] - c->radius;
+        double rate = plane[0] * move[0] + plane[2] * move[1];
+        if (rate <= 0.0) {
+            if (d0 > 0.0) *margin = fmin(*margin, fabs(rate) / (len + 1e-9));
+            continue;
+        }
+        double tt = (d0 > 0.0) ? 0.0 : -d0 / rate;
+        // Contacts near the end of the move, and near-ties between walls
+        // (where the normal could go either way) are borderline. Both
+        // triangles of a wall quad share its plane, so they never tie.
+        double h = sqrt(plane[0] * plane[0] + plane[2] * plane[2]);
+        double nx = -plane[0] / h, nz = -plane[2] / h;
+        *margin = fmin(*margin, fabs(tt - 1.0) * len);
+        if (hit && nx * n[0] + nz * n[2] < 1.0 - 1e-9) *margin = fmin(*margin, fabs(tt - *toi) * len);
+        if (tt >= 1.0 || tt >= *toi) continue;
+        *toi = tt;
+        n[0] = nx; n[2] = nz;
+        hit = true;
+    }
+    return hit;
+}
+
+static void bench_collision_mesh_sweep(const KernelOptions *opt)
+{
+    if (!kernel_selected(opt, "collision_mesh_sweep_capsule")) return;
+
+    KernelResult r = { .name = "collision_mesh_sweep_capsule" };
+    float toi, n[3];
+    static float capA[KERNEL_CASES][3], capB[KERNEL_CASES][3];
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        const MeshCase *c = &meshCases[i];
+        capA[i][0] = capB[i][0] = c->pos[0];
+        capA[i][2] = capB[i][2] = c->pos[2];
+        capA[i][1] = c->pos[1] + c->ay;
+        capB[i][1] = c->pos[1] + c->by;
+    }
+    KERNEL_TIME(opt, r, acc += collision_mesh_sweep_capsule(capA[i], capB[i], meshCases[i].radius,
+        sweepMoves[i][0], sweepMoves[i][1], &toi, n));
+
+    const double tol = 1e-3;
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        const MeshCase *c = &meshCases[i];
+        double refToi, refN[3], margin;
+        bool want = ref_mesh_sweep_capsule(c, sweepMoves[i], &refToi, refN, &margin);
+        bool got = collision_mesh_sweep_capsule(capA[i], capB[i], c->radius, sweepMoves[i][0], sweepMoves[i][1], &toi, n);
+        if (want) r.hits++;
+        if (margin <= tol) {
+            if (got != want) r.borderline++;
+            continue;
+        }
+        if (got != want) {
+            r.mismatches++;
+            continue;
+        }
+        if (!want) continue;
+        double len = sqrt((double)sweepMoves[i][0] * sweepMoves[i][0] + (double)sweepMoves[i][1] * sweepMoves[i][1]);
+        double err = fabs(toi - refToi) * len;
+        for (int k = 0; k < 3; k++) {
+            err = fmax(err, fabs(n[k] - refN[k]));
+        }
+        r.maxErr = fmax(r.maxErr, err);
+        if (err > tol) r.mismatches++;
+    }
+    kernel_report(&r);
+}
+
+// Segments from each capsule base to a random point around the room, up to
+// half the radius past the walls and above the ceiling/below the floor (only
+// walls count). Every wall in double is the reference.
+static float meshRayFrom[KERNEL_CASES][3];
+static float meshRayTo[KERNEL_CASES][3];
+
+static void mesh_ray_cases_init(void)
+{
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        const MeshCase *c = &meshCases[i];
+        meshRayFrom[i][0] = c->pos[0];
+        meshRayFrom[i][1] = c->pos[1] + c->ay;
+        meshRayFrom[i][2] = c->pos[2];
+        float ang = case_randf(-T3D_PI, T3D_PI);
+        float dist = case_randf(0.0f, ROOM_RADIUS * 1.5f);
+        meshRayTo[i][0] = dist * cosf(ang);
+        meshRayTo[i][1] = case_randf(-50.0f, ROOM_HEIGHT + 50.0f);
+        meshRayTo[i][2] = dist * sinf(ang);
+    }
+}
+
+// `margin` (world units): hits near a triangle edge, near the segment end,
+// and near-ties between walls with different normals are borderline.
+static bool ref_mesh_raycast(int i, double *t, double n[3], double *margin)
+{
+    double o[3], d[3];
+    ref_load(o, meshRayFrom[i]);
+    for (int k = 0; k < 3; k++) d[k] = (double)meshRayTo[i][k] - o[k];
+    double len = sqrt(ref_dot(d, d));
+
+    *margin = INFINITY;
+    *t = 1.0;
+    bool hit = false;
+    for (int tri = 0; tri < refRoom.triCount; tri++) {
+        if (refRoom.types[tri] != COLLIDER_WALL) continue;
+        const double *a = refRoom.v[refRoom.tris[tri][0]];
+        const double *b = refRoom.v[refRoom.tris[tri][1]];
+        const double *c = refRoom.v[refRoom.tris[tri][2]];
+        double plane[4];
+        ref_room_plane(refRoom.tris[tri], plane);
+        double da = ref_dot(plane, o) + plane[3];
+        double rate = ref_dot(plane, d);
+        if (fabs(rate) < 1e-12) continue;
+        double tt = -da / rate;
+        if (tt < 0.0 || tt > 1.0) {
+            *margin = fmin(*margin, fmin(fabs(tt), fabs(tt - 1.0)) * len);
+            continue;
+        }
+        // Inside test by the distance from the hit point to each edge line
+        double p[3] = { o[0] + d[0] * tt, o[1] + d[1] * tt, o[2] + d[2] * tt };
+        const double *v[3] = { a, b, c };
+        double edgeDist = INFINITY;
+        bool inside = true;
+        for (int e = 0; e < 3; e++) {
+            const double *p0 = v[e], *p1 = v[(e + 1) % 3];
+            double ed[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+            double pd[3] = { p[0] - p0[0], p[1] - p0[1], p[2] - p0[2] };
+            double cr[3] = { ed[1]*pd[2] - ed[2]*pd[1], ed[2]*pd[0] - ed[0]*pd[2], ed[0]*pd[1] - ed[1]*pd[0] };
+            double side = ref_dot(cr, plane);
+            edgeDist = fmin(edgeDist, fabs(side) / sqrt(ref_dot(ed, ed)));
+            if (side < 0.0) inside = false;
+        }
+        *margin = fmin(*margin, edgeDist);
+        *margin = fmin(*margin, fabs(tt - 1.0) * len);
+        if (!inside) continue;
+
+        double sign = rate > 0.0 ? -1.0 : 1.0;
+        double nn[3] = { plane[0] * sign, plane[1] * sign, plane[2] * sign };
+        if (hit && ref_dot(nn, n) < 1.0 - 1e-9) *margin = fmin(*margin, fabs(tt - *t) * len);
+        if (tt >= *t) continue;
+        *t = tt;
+        n[0] = nn[0]; n[1] = nn[1]; n[2] = nn[2];
+        hit = true;
+    }
+    return hit;
+}
+
+static void bench_collision_mesh_raycast(const KernelOptions *opt)
+{
+    if (!kernel_selected(opt, "collision_mesh_raycast")) return;
+
+    KernelResult r = { .name = "collision_mesh_raycast" };
+    float t = 0.0f, n[3];
+    KERNEL_TIME(opt, r, {
+        acc += collision_mesh_raycast(meshRayFrom[i], meshRayTo[i], &t, n);
+        acc += (uint32_t)(int32_t)(t * 1000.0f);
+    });
+
+    const double tol = 1e-3;
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        double refT, refN[3], margin;
+        bool want = ref_mesh_raycast(i, &refT, refN, &margin);
+        bool got = collision_mesh_raycast(meshRayFrom[i], meshRayTo[i], &t, n);
+        if (want) r.hits++;
+        if (margin <= tol) {
+            if (got != want) r.borderline++;
+            continue;
+        }
+        if (got != want) {
+            r.mismatches++;
+            continue;
+        }
+        if (!want) continue;
+        double len = 0.0;
+        for (int k = 0; k < 3; k++) {
+            double dk = (double)meshRayTo[i][k] - meshRayFrom[i][k];
+            len += dk * dk;
+        }
+        double err = fabs(t - refT) * sqrt(len);
+        for (int k = 0; k < 3; k++) err = fmax(err, fabs(n[k] - refN[k]));
+        r.maxErr = fmax(r.maxErr, err);
+        if (err > tol) r.mismatches++;
+    }
+    kernel_report(&r);
+}
+
+/* ------------------------------------------------------------------
+ * collision_mesh floor height grid
+ * ------------------------------------------------------------------ */
+
+// Ramp with a crease at x = 0 plus a raised plateau over one corner, so the
+// grid has slopes, a fold and a ledge. Crease and ledge sit on grid nodes.
+#define TERRAIN_MAX_TRIS (TERRAIN_QUADS * TERRAIN_QUADS * 2 + 2)
+
+static double terrainTris[TERRAIN_MAX_TRIS][3][3];
+static int terrainTriCount;
+static float floorCases[KERNEL_CASES][3]; // x, z and the query height
+
+static double terrain_ramp_y(double x, double z)
+{
+    return 0.25 * fmax(x, 0.0) + 0.1 * z;
+}
+
+static void terrain_add_tri(const double a[3], const double b[3], const double c[3])
+{
+    double (*t)[3] = terrainTris[terrainTriCount++];
+    for (int k = 0; k < 3; k++) { t[0][k] = a[k]; t[1][k] = b[k]; t[2][k] = c[k]; }
+    int base = collision_mesh_get_vertex_count();
+    for (int v = 0; v < 3; v++) collision_mesh_add_vertex((float)t[v][0], (float)t[v][1], (float)t[v][2]);
+    collision_mesh_add_poly(base, base + 1, base + 2, COLLIDER_FLOOR);
+}
+
+static void terrain_add_quad(double x0, double z0, double x1, double z1, bool plateau)
+{
+    double p[4][3] = { { x0, 0, z0 }, { x1, 0, z0 }, { x1, 0, z1 }, { x0, 0, z1 } };
+    for (int k = 0; k < 4; k++) {
+        p[k][1] = plateau ? TERRAIN_PLATEAU_Y : terrain_ramp_y(p[k][0], p[k][2]);
+    }
+    terrain_add_tri(p[0], p[1], p[2]);
+    terrain_add_tri(p[0], p[2], p[3]);
+}
+
+static void mesh_terrain_init(void)
+{
+    collision_mesh_cleanup();
+    collision_mesh_set_transform(1.0f, 0.0f, 0.0f, 0.0f);
+    terrainTriCount = 0;
+
+    const double step = 2.0 * TERRAIN_RADIUS / TERRAIN_QUADS;
+    for (int qz = 0; qz < TERRAIN_QUADS; qz++) {
+        for (int qx = 0; qx < TERRAIN_QUADS; qx++) {
+            double x0 = -TERRAIN_RADIUS + qx * step, z0 = -TERRAIN_RADIUS + qz * step;
+            terrain_add_quad(x0, z0, x0 + step, z0 + step, false);
+        }
+    }
+    terrain_add_quad(TERRAIN_RADIUS * 0.5, TERRAIN_RADIUS * 0.5, TERRAIN_RADIUS, TERRAIN_RADIUS, true);
+    collision_mesh_build_grid();
+
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        floorCases[i][0] = case_randf(-TERRAIN_RADIUS * 1.1f, TERRAIN_RADIUS * 1.1f);
+        floorCases[i][1] = case_randf(-TERRAIN_RADIUS * 1.1f, TERRAIN_RADIUS * 1.1f);
+        // Half from above everything (the plateau where it is), half from
+        // between the ramp's top and the plateau (the ramp under it)
+        floorCases[i][2] = (i & 1) ? 1000.0f : TERRAIN_UNDER_PLATEAU_Y;
+    }
+}
+
+// Highest triangle under (x, z) not above qy, every triangle tested. margin is
+// the distance to the nearest crease, ledge or border, where the grid may blend.
+static bool ref_floor_at(double x, double z, double qy, double *y, double n[3], double *margin)
+{
+    const double r = TERRAIN_RADIUS, h = TERRAIN_RADIUS * 0.5;
+    double toPlateau = (x >= h && z >= h) ? fmin(x - h, z - h)
+        : sqrt(pow(fmax(h - x, 0.0), 2) + pow(fmax(h - z, 0.0), 2));
+    *margin = fmin(fmin(fabs(x), toPlateau), fmin(fabs(r - fabs(x)), fabs(r - fabs(z))));
+
+    bool hit = false;
+    for (int t = 0; t < terrainTriCount; t++) {
+        const double (*v)[3] = terrainTris[t];
+        double e1[3] = { v[1][0] - v[0][0], v[1][1] - v[0][1], v[1][2] - v[0][2] };
+        double e2[3] = { v[2][0] - v[0][0], v[2][1] - v[0][1], v[2][2] - v[0][2] };
+        double det = e1[0] * e2[2] - e1[2] * e2[0];
+        double dx = x - v[0][0], dz = z - v[0][2];
+        double u = (dx * e2[2] - dz * e2[0]) / det;
+        double w = (e1[0] * dz - e1[2] * dx) / det;
+        if (u < 0.0 || w < 0.0 || u + w > 1.0) continue;
+
+        double ty = v[0][1] + u * e1[1] + w * e2[1];
+        if (ty > qy || (hit && ty <= *y)) continue;
+        double c[3] = { e1[1]*e2[2] - e1[2]*e2[1], e1[2]*e2[0] - e1[0]*e2[2], e1[0]*e2[1] - e1[1]*e2[0] };
+        double len = sqrt(ref_dot(c, c)) * (c[1] < 0.0 ? -1.0 : 1.0);
+        for (int k = 0; k < 3; k++) n[k] = c[k] / len;
+        *y = ty;
+        hit = true;
+    }
+    return hit;
+}
+
+static void bench_collision_mesh_floor(const KernelOptions *opt)
+{
+    if (!kernel_selected(opt, "collision_mesh_floor_at")) return;
+
+    mesh_terrain_init();
+
+    KernelResult r = { .name = "collision_mesh_floor_at" };
+    float y, n[3];
+    KERNEL_TIME(opt, r, {
+        acc += collision_mesh_floor_at(floorCases[i][0], floorCases[i][2], floorCases[i][1], &y, n);
+        acc += (uint32_t)y;
+    });
+
+    const double tol = 2e-2; // normals are stored as int8
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        double refY = 0.0, refN[3], margin;
+        bool want = ref_floor_at(floorCases[i][0], floorCases[i][1], floorCases[i][2], &refY, refN, &margin);
+        bool got = collision_mesh_floor_at(floorCases[i][0], floorCases[i][2], floorCases[i][1], &y, n);
+        bool blended = margin <= TERRAIN_FLOOR_CELL * 1.5; // a cell with a feature on any corner (sqrt 2 diagonal)
+        kernel_check_bool(&r, got, want, blended ? 0.0 : 1.0, 0.5);
+        if (!got || !want) continue;
+
+        double err = fabs(y - refY);
+        for (int k = 0; k < 3; k++) {
+            err = fmax(err, fabs(n[k] - refN[k]));
+        }
+        if (blended) {
+            if (err > tol) r.borderline++;
+            continue;
+        }
+        r.maxErr = fmax(r.maxErr, err);
+        if (err > tol) r.mismatches++;
+    }
+    kernel_report(&r);
+}
+
+/* ------------------------------------------------------------------
+ * Exported room boxes (fixture)
+ * ------------------------------------------------------------------ */
+
+// Distance from (x, z) to a box in model space: center, half extents, and
+// local axes where local (u, w) maps to (u*c + w*s, -u*s + w*c) (the
+// fixture's square() convention).
+static double ref_point_rect_dist_xz(double x, double z, double cx, double cz,
+    double hu, double hw, double yaw)
+{
+    double c = cos(yaw), s = sin(yaw);
+    double dx = x - cx, dz = z - cz;
+    double u = fabs(dx * c - dz * s) - hu;
+    double w = fabs(dx * s + dz * c) - hw;
+    double ou = fmax(u, 0.0), ow = fmax(w, 0.0);
+    return (u > 0.0 || w > 0.0) ? sqrt(ou * ou + ow * ow) : fmax(u, w);
+}
+
+// Signed XZ distance from a model-space point to the solid parts of the room:
+// the slab behind each wall and the pillar.
+static double ref_room_fixture_dist(double x, double z)
+{
+    const double h = ROOM_FIXTURE_HALF, t = ROOM_FIXTURE_THICKNESS;
+    double d = ref_point_rect_dist_xz(x, z, ROOM_FIXTURE_PILLAR_X, ROOM_FIXTURE_PILLAR_Z,
+        ROOM_FIXTURE_PILLAR_HALF, ROOM_FIXTURE_PILLAR_HALF, ROOM_FIXTURE_PILLAR_YAW);
+    d = fmin(d, ref_point_rect_dist_xz(x, z,  h + t * 0.5, 0.0, t * 0.5, h, 0.0));
+    d = fmin(d, ref_point_rect_dist_xz(x, z, -h - t * 0.5, 0.0, t * 0.5, h, 0.0));
+    d = fmin(d, ref_point_rect_dist_xz(x, z, 0.0,  h + t * 0.5, h, t * 0.5, 0.0));
+    d = fmin(d, ref_point_rect_dist_xz(x, z, 0.0, -h - t * 0.5, h, t * 0.5, 0.0));
+    return d;
+}
+
+static void bench_room_obbs_fixture(const KernelOptions *opt)
+{
+    if (!kernel_selected(opt, "room_obbs_fixture")) return;
+    KernelResult r = { .name = "room_obbs_fixture" };
+
+    const float s = ROOM_FIXTURE_SCALE;
+    const float *o = roomFixtureOffset;
+    SCU_OBB boxes[SCU_STATIC_OBB_MAX];
+    host_dfs_set_root(opt->fixtures);
+    collision_mesh_set_transform(s, o[0], o[1], o[2]);
+    int count = collision_mesh_load_room_obbs("rom:/room_pillar.obb", boxes, SCU_STATIC_OBB_MAX);
+    collision_mesh_set_transform(1.0f, 0.0f, 0.0f, 0.0f);
+    host_dfs_set_root(NULL);
+    if (count != ROOM_FIXTURE_BOXES) {
+        fprintf(stderr, "room_obbs_fixture: %d boxes from %s/room_pillar.obb, want %d\n",
+            count, opt->fixtures, ROOM_FIXTURE_BOXES);
+        r.mismatches++;
+        kernel_report(&r);
+        return;
+    }
+
+    SCU_StaticOBBSet set;
+    scu_static_obbs_bake(&set, boxes, count);
+
+    // Standing capsules scattered over the room and just past its walls
+    static float caps[KERNEL_CASES][2][3];
+    static float radii[KERNEL_CASES];
+    const float extent = (float)(ROOM_FIXTURE_HALF + ROOM_FIXTURE_THICKNESS + 10.0);
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        float x = case_randf(-extent, extent), z = case_randf(-extent, extent);
+        caps[i][0][0] = caps[i][1][0] = x * s + o[0];
+        caps[i][0][2] = caps[i][1][2] = z * s + o[2];
+        caps[i][0][1] = 10.0f * s + o[1];
+        caps[i][1][1] = 50.0f * s + o[1];
+        radii[i] = case_randf(1.0f, 8.0f) * s;
+    }
+
+    SCU_Contact contacts[SCU_STATIC_OBB_MAX];
+    KERNEL_TIME(opt, r, {
+        acc += scu_capsule_vs_static_obbs_push_xz_f(&set, caps[i][0], caps[i][1], radii[i],
+            contacts, SCU_STATIC_OBB_MAX);
+    });
+
+    for (int i = 0; i < KERNEL_CASES; i++) {
+        bool got = scu_capsule_vs_static_obbs_push_xz_f(&set, caps[i][0], caps[i][1], radii[i],
+            contacts, SCU_STATIC_OBB_MAX) > 0;
+        double x = (caps[i][0][0] - o[0]) / s, z = (caps[i][0][2] - o[2]) / s;
+        double margin = ref_room_fixture_dist(x, z) * s - radii[i];
+        kernel_check_bool(&r, got, margin < 0.0, margin, boundary_tol(extent * s, radii[i]));
+    }
+    kernel_report(&r);
+}
+
+// Distance of a fixture vertex (model units) from the nearest room or pillar corner
+static double ref_room_fixture_corner_dist(const float v[3])
+{
+    const double h = ROOM_FIXTURE_HALF;
+    double y = fmin(fabs(v[1]), fabs(v[1] - ROOM_FIXTURE_HEIGHT));
+    double room = hypot(fabs(v[0]) - h, fabs(v[2]) - h);
+    double px = v[0] - ROOM_FIXTURE_PILLAR_X, pz = v[2] - ROOM_FIXTURE_PILLAR_Z;
+    double c = cos(ROOM_FIXTURE_PILLAR_YAW), sn = sin(ROOM_FIXTURE_PILLAR_YAW);
+    double lx = px * c - pz * sn, lz = px * sn + pz * c; // pillar-local
+    double pillar = hypot(fabs(lx) - ROOM_FIXTURE_PILLAR_HALF, fabs(lz) - ROOM_FIXTURE_PILLAR_HALF);
+    return fmax(y, fmin(room, pillar));
+}
+
+// Loads fixtures/room_pillar.col through transform (s, o), then rebuilds the
+// same mesh from the loaded vertices with add_poly (wound so the mesh centroid
+// is inside, as the exporter orients its planes) and build_grid. Planes must
+// agree; so must every grid cell, except under a scale, where the exported
+// grid's margin is scaled with the mesh and the built one's isn't.
+static void room_col_fixture_check(const KernelOptions *opt, KernelResult *r, float s, const float o[3])
+{
+    collision_mesh_cleanup();
+    host_dfs_set_root(opt->fixtures);
+    collision_mesh_set_transform(s, o[0], o[1], o[2]);
+    bool loaded = collision_mesh_load_binary("rom:/room_pillar.col");
+    collision_mesh_set_transform(1.0f, 0.0f, 0.0f, 0.0f);
+    host_dfs_set_root(NULL);
+    if (!loaded || collision_mesh_get_vertex_count() != ROOM_FIXTURE_VERTICES ||
+        collision_mesh_get_poly_count() != ROOM_FIXTURE_POLYS) {
+        fprintf(stderr, "collision_mesh_col_fixture: %s/room_pillar.col %s (%d vertices, %d polys)\n",
+            opt->fixtures, loaded ? "has the wrong mesh" : "didn't load",
+            collision_mesh_get_vertex_count(), collision_mesh_get_poly_count());
+        r->mismatches++;
+        return;
+    }
+
+    static float verts[ROOM_FIXTURE_VERTICES][3];
+    static ColliderPoly polys[ROOM_FIXTURE_POLYS];
+    static uint16_t cellRefs[MESH_GRID_CELLS][MESH_GRID_CELL_MAX_REFS];
+    static int cellCounts[MESH_GRID_CELLS];
+    double centroid[3] = { 0.0, 0.0, 0.0 };
+    for (int v = 0; v < ROOM_FIXTURE_VERTICES; v++) {
+        collision_mesh_get_vertex(v, verts[v]);
+        for (int k = 0; k < 3; k++) centroid[k] += verts[v][k] / ROOM_FIXTURE_VERTICES;
+
+        // Vertices must decode onto the fixture's corners (quantized to 16 bits)
+        float model[3] = { (verts[v][0] - o[0]) / s, (verts[v][1] - o[1]) / s, (verts[v][2] - o[2]) / s };
+        double err = ref_room_fixture_corner_dist(model);
+        r->maxErr = fmax(r->maxErr, err);
+        if (err > 0.01) r->mismatches++;
+    }
+    for (int p = 0; p < ROOM_FIXTURE_POLYS; p++) polys[p] = *collision_mesh_get_poly(p);
+    for (int c = 0; c < MESH_GRID_CELLS; c++) {
+        const uint16_t *refs;
+        cellCounts[c] = collision_mesh_get_grid_cell(c, &refs);
+        for (int i = 0; i < cellCounts[c]; i++) cellRefs[c][i] = refs[i];
+    }
+
+    collision_mesh_cleanup();
+    for (int v = 0; v < ROOM_FIXTURE_VERTICES; v++) collision_mesh_add_vertex(verts[v][0], verts[v][1], verts[v][2]);
+    for (int p = 0; p < ROOM_FIXTURE_POLYS; p++) {
+        const ColliderPoly *lp = &polys[p];
+        double a[3], b[3], c[3];
+        ref_load(a, verts[lp->v0]); ref_load(b, verts[lp->v1]); ref_load(c, verts[lp->v2]);
+        double e1[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+        double e2[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+        double n[3] = { e1[1]*e2[2] - e1[2]*e2[1], e1[2]*e2[0] - e1[0]*e2[2], e1[0]*e2[1] - e1[1]*e2[0] };
+        double toCentroid[3] = { centroid[0] - a[0], centroid[1] - a[1], centroid[2] - a[2] };
+        bool flip = ref_dot(n, toCentroid) > 0.0;
+        collision_mesh_add_poly(lp->v0, flip ? lp->v2 : lp->v1, flip ? lp->v1 : lp->v2, lp->type);
+    }
+    collision_mesh_build_grid();
+
+    for (int p = 0; p < ROOM_FIXTURE_POLYS; p++) {
+        const ColliderPoly *lp = &polys[p], *bp = collision_mesh_get_poly(p);
+        // The exporter's planes come from unquantized vertices: normals agree to
+        // ~1e-4, offsets to about a quantization step times the distance to the origin
+        double nErr = fmax(fmax(fabs(lp->planeA - bp->planeA), fabs(lp->planeB - bp->planeB)),
+                           fabs(lp->planeC - bp->planeC));
+        double dErr = fabs(lp->planeD - bp->planeD) / s;
+        r->maxErr = fmax(r->maxErr, fmax(nErr, dErr));
+        if (lp->type != bp->type || nErr > 1e-3 || dErr > 0.01) r->mismatches++;
+    }
+    if (s != 1.0f) return;
+    for (int c = 0; c < MESH_GRID_CELLS; c++) {
+        const uint16_t *refs;
+        int count = collision_mesh_get_grid_cell(c, &refs);
+        bool same = count == cellCounts[c];
+        for (int i = 0; same && i < count; i++) same = refs[i] == cellRefs[c][i];
+        if (count > 0) r->hits++;
+        if (!same) r->mismatches++;
+    }
+}
+
+static void bench_collision_mesh_col_fixture(const KernelOptions *opt)
+{
+    if (!kernel_selected(opt, "collision_mesh_col_fixture")) return;
+    KernelResult r = { .name = "collision_mesh_col_fixture" };
+
+    static const float origin[3] = { 0.0f, 0.0f, 0.0f };
+    room_col_fixture_check(opt, &r, 1.0f, origin);
+    room_col_fixture_check(opt, &r, ROOM_FIXTURE_SCALE, roomFixtureOffset);
+
+    // Timed per load: open, one read, byte order pass, validation
+    host_dfs_set_root(opt->fixtures);
+    uint64_t t0 = now_ns();
+    for (int it = 0; it < opt->iters; it++) sink += collision_mesh_load_binary("rom:/room_pillar.col");
+    uint64_t t1 = now_ns();
+    host_dfs_set_root(NULL);
+    r.nsPerQuery = (double)(t1 - t0) / opt->iters;
+    collision_mesh_cleanup();
+    kernel_report(&r);
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s [--iters N] [--seed N] [--only NAME] [--fixtures DIR]\n", argv0);
+}
+
+static bool parse_args(int argc, char **argv, KernelOptions *opt)
+{
+    for (int i = 1; i < argc; i++) {
+        const char *a = argv[i];
+        const char *v = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (strcmp(a, "--iters") == 0 && v) { opt->iters = atoi(v); i++; }
+        else if (strcmp(a, "--seed") == 0 && v) { opt->seed = (uint32_t)strtoul(v, NULL, 0); i++; }
+        else if (strcmp(a, "--only") == 0 && v) { opt->only = v; i++; }
+        else if (strcmp(a, "--fixtures") == 0 && v) { opt->fixtures = v; i++; }
+        else { usage(argv[0]); return false; }
+    }
+    if (opt->iters < 1) opt->iters = 1;
+    if (opt->seed == 0) opt->seed = 1;
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    KernelOptions opt = { .iters = 200, .seed = 1 };
+    if (!parse_args(argc, argv, &opt)) return 2;
+
+    static char fixtureDir[512];
+    if (!opt.fixtures) {
+        const char *slash = strrchr(argv[0], '/');
+        int dirLen = slash ? (int)(slash - argv[0]) : 1;
+        snprintf(fixtureDir, sizeof(fixtureDir), "%.*s/fixtures", dirLen, slash ? argv[0] : ".");
+        opt.fixtures = fixtureDir;
+    }
+
+    hostDebugfEnabled = false;
+    caseRng = opt.seed;
+
+    shape_cases_init();
+    obb_cases_init();
+    mat_cases_init();
+    fixed_cases_init();
+    mesh_room_init();
+    sweep_cases_init();
+    static_set_init();
+    blade_cases_init();
+    ray_cases_init();
+    mesh_ray_cases_init();
+    pose_cases_init();
+
+    bench_scu_bool_kernels(&opt);
+    bench_scu_obb(&opt);
+    bench_scu_sweep(&opt);
+    bench_scu_static_obbs(&opt);
+    bench_room_obbs_fixture(&opt);
+    bench_scu_swept_capsule(&opt);
+    bench_scu_segment_obb(&opt);
+    bench_mat4fp(&opt);
+    bench_mat4fp_batch(&opt);
+    bench_bone_cache(&opt);
+    bench_pose_blend(&opt);
+    bench_fixed(&opt);
+    bench_collision_mesh(&opt);
+    bench_collision_mesh_sweep(&opt);
+    bench_collision_mesh_raycast(&opt);
+    bench_collision_mesh_floor(&opt); // replaces the test room
+    bench_collision_mesh_col_fixture(&opt); // replaces the terrain
+
+    printf("@KERNELS kernels=%d failed=%d cases=%d iters=%d seed=%u\n",
+        kernelCount, failedKernels, KERNEL_CASES, opt.iters, opt.seed);
+    return failedKernels > 0 ? 1 : 0;
+}
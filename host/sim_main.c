@@ -0,0 +1,241 @@
+// Headless fight simulator: runs the game's update loop (main.c minus the
+// video/RDP plumbing) on a virtual clock as fast as the host allows, with a
+// seeded bot on the joypad. Fights restart on death, boss defeat or timeout.
+//
+//   pandemonium-sim [--fights N] [--fight-seconds S] [--seed N] [--draw] [--quiet]
+//
+// Prints one "@SIM ..." summary line at the end (and "@FIGHT ..." per fight).
+
+#include <libdragon.h>
+#include <t3d/t3d.h>
+#include <time.h>
+
+#include "globals.h"
+#include "game_time.h"
+#include "joypad_utility.h"
+#include "camera_controller.h"
+#include "audio_controller.h"
+#include "menu_controller.h"
+#include "save_controller.h"
+#include "scene.h"
+#include "character.h"
+#include "game/bosses/boss.h"
+#include "dev/bench.h"
+#include "video_player_utility.h"
+#include "quality_governor.h"
+#include "render_scale_utility.h"
+
+typedef enum {
+    FIGHT_WON,
+    FIGHT_LOST,
+    FIGHT_TIMEOUT,
+} FightResult;
+
+static const char *FIGHT_RESULT_NAMES[] = { "won", "lost", "timeout" };
+
+typedef struct {
+    int fights;
+    float fightSeconds;
+    uint32_t seed;
+    bool draw;
+    bool quiet;
+} SimOptions;
+
+static uint32_t botRng;
+
+static uint32_t bot_rand(void)
+{
+    // xorshift32, independent from the game's own RNG streams
+    botRng ^= botRng << 13;
+    botRng ^= botRng >> 17;
+    botRng ^= botRng << 5;
+    return botRng;
+}
+
+static float bot_randf(void)
+{
+    return (float)(bot_rand() & 0xFFFF) / 65535.0f;
+}
+
+// Simple aggressive bot: keep walking into the locked-on boss, strafe when
+// close, slash in bursts and roll now and then. Also mashes through dialog.
+static joypad_inputs_t bot_inputs(void)
+{
+    static float strafeTimer = 0.0f;
+    static int8_t strafeX = 0;
+
+    joypad_inputs_t in = {0};
+    Boss *boss = boss_get_instance();
+    if (!boss) return in;
+
+    float dx = boss->pos[0] - character.pos[0];
+    float dz = boss->pos[2] - character.pos[2];
+    float dist = sqrtf(dx * dx + dz * dz);
+
+    strafeTimer -= FIXED_TIMESTEP_MS / 1000.0f;
+    if (strafeTimer <= 0.0f) {
+        strafeTimer = 0.5f + bot_randf() * 1.5f;
+        strafeX = (int8_t)((int)(bot_rand() % 3) - 1) * 70;
+    }
+
+    in.stick_y = (dist > 60.0f) ? 80 : 0;
+    in.stick_x = (dist > 60.0f) ? 0 : strafeX;
+
+    in.btn.b = dist < 90.0f && (bot_rand() % 4) == 0;
+    in.btn.a = (bot_rand() % 45) == 0;
+    return in;
+}
+
+static FightResult run_fight(T3DViewport *viewport, const SimOptions *opt, uint64_t *stepsOut, float *simSecondsOut)
+{
+    const uint64_t frameUs = (uint64_t)(FIXED_TIMESTEP_MS * 1000.0f);
+    const uint64_t maxFrames = (uint64_t)(opt->fightSeconds * 1000000.0f) / frameUs;
+    uint64_t steps = 0;
+
+    // bench_init starts the fight itself
+    if (BENCH_MODE) bench_init();
+    else scene_start_fight_skip_intro();
+
+    FightResult result = FIGHT_TIMEOUT;
+    uint64_t frame = 0;
+    for (; frame < maxFrames; ++frame) {
+        host_time_advance_us(frameUs);
+        game_time_update();
+        quality_governor_frame_update(frameDeltaTime);
+        render_scale_update();
+        host_joypad_set(BENCH_MODE ? (joypad_inputs_t){0} : bot_inputs());
+        joypad_update();
+        save_controller_update();
+
+        if (video_player_pump_and_play(viewport)) {
+            result = FIGHT_WON;
+            break;
+        }
+
+        camera_update(viewport);
+        menu_controller_update();
+        scene_update();
+
+        int n = game_time_fixed_begin();
+        for (int i = 0; i < n; ++i) {
+            joypad_fixed_step_begin();
+            if (BENCH_MODE) bench_fixed_step();
+            scene_fixed_update();
+            joypad_fixed_step_end();
+        }
+        game_time_fixed_end();
+        camera_interp_apply(viewport, renderAlpha);
+        steps += (uint64_t)n;
+
+        if (opt->draw) {
+            scene_draw(viewport);
+            menu_controller_draw();
+        }
+
+        if (BENCH_MODE) bench_frame_end();
+
+        GameState state = scene_get_game_state();
+        Boss *boss = boss_get_instance();
+        if (state == GAME_STATE_DEAD) {
+            result = FIGHT_LOST;
+            break;
+        }
+        if (state == GAME_STATE_VICTORY || (boss && boss_get_state(boss) == BOSS_STATE_DEAD)) {
+            result = FIGHT_WON;
+            break;
+        }
+    }
+
+    *stepsOut = steps;
+    *simSecondsOut = (float)((double)frame * (double)frameUs / 1000000.0);
+    return result;
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s [--fights N] [--fight-seconds S] [--seed N] [--draw] [--quiet]\n", argv0);
+}
+
+static bool parse_args(int argc, char **argv, SimOptions *opt)
+{
+    for (int i = 1; i < argc; i++) {
+        const char *a = argv[i];
+        const char *v = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (strcmp(a, "--fights") == 0 && v) { opt->fights = atoi(v); i++; }
+        else if (strcmp(a, "--fight-seconds") == 0 && v) { opt->fightSeconds = (float)atof(v); i++; }
+        else if (strcmp(a, "--seed") == 0 && v) { opt->seed = (uint32_t)strtoul(v, NULL, 0); i++; }
+        else if (strcmp(a, "--draw") == 0) { opt->draw = true; }
+        else if (strcmp(a, "--quiet") == 0) { opt->quiet = true; }
+        else { usage(argv[0]); return false; }
+    }
+    if (opt->fights < 1) opt->fights = 1;
+    if (opt->fightSeconds <= 0.0f) opt->fightSeconds = 600.0f;
+    if (opt->seed == 0) opt->seed = 1;
+    return true;
+}
+
+static double wall_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv)
+{
+    SimOptions opt = { .fights = 10, .fightSeconds = 600.0f, .seed = 1 };
+    if (!parse_args(argc, argv, &opt)) return 2;
+
+    hostDebugfEnabled = !opt.quiet;
+    botRng = opt.seed;
+    rng_seed(opt.seed, opt.seed * 0x9E3779B9u);
+    rand_custom_set_seed(opt.seed);
+
+    display_init(RESOLUTION_320x240, DEPTH_16_BPP, FRAME_BUFFER_COUNT, GAMMA_NONE, FILTERS_RESAMPLE);
+    audio_initialize();
+    game_time_init();
+    joypad_utility_init();
+    save_controller_init();
+    (void)save_controller_load_settings();
+
+    t3d_init((T3DInitParams){});
+    T3DViewport viewport = t3d_viewport_create();
+
+    scene_init();
+    menu_controller_init();
+
+    int results[3] = {0};
+    uint64_t totalSteps = 0;
+    double totalSim = 0.0;
+    double wallStart = wall_seconds();
+
+    for (int f = 0; f < opt.fights; f++) {
+        if (f > 0) scene_restart();
+
+        uint64_t steps = 0;
+        float simSeconds = 0.0f;
+        double t0 = wall_seconds();
+        FightResult r = run_fight(&viewport, &opt, &steps, &simSeconds);
+        double wall = wall_seconds() - t0;
+
+        Boss *boss = boss_get_instance();
+        results[r]++;
+        totalSteps += steps;
+        totalSim += simSeconds;
+        printf("@FIGHT %d result=%s sim_s=%.1f steps=%llu wall_ms=%.1f player_hp=%.0f boss_hp=%.0f boss_phase=%d\n",
+            f, FIGHT_RESULT_NAMES[r], simSeconds, (unsigned long long)steps, wall * 1000.0,
+            character.health, boss ? boss->health : 0.0f, boss ? boss->phaseIndex : 0);
+    }
+
+    double wallTotal = wall_seconds() - wallStart;
+    printf("@SIM fights=%d won=%d lost=%d timeout=%d sim_s=%.1f wall_s=%.3f steps=%llu steps_per_s=%.0f us_per_step=%.2f seed=%u\n",
+        opt.fights, results[FIGHT_WON], results[FIGHT_LOST], results[FIGHT_TIMEOUT],
+        totalSim, wallTotal, (unsigned long long)totalSteps,
+        wallTotal > 0.0 ? (double)totalSteps / wallTotal : 0.0,
+        totalSteps ? wallTotal * 1e6 / (double)totalSteps : 0.0, opt.seed);
+
+    scene_cleanup();
+    menu_controller_free();
+    save_controller_free();
+    return 0;
+}
@@ -0,0 +1,406 @@
+#ifndef HOST_LIBDRAGON_H
+#define HOST_LIBDRAGON_H
+
+// Host stand-in for <libdragon.h>. Declares just the slice of libdragon the
+// game uses: rendering, audio and storage are no-ops, time is a virtual clock
+// the simulator advances, and the joypad reads whatever host_joypad_set()
+// was last given (see host_libdragon.c).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+
+// ---------------------------------------------------------------------------
+// System, timing, debug
+// ---------------------------------------------------------------------------
+
+#define TICKS_PER_SECOND (93750000 / 2)
+#define TICKS_TO_US(val) (((val) * 8) / 375)
+#define TICKS_TO_MS(val) (((val) * 8) / 375000)
+#define TICKS_FROM_US(val) (((val) * 375) / 8)
+#define RCP_FREQUENCY 62500000
+
+uint32_t host_cpu_count(void);
+#define C0_COUNT() host_cpu_count()
+
+// Host-only hooks for the simulator driver (host_libdragon.c)
+void host_time_advance_us(uint64_t us);
+extern bool hostDebugfEnabled;
+extern float hostDisplayFps;
+
+// RDP status/counter registers (DPC_STATUS, CLOCK, BUFBUSY, PIPEBUSY, TMEM).
+// Reads see zero busy time, so dynamic resolution stays at full scale.
+extern volatile uint32_t hostDpcRegs[5];
+#define DPC_STATUS_REG   (&hostDpcRegs[0])
+#define DPC_CLOCK_REG    (&hostDpcRegs[1])
+#define DPC_PIPEBUSY_REG (&hostDpcRegs[3])
+
+uint64_t get_ticks(void);
+uint64_t get_ticks_us(void);
+uint64_t get_ticks_ms(void);
+void wait_ms(unsigned long ms);
+
+#define debugf(...) host_debugf(__VA_ARGS__)
+void host_debugf(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+#define assertf(expr, ...) assert(expr)
+
+static inline bool debug_init_isviewer(void) { return true; }
+static inline bool debug_init_usblog(void) { return true; }
+static inline bool debug_init_sdfs(const char *prefix, int npart) { (void)prefix; (void)npart; return false; }
+static inline void console_init(void) {}
+static inline void console_set_debug(bool debug) { (void)debug; }
+
+typedef struct { int total; int used; } heap_stats_t;
+void sys_get_heap_stats(heap_stats_t *stats);
+
+static inline void *malloc_uncached(size_t size) { return calloc(1, size); }
+static inline void *malloc_uncached_aligned(int align, size_t size) { (void)align; return calloc(1, size); }
+static inline void free_uncached(void *buf) { free(buf); }
+static inline void data_cache_hit_writeback(const void *addr, unsigned long length) { (void)addr; (void)length; }
+static inline void data_cache_hit_writeback_invalidate(const void *addr, unsigned long length) { (void)addr; (void)length; }
+#define UncachedAddr(addr) ((void *)(addr))
+#define CachedAddr(addr) ((void *)(addr))
+
+// ---------------------------------------------------------------------------
+// fmath
+// ---------------------------------------------------------------------------
+
+typedef union { struct { float x, y, z; }; float v[3]; } fm_vec3_t;
+typedef union { struct { float x, y, z, w; }; float v[4]; } fm_vec4_t;
+typedef union { struct { float x, y, z, w; }; float v[4]; } fm_quat_t;
+
+static inline float fm_sinf(float x) { return sinf(x); }
+static inline float fm_cosf(float x) { return cosf(x); }
+static inline float fm_atan2f(float y, float x) { return atan2f(y, x); }
+static inline float fm_floorf(float x) { return floorf(x); }
+static inline float fm_fmodf(float x, float y) { return fmodf(x, y); }
+
+// ---------------------------------------------------------------------------
+// Filesystem / assets. There is no ROM on the host: dfs paths resolve under
+// the directory given to host_dfs_set_root(), and nothing opens until one is set.
+// ---------------------------------------------------------------------------
+
+#define DFS_DEFAULT_LOCATION 0
+void host_dfs_set_root(const char *dir);
+static inline int dfs_init(uint32_t base) { (void)base; return 0; }
+int dfs_open(const char *path);
+int dfs_read(void *buf, int size, int count, uint32_t handle);
+int dfs_size(uint32_t handle);
+int dfs_close(uint32_t handle);
+static inline void asset_init_compression(int level) { (void)level; }
+
+// ---------------------------------------------------------------------------
+// Colors, surfaces, sprites, display
+// ---------------------------------------------------------------------------
+
+typedef struct { uint8_t r, g, b, a; } color_t;
+#define RGBA32(rx, gx, bx, ax) ((color_t){ (uint8_t)(rx), (uint8_t)(gx), (uint8_t)(bx), (uint8_t)(ax) })
+#define RGBA16(rx, gx, bx, ax) ((color_t){ (uint8_t)((rx) << 3), (uint8_t)((gx) << 3), (uint8_t)((bx) << 3), (uint8_t)((ax) ? 0xFF : 0) })
+
+typedef enum { FMT_NONE = 0, FMT_RGBA16, FMT_RGBA32, FMT_CI4, FMT_CI8, FMT_I4, FMT_I8, FMT_IA4, FMT_IA8, FMT_IA16 } tex_format_t;
+
+typedef struct surface_s {
+    uint16_t flags;
+    uint16_t width;
+    uint16_t height;
+    uint16_t stride;
+    void *buffer;
+} surface_t;
+
+typedef struct sprite_s {
+    uint16_t width;
+    uint16_t height;
+    uint8_t flags;
+    uint8_t hslices;
+    uint8_t vslices;
+    uint32_t data[];
+} sprite_t;
+
+surface_t surface_alloc(tex_format_t format, uint16_t width, uint16_t height);
+static inline surface_t surface_make_linear(void *buffer, tex_format_t format, uint16_t width, uint16_t height) { (void)format; return (surface_t){ .width = width, .height = height, .stride = (uint16_t)(width * 2), .buffer = buffer }; }
+static inline surface_t surface_make_sub(surface_t *parent, uint16_t x0, uint16_t y0, uint16_t width, uint16_t height) { (void)x0; (void)y0; return (surface_t){ .width = width, .height = height, .stride = parent->stride, .buffer = parent->buffer }; }
+void surface_free(surface_t *surface);
+
+sprite_t *sprite_load(const char *fn);
+void sprite_free(sprite_t *sprite);
+static inline surface_t sprite_get_pixels(sprite_t *sprite) { return (surface_t){ .width = sprite ? sprite->width : 0, .height = sprite ? sprite->height : 0 }; }
+static inline tex_format_t sprite_get_format(sprite_t *sprite) { (void)sprite; return FMT_RGBA16; }
+
+typedef struct { uint32_t width, height, interlaced; } resolution_t;
+#define RESOLUTION_320x240 ((resolution_t){ 320, 240, 0 })
+typedef enum { DEPTH_16_BPP = 2, DEPTH_32_BPP = 4 } bitdepth_t;
+typedef enum { GAMMA_NONE, GAMMA_CORRECT, GAMMA_CORRECT_DITHER } gamma_t;
+typedef enum { FILTERS_DISABLED, FILTERS_RESAMPLE, FILTERS_DEDITHER, FILTERS_RESAMPLE_ANTIALIAS, FILTERS_RESAMPLE_ANTIALIAS_DEDITHER } filter_options_t;
+
+void display_init(resolution_t res, bitdepth_t bit, uint32_t num_buffers, gamma_t gamma, filter_options_t filters);
+void display_close(void);
+surface_t *display_get(void);
+surface_t *display_get_zbuf(void);
+uint32_t display_get_width(void);
+uint32_t display_get_height(void);
+uint32_t display_get_bitdepth(void);
+float display_get_fps(void);
+
+// ---------------------------------------------------------------------------
+// RSPQ / RDPQ (everything is accepted and dropped)
+// ---------------------------------------------------------------------------
+
+typedef struct rspq_block_s { int unused; } rspq_block_t;
+typedef int rspq_syncpoint_t;
+#define RSPQ_BLOCK_FREE_SUPPORTED 1
+
+void rspq_block_begin(void);
+rspq_block_t *rspq_block_end(void);
+void rspq_block_free(rspq_block_t *block);
+static inline void rspq_block_run(rspq_block_t *block) { (void)block; }
+static inline void rspq_wait(void) {}
+static inline void rspq_flush(void) {}
+static inline rspq_syncpoint_t rspq_syncpoint_new(void) { return 0; }
+static inline void rspq_syncpoint_wait(rspq_syncpoint_t sp) { (void)sp; }
+
+typedef enum { TILE0 = 0, TILE1, TILE2, TILE3, TILE4, TILE5, TILE6, TILE7 } rdpq_tile_t;
+typedef enum { TLUT_NONE = 0, TLUT_RGBA16, TLUT_IA16 } rdpq_tlut_t;
+typedef enum { FILTER_POINT = 0, FILTER_BILINEAR, FILTER_MEDIAN } rdpq_filter_t;
+typedef enum { ZMODE_STANDARD = 0, ZMODE_INTERPENETRATING, ZMODE_TRANSPARENT, ZMODE_DECAL } rdpq_zmode_t;
+typedef enum { DITHER_SQUARE_SQUARE = 0, DITHER_NOISE_NOISE = 5, DITHER_NONE_BAYER = 14, DITHER_NONE_NONE = 15 } rdpq_dither_t;
+
+typedef uint64_t rdpq_combiner_t;
+typedef uint32_t rdpq_blender_t;
+#define RDPQ_COMBINER_FLAT      ((rdpq_combiner_t)1)
+#define RDPQ_COMBINER_SHADE     ((rdpq_combiner_t)2)
+#define RDPQ_COMBINER_TEX_FLAT  ((rdpq_combiner_t)3)
+#define RDPQ_COMBINER_TEX_SHADE ((rdpq_combiner_t)4)
+#define RDPQ_COMBINER1(...)     ((rdpq_combiner_t)5)
+#define RDPQ_BLENDER_MULTIPLY   ((rdpq_blender_t)1)
+#define RDPQ_FOG_DISABLED       ((rdpq_blender_t)0)
+#define RDPQ_FOG_STANDARD       ((rdpq_blender_t)2)
+
+typedef struct {
+    int tmem_addr;
+    int palette;
+    struct {
+        float translate;
+        int scale_log;
+        float repeats;
+        bool mirror;
+    } s, t;
+} rdpq_texparms_t;
+
+typedef struct {
+    rdpq_tile_t tile;
+    int s0, t0;
+    int width, height;
+    bool flip_x, flip_y;
+    int cx, cy;
+    float scale_x, scale_y;
+    float theta;
+    bool filtering;
+    int nx, ny;
+} rdpq_blitparms_t;
+
+typedef enum { ALIGN_LEFT = 0, ALIGN_CENTER, ALIGN_RIGHT } rdpq_align_t;
+typedef enum { VALIGN_TOP = 0, VALIGN_CENTER, VALIGN_BOTTOM } rdpq_valign_t;
+typedef enum { WRAP_NONE = 0, WRAP_ELLIPSES, WRAP_CHAR, WRAP_WORD } rdpq_textwrap_t;
+
+typedef struct {
+    int16_t style_id;
+    int16_t width;
+    int16_t height;
+    rdpq_align_t align;
+    rdpq_valign_t valign;
+    int16_t indent;
+    int16_t max_chars;
+    int16_t char_spacing;
+    int16_t line_spacing;
+    rdpq_textwrap_t wrap;
+    int16_t *tabstops;
+    bool disable_aa_fix;
+    bool preserve_overlapping;
+} rdpq_textparms_t;
+
+typedef struct { int unused; } rdpq_trifmt_t;
+extern const rdpq_trifmt_t TRIFMT_FILL, TRIFMT_SHADE, TRIFMT_TEX, TRIFMT_SHADE_TEX, TRIFMT_ZBUF, TRIFMT_ZBUF_SHADE, TRIFMT_ZBUF_TEX, TRIFMT_ZBUF_SHADE_TEX;
+
+typedef struct rdpq_font_s { int unused; } rdpq_font_t;
+#define FONT_BUILTIN_DEBUG_MONO 1
+#define FONT_BUILTIN_DEBUG_VAR  2
+
+static inline void rdpq_init(void) {}
+static inline void rdpq_attach(const surface_t *color, const surface_t *depth) { (void)color; (void)depth; }
+static inline void rdpq_attach_clear(const surface_t *color, const surface_t *depth) { (void)color; (void)depth; }
+static inline void rdpq_detach(void) {}
+static inline void rdpq_detach_show(void) {}
+static inline void rdpq_sync_pipe(void) {}
+static inline void rdpq_sync_tile(void) {}
+static inline void rdpq_set_mode_standard(void) {}
+static inline void rdpq_set_mode_copy(bool transparency) { (void)transparency; }
+static inline void rdpq_set_mode_fill(color_t color) { (void)color; }
+static inline void rdpq_set_fill_color(color_t color) { (void)color; }
+static inline void rdpq_set_prim_color(color_t color) { (void)color; }
+static inline void rdpq_set_fog_color(color_t color) { (void)color; }
+static inline void rdpq_set_scissor(int x0, int y0, int x1, int y1) { (void)x0; (void)y0; (void)x1; (void)y1; }
+static inline void rdpq_mode_combiner(rdpq_combiner_t comb) { (void)comb; }
+static inline void rdpq_mode_blender(rdpq_blender_t blend) { (void)blend; }
+static inline void rdpq_mode_fog(rdpq_blender_t fog) { (void)fog; }
+static inline void rdpq_mode_zbuf(bool compare, bool update) { (void)compare; (void)update; }
+static inline void rdpq_mode_zoverride(bool enable, float z, int16_t deltaz) { (void)enable; (void)z; (void)deltaz; }
+static inline void rdpq_mode_alphacompare(int threshold) { (void)threshold; }
+static inline void rdpq_mode_dithering(rdpq_dither_t dither) { (void)dither; }
+static inline void rdpq_mode_filter(rdpq_filter_t filt) { (void)filt; }
+static inline void rdpq_mode_tlut(rdpq_tlut_t tlut) { (void)tlut; }
+static inline void rdpq_mode_persp(bool perspective) { (void)perspective; }
+static inline void rdpq_fill_rectangle(float x0, float y0, float x1, float y1) { (void)x0; (void)y0; (void)x1; (void)y1; }
+static inline void rdpq_triangle(const rdpq_trifmt_t *fmt, const float *v1, const float *v2, const float *v3) { (void)fmt; (void)v1; (void)v2; (void)v3; }
+static inline int rdpq_tex_upload(rdpq_tile_t tile, const surface_t *tex, const rdpq_texparms_t *parms) { (void)tile; (void)tex; (void)parms; return 0; }
+static inline void rdpq_tex_blit(const surface_t *surf, float x0, float y0, const rdpq_blitparms_t *parms) { (void)surf; (void)x0; (void)y0; (void)parms; }
+static inline void rdpq_sprite_upload(rdpq_tile_t tile, sprite_t *sprite, const rdpq_texparms_t *parms) { (void)tile; (void)sprite; (void)parms; }
+static inline void rdpq_sprite_blit(sprite_t *sprite, float x0, float y0, const rdpq_blitparms_t *parms) { (void)sprite; (void)x0; (void)y0; (void)parms; }
+
+rdpq_font_t *rdpq_font_load(const char *fn);
+rdpq_font_t *rdpq_font_load_builtin(int font);
+static inline void rdpq_text_register_font(uint8_t font_id, const rdpq_font_t *font) { (void)font_id; (void)font; }
+static inline int rdpq_text_printf(const rdpq_textparms_t *parms, uint8_t font_id, float x0, float y0, const char *fmt, ...) { (void)parms; (void)font_id; (void)x0; (void)y0; (void)fmt; return 0; }
+static inline int rdpq_text_print(const rdpq_textparms_t *parms, uint8_t font_id, float x0, float y0, const char *utf8_text) { (void)parms; (void)font_id; (void)x0; (void)y0; (void)utf8_text; return 0; }
+
+// ---------------------------------------------------------------------------
+// RSPQ profiler
+// ---------------------------------------------------------------------------
+
+enum {
+    RSPQ_PROFILE_CSLOT_WAIT_CPU = 11,
+    RSPQ_PROFILE_CSLOT_WAIT_RDP,
+    RSPQ_PROFILE_CSLOT_WAIT_RDP_SYNCFULL,
+    RSPQ_PROFILE_CSLOT_WAIT_RDP_SYNCFULL_MULTI,
+    RSPQ_PROFILE_CSLOT_OVL_SWITCH,
+};
+#define RSPQ_PROFILE_SLOT_COUNT 16
+
+typedef struct {
+    uint64_t total_ticks;
+    uint64_t sample_count;
+    const char *name;
+} rspq_profile_slot_t;
+
+typedef struct {
+    rspq_profile_slot_t slots[RSPQ_PROFILE_SLOT_COUNT];
+    uint64_t total_ticks;
+    uint64_t rdp_busy_ticks;
+    uint64_t frame_count;
+} rspq_profile_data_t;
+
+static inline void rspq_profile_start(void) {}
+static inline void rspq_profile_stop(void) {}
+static inline void rspq_profile_reset(void) {}
+static inline void rspq_profile_next_frame(void) {}
+static inline void rspq_profile_get_data(rspq_profile_data_t *data) { memset(data, 0, sizeof(*data)); }
+
+// ---------------------------------------------------------------------------
+// Audio (silent)
+// ---------------------------------------------------------------------------
+
+typedef struct { float frequency; } waveform_t;
+typedef struct { waveform_t wave; int loop; } wav64_t;
+
+static inline void audio_init(int frequency, int numbuffers) { (void)frequency; (void)numbuffers; }
+static inline void mixer_init(int num_channels) { (void)num_channels; }
+static inline void mixer_try_play(void) {}
+static inline void mixer_ch_set_vol(int ch, float lvol, float rvol) { (void)ch; (void)lvol; (void)rvol; }
+static inline void mixer_ch_set_freq(int ch, float frequency) { (void)ch; (void)frequency; }
+static inline void mixer_ch_set_limits(int ch, int max_bits, float max_frequency, int max_buf_sz) { (void)ch; (void)max_bits; (void)max_frequency; (void)max_buf_sz; }
+static inline void mixer_ch_stop(int ch) { (void)ch; }
+static inline bool mixer_ch_playing(int ch) { (void)ch; return false; }
+
+static inline void wav64_init_compression(int level) { (void)level; }
+wav64_t *wav64_load(const char *fn, void *parms);
+static inline void wav64_open(wav64_t *wav, const char *fn) { (void)fn; if (wav) memset(wav, 0, sizeof(*wav)); }
+static inline void wav64_close(wav64_t *wav) { (void)wav; }
+static inline void wav64_play(wav64_t *wav, int ch) { (void)wav; (void)ch; }
+static inline void wav64_set_loop(wav64_t *wav, bool loop) { if (wav) wav->loop = loop; }
+
+// ---------------------------------------------------------------------------
+// Video playback (never plays on the host)
+// ---------------------------------------------------------------------------
+
+typedef struct { int unused; } video_codec_t;
+typedef struct { bool stop; } fmv_control_t;
+typedef struct {
+    void (*osd_callback)(void *ctx, int frame_idx, float time_sec, fmv_control_t *ctrl);
+    void *osd_ctx;
+} fmv_parms_t;
+extern const video_codec_t h264_codec, mpeg1_codec;
+
+static inline void yuv_init(void) {}
+static inline void video_register_codec(const video_codec_t *codec) { (void)codec; }
+static inline void fmv_play(const char *fn, fmv_parms_t *parms) { (void)fn; (void)parms; }
+
+// ---------------------------------------------------------------------------
+// EEPROM (backed by host memory, starts blank every run)
+// ---------------------------------------------------------------------------
+
+typedef enum { EEPROM_NONE = 0, EEPROM_4K = 1, EEPROM_16K = 2 } eeprom_type_t;
+typedef struct { const char *path; size_t size; } eepfs_entry_t;
+enum { EEPFS_ESUCCESS = 0, EEPFS_EBADFS = -1, EEPFS_ENOFILE = -2, EEPFS_EBADINPUT = -3, EEPFS_ENOMEM = -4, EEPFS_EBADHANDLE = -5, EEPFS_ECONFLICT = -6 };
+
+eeprom_type_t eeprom_present(void);
+int eepfs_init(const eepfs_entry_t *entries, size_t count);
+int eepfs_close(void);
+int eepfs_read(const char *path, void *dest, size_t size);
+int eepfs_write(const char *path, const void *src, size_t size);
+bool eepfs_verify_signature(void);
+void eepfs_wipe(void);
+
+// ---------------------------------------------------------------------------
+// Joypad (port 1 is driven by host_joypad_set)
+// ---------------------------------------------------------------------------
+
+typedef enum { JOYPAD_PORT_1 = 0, JOYPAD_PORT_2, JOYPAD_PORT_3, JOYPAD_PORT_4, JOYPAD_PORT_COUNT } joypad_port_t;
+
+typedef union {
+    uint16_t raw;
+    struct {
+        unsigned a : 1;
+        unsigned b : 1;
+        unsigned z : 1;
+        unsigned start : 1;
+        unsigned d_up : 1;
+        unsigned d_down : 1;
+        unsigned d_left : 1;
+        unsigned d_right : 1;
+        unsigned y : 1;
+        unsigned x : 1;
+        unsigned l : 1;
+        unsigned r : 1;
+        unsigned c_up : 1;
+        unsigned c_down : 1;
+        unsigned c_left : 1;
+        unsigned c_right : 1;
+    };
+} joypad_buttons_t;
+
+typedef struct {
+    joypad_buttons_t btn;
+    int8_t stick_x;
+    int8_t stick_y;
+    int8_t cstick_x;
+    int8_t cstick_y;
+    uint8_t analog_l;
+    uint8_t analog_r;
+} joypad_inputs_t;
+
+void host_joypad_set(joypad_inputs_t inputs);
+
+void joypad_init(void);
+void joypad_poll(void);
+joypad_inputs_t joypad_get_inputs(joypad_port_t port);
+joypad_buttons_t joypad_get_buttons_pressed(joypad_port_t port);
+joypad_buttons_t joypad_get_buttons_released(joypad_port_t port);
+static inline bool joypad_is_connected(joypad_port_t port) { return port == JOYPAD_PORT_1; }
+static inline bool joypad_get_rumble_supported(joypad_port_t port) { (void)port; return false; }
+static inline void joypad_set_rumble_active(joypad_port_t port, bool active) { (void)port; (void)active; }
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef HOST_T3D_H
+#define HOST_T3D_H
+
+#include <libdragon.h>
+#include "t3dmath.h"
+
+// Host stand-in for Tiny3D. Math and viewport projection are real (gameplay
+// and UI placement read them back), everything that would emit RSP commands
+// is dropped.
+
+#define T3D_FLAG_DEPTH      (1 << 0)
+#define T3D_FLAG_TEXTURED   (1 << 1)
+#define T3D_FLAG_SHADED     (1 << 2)
+#define T3D_FLAG_CULL_FRONT (1 << 3)
+#define T3D_FLAG_CULL_BACK  (1 << 4)
+#define T3D_FLAG_NO_LIGHT   (1 << 5)
+
+#define T3D_SEGMENT_SKELETON 2
+
+typedef struct {
+    int matrixStackSize;
+} T3DInitParams;
+
+typedef struct {
+    T3DMat4 matProj;
+    T3DMat4 matCamera;
+    T3DMat4 matCamProj;
+    int offset[2];
+    int size[2];
+    float guardBandScale;
+    bool useRejection;
+} T3DViewport;
+
+typedef struct {
+    int16_t posA[3];
+    uint16_t normA;
+    int16_t posB[3];
+    uint16_t normB;
+    uint32_t rgbaA;
+    uint32_t rgbaB;
+    int16_t stA[2];
+    int16_t stB[2];
+} __attribute__((aligned(8))) T3DVertPacked;
+
+static inline void t3d_init(T3DInitParams params) { (void)params; }
+static inline void t3d_destroy(void) {}
+static inline void t3d_frame_start(void) {}
+static inline void t3d_screen_clear_color(color_t color) { (void)color; }
+static inline void t3d_screen_clear_depth(void) {}
+
+T3DViewport t3d_viewport_create(void);
+static inline void t3d_viewport_attach(T3DViewport *viewport) { (void)viewport; }
+static inline void t3d_viewport_set_area(T3DViewport *viewport, int x, int y, int width, int height) { viewport->offset[0] = x; viewport->offset[1] = y; viewport->size[0] = width; viewport->size[1] = height; }
+void t3d_viewport_set_projection(T3DViewport *viewport, float fov, float near, float far);
+void t3d_viewport_set_perspective(T3DViewport *viewport, float fov, float aspectRatio, float near, float far);
+void t3d_viewport_look_at(T3DViewport *viewport, const T3DVec3 *eye, const T3DVec3 *target, const T3DVec3 *up);
+void t3d_viewport_calc_viewspace_pos(T3DViewport *viewport, T3DVec3 *out, const T3DVec3 *pos);
+
+static inline void t3d_matrix_set(const T3DMat4FP *mat, bool doMultiply) { (void)mat; (void)doMultiply; }
+static inline void t3d_matrix_push(const T3DMat4FP *mat) { (void)mat; }
+static inline void t3d_matrix_pop(int count) { (void)count; }
+static inline void t3d_matrix_push_pos(int count) { (void)count; }
+
+static inline void t3d_state_set_drawflags(int drawFlags) { (void)drawFlags; }
+static inline void t3d_state_set_depth_offset(int16_t offset) { (void)offset; }
+static inline void t3d_fog_set_enabled(bool isEnabled) { (void)isEnabled; }
+static inline void t3d_fog_set_range(float near, float far) { (void)near; (void)far; }
+static inline void t3d_light_set_ambient(const uint8_t *color) { (void)color; }
+static inline void t3d_light_set_directional(int index, const uint8_t *color, const T3DVec3 *dir) { (void)index; (void)color; (void)dir; }
+static inline void t3d_light_set_count(int count) { (void)count; }
+
+static inline void t3d_vert_load(const T3DVertPacked *vertices, uint32_t offset, uint32_t count) { (void)vertices; (void)offset; (void)count; }
+static inline void t3d_tri_draw(uint32_t v0, uint32_t v1, uint32_t v2) { (void)v0; (void)v1; (void)v2; }
+static inline void t3d_tri_sync(void) {}
+
+static inline int16_t *t3d_vertbuffer_get_uv(T3DVertPacked *vert, int idx)
+{
+    return (idx & 1) ? vert[idx >> 1].stB : vert[idx >> 1].stA;
+}
+
+static inline uint16_t t3d_vert_pack_normal(const T3DVec3 *normal)
+{
+    int32_t x = (int32_t)(normal->v[0] * 15.5f);
+    int32_t y = (int32_t)(normal->v[1] * 31.5f);
+    int32_t z = (int32_t)(normal->v[2] * 15.5f);
+    return (uint16_t)(((x & 0x1F) << 11) | ((y & 0x3F) << 5) | (z & 0x1F));
+}
+
+static inline void *t3d_segment_placeholder(int segmentId) { return (void *)(uintptr_t)(segmentId << 24); }
+static inline void t3d_segment_set(int segmentId, void *address) { (void)segmentId; (void)address; }
+
+#endif
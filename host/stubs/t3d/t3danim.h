@@ -0,0 +1,43 @@
+#ifndef HOST_T3D_ANIM_H
+#define HOST_T3D_ANIM_H
+
+#include "t3dskeleton.h"
+
+// Shim animation: keeps the time/playing/looping bookkeeping Tiny3D does but
+// has no keyframes, so attached skeletons stay in their rest pose. Every clip
+// lasts HOST_ANIM_DEFAULT_LENGTH seconds unless host_anim_set_length() says
+// otherwise for its name.
+
+#define HOST_ANIM_DEFAULT_LENGTH 1.0f
+
+typedef struct {
+    const char *name;
+    float duration;
+} T3DChunkAnim;
+
+typedef struct {
+    const T3DChunkAnim *animRef;
+    T3DSkeleton *skel;
+    float speed;
+    float time;
+    bool isPlaying;
+    bool isLooping;
+} T3DAnim;
+
+struct T3DModel;
+
+void host_anim_set_length(const char *name, float seconds);
+
+T3DAnim t3d_anim_create(const struct T3DModel *model, const char *name);
+void t3d_anim_destroy(T3DAnim *anim);
+void t3d_anim_attach(T3DAnim *anim, const T3DSkeleton *skeleton);
+void t3d_anim_update(T3DAnim *anim, float deltaTime);
+void t3d_anim_set_time(T3DAnim *anim, float time);
+
+static inline void t3d_anim_set_speed(T3DAnim *anim, float speed) { anim->speed = speed; }
+static inline void t3d_anim_set_playing(T3DAnim *anim, bool isPlaying) { anim->isPlaying = isPlaying; }
+static inline void t3d_anim_set_looping(T3DAnim *anim, bool loop) { anim->isLooping = loop; }
+static inline float t3d_anim_get_length(const T3DAnim *anim) { return anim->animRef->duration; }
+static inline float t3d_anim_get_time(const T3DAnim *anim) { return anim->time; }
+
+#endif
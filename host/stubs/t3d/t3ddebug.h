@@ -0,0 +1,11 @@
+#ifndef HOST_T3D_DEBUG_H
+#define HOST_T3D_DEBUG_H
+
+#include <libdragon.h>
+
+static inline void t3d_debug_print_init(void) {}
+static inline void t3d_debug_print_start(void) {}
+static inline void t3d_debug_print(float x, float y, const char *str) { (void)x; (void)y; (void)str; }
+static inline void t3d_debug_printf(float x, float y, const char *fmt, ...) { (void)x; (void)y; (void)fmt; }
+
+#endif
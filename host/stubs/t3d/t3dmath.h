@@ -0,0 +1,56 @@
+#ifndef HOST_T3D_MATH_H
+#define HOST_T3D_MATH_H
+
+#include <libdragon.h>
+
+// Same layouts as Tiny3D so code poking at .v / .m / .i / .f works unchanged.
+
+typedef fm_vec3_t T3DVec3;
+typedef fm_vec4_t T3DVec4;
+typedef fm_quat_t T3DQuat;
+
+typedef struct {
+    float m[4][4];
+} T3DMat4;
+
+typedef struct {
+    struct {
+        int16_t i[4];
+        uint16_t f[4];
+    } m[4];
+} __attribute__((aligned(16))) T3DMat4FP;
+
+#define T3D_PI 3.14159265358979f
+#define T3D_DEG_TO_RAD(deg) ((deg) * (T3D_PI / 180.0f))
+
+static inline void t3d_vec3_norm(T3DVec3 *res)
+{
+    float len = sqrtf(res->v[0] * res->v[0] + res->v[1] * res->v[1] + res->v[2] * res->v[2]);
+    if (len < 0.0001f) len = 0.0001f;
+    res->v[0] /= len;
+    res->v[1] /= len;
+    res->v[2] /= len;
+}
+
+static inline void t3d_vec3_lerp(T3DVec3 *res, const T3DVec3 *a, const T3DVec3 *b, float t)
+{
+    for (int i = 0; i < 3; i++) res->v[i] = a->v[i] + (b->v[i] - a->v[i]) * t;
+}
+
+void t3d_quat_nlerp(T3DQuat *res, const T3DQuat *a, const T3DQuat *b, float t);
+
+void t3d_mat4_identity(T3DMat4 *mat);
+void t3d_mat4fp_identity(T3DMat4FP *mat);
+void t3d_mat4_scale(T3DMat4 *mat, float scaleX, float scaleY, float scaleZ);
+void t3d_mat4_rotate(T3DMat4 *mat, const T3DVec3 *axis, float angleRad);
+void t3d_mat4_rot_from_dir(T3DMat4 *mat, const T3DVec3 *dir, const T3DVec3 *up);
+void t3d_mat4_from_srt_euler(T3DMat4 *mat, const float scale[3], const float rot[3], const float translate[3]);
+void t3d_mat4_from_srt(T3DMat4 *mat, const float scale[3], const float quat[4], const float translate[3]);
+void t3d_mat4_mul(T3DMat4 *matRes, const T3DMat4 *matL, const T3DMat4 *matR);
+void t3d_mat4_to_fixed(T3DMat4FP *matOut, const T3DMat4 *matIn);
+void t3d_mat4fp_from_srt_euler(T3DMat4FP *mat, const float scale[3], const float rot[3], const float translate[3]);
+void t3d_mat4fp_set_pos(T3DMat4FP *mat, const float pos[3]);
+void t3d_mat3_mul_vec3(T3DVec3 *vecOut, const T3DMat4 *mat, const T3DVec3 *vecIn);
+void t3d_mat4_mul_vec3(T3DVec4 *vecOut, const T3DMat4 *mat, const T3DVec3 *vecIn);
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef HOST_T3D_MODEL_H
+#define HOST_T3D_MODEL_H
+
+#include "t3dmath.h"
+#include "t3dskeleton.h"
+
+// Shim model: loading never touches the filesystem, it only remembers the
+// path and carries a HOST_SKELETON_BONES skeleton. Drawing is a no-op.
+
+typedef struct T3DMaterial {
+    const char *name;
+} T3DMaterial;
+
+typedef struct T3DObject {
+    const char *name;
+    T3DMaterial *material;
+} T3DObject;
+
+typedef struct T3DModel {
+    const char *path;
+    T3DChunkSkeleton skeleton;
+} T3DModel;
+
+typedef struct {
+    void *userData;
+    void (*tileCb)(void *userData, rdpq_texparms_t *tileParams, rdpq_tile_t tile);
+    bool (*filterCb)(void *userData, const T3DObject *obj);
+    void (*dynTextureCb)(void *userData, const T3DMaterial *material, rdpq_texparms_t *tileParams, rdpq_tile_t tile);
+    const T3DMat4FP *matrices;
+} T3DModelDrawConf;
+
+T3DModel *t3d_model_load(const char *path);
+void t3d_model_free(T3DModel *model);
+
+static inline void t3d_model_draw_custom(const T3DModel *model, T3DModelDrawConf conf) { (void)model; (void)conf; }
+static inline void t3d_model_draw(const T3DModel *model) { (void)model; }
+static inline void t3d_model_draw_skinned(const T3DModel *model, const T3DSkeleton *skeleton) { (void)model; (void)skeleton; }
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef HOST_T3D_SKELETON_H
+#define HOST_T3D_SKELETON_H
+
+#include "t3dmath.h"
+
+// Shim skeleton: every model gets HOST_SKELETON_BONES identity bones and
+// t3d_skeleton_find_bone() hands out a stable index per bone name, so
+// gameplay code that reads bone matrices keeps working without real assets.
+
+#define HOST_SKELETON_BONES 32
+
+typedef struct {
+    uint16_t boneCount;
+} T3DChunkSkeleton;
+
+typedef struct {
+    T3DMat4 matrix;
+    T3DQuat rotation;
+    T3DVec3 position;
+    T3DVec3 scale;
+    bool hasChanged;
+} T3DBone;
+
+typedef struct {
+    T3DBone *bones;
+    T3DMat4FP *boneMatricesFP;
+    const T3DChunkSkeleton *skeletonRef;
+    int bufferCount;
+    int currentBufferIdx;
+} T3DSkeleton;
+
+struct T3DModel;
+
+T3DSkeleton t3d_skeleton_create(const struct T3DModel *model);
+T3DSkeleton t3d_skeleton_create_buffered(const struct T3DModel *model, int bufferCount);
+T3DSkeleton t3d_skeleton_clone(const T3DSkeleton *skel, bool useMatrices);
+void t3d_skeleton_reset(T3DSkeleton *skeleton);
+void t3d_skeleton_update(T3DSkeleton *skeleton);
+void t3d_skeleton_blend(const T3DSkeleton *skelRes, const T3DSkeleton *skelA, const T3DSkeleton *skelB, float factor);
+int t3d_skeleton_find_bone(T3DSkeleton *skeleton, const char *name);
+void t3d_skeleton_destroy(T3DSkeleton *skeleton);
+
+static inline void t3d_skeleton_use(const T3DSkeleton *skel) { (void)skel; }
+
+#endif
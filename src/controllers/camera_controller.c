@@ -11,6 +11,8 @@
 
 #include "globals.h"
 #include "video_controller.h"
+#include "collision_system.h"
+#include "anim_scheduler.h"
 
 CameraState cameraState = CAMERA_NONE;
 CameraState lastCameraState = CAMERA_NONE;
@@ -63,6 +65,25 @@ static float cameraTransitionDuration = 0.0f;
 static T3DVec3 cameraTransitionStartPos;
 static T3DVec3 cameraTransitionStartTarget;
 
+// The character camera is driven from the fixed step; these hold its follow
+// pos/target from before the current step so the view can be blended by
+// renderAlpha in step with the interpolated knight.
+static T3DVec3 characterCamPrevPos;
+static T3DVec3 characterCamPrevTarget;
+static T3DVec3 characterCamLerpTarget;                 // characterCamTarget at renderAlpha
+static const float CAMERA_INTERP_SNAP_DIST = 150.0f;  // further than this in one step is a cut, not a move
+
+// Character camera occlusion: each frame the line from the knight to the
+// camera is cast against the room, and the view moves in front of anything
+// blocking it. It snaps in (never shows the inside of a wall) and eases back out.
+bool cameraOcclusionPullIn = true;
+static const float CAMERA_OCCLUSION_EYE_Y = 15.0f;    // cast from the knight's chest (the follow target height)
+static const float CAMERA_OCCLUSION_MARGIN = 6.0f;    // stay this far in front of the hit, past the near clip
+static const float CAMERA_OCCLUSION_MIN_DIST = 10.0f; // never closer to the knight than this
+static const float CAMERA_OCCLUSION_EASE_OUT = 4.0f;  // 1/s, back out to the full distance once clear
+static float cameraOcclusionDist = -1.0f;             // pulled-in distance from the knight, < 0 when clear
+static T3DVec3 characterCamViewPos;                   // characterCamPos after the pull-in
+
 static bool  breathEnabled = false;
 
 static float breathT = 0.0f;
@@ -132,8 +153,8 @@ static void camera_get_view_for_state(CameraState state, T3DVec3 *outPos, T3DVec
 	switch (state)
 	{
 		case CAMERA_CHARACTER:
-			*outPos = characterCamPos;
-			*outTarget = characterCamTarget;
+			*outPos = characterCamViewPos;
+			*outTarget = characterCamLerpTarget;
 			break;
 		case CAMERA_CUSTOM:
 			*outPos = customCamPos;
@@ -148,6 +169,48 @@ static void camera_get_view_for_state(CameraState state, T3DVec3 *outPos, T3DVec
 	}
 }
 
+// camPosIn and knightPos are the interpolated follow position and knight
+static void camera_occlusion_update(const T3DVec3 *camPosIn, const float knightPos[3])
+{
+    characterCamViewPos = *camPosIn;
+    if (!cameraOcclusionPullIn) {
+        cameraOcclusionDist = -1.0f;
+        return;
+    }
+
+    float eye[3] = { knightPos[0], knightPos[1] + CAMERA_OCCLUSION_EYE_Y, knightPos[2] };
+    float d[3] = {
+        camPosIn->v[0] - eye[0],
+        camPosIn->v[1] - eye[1],
+        camPosIn->v[2] - eye[2],
+    };
+    float full = sqrtf(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+    if (full <= CAMERA_OCCLUSION_MIN_DIST) {
+        cameraOcclusionDist = -1.0f;
+        return;
+    }
+
+    float allowed = full;
+    float t, n[3];
+    if (collision_raycast_static(eye, camPosIn->v, &t, n)) {
+        allowed = fmaxf(t * full - CAMERA_OCCLUSION_MARGIN, CAMERA_OCCLUSION_MIN_DIST);
+    }
+
+    if (allowed < full && (cameraOcclusionDist < 0.0f || allowed < cameraOcclusionDist)) {
+        cameraOcclusionDist = allowed;
+    } else if (cameraOcclusionDist >= 0.0f) {
+        float k = clampf(CAMERA_OCCLUSION_EASE_OUT * deltaTime, 0.0f, 1.0f);
+        cameraOcclusionDist += (allowed - cameraOcclusionDist) * k;
+        if (cameraOcclusionDist >= full - 0.01f) cameraOcclusionDist = -1.0f;
+    }
+    if (cameraOcclusionDist < 0.0f) return;
+
+    float s = cameraOcclusionDist / full;
+    characterCamViewPos.v[0] = eye[0] + d[0] * s;
+    characterCamViewPos.v[1] = eye[1] + d[1] * s;
+    characterCamViewPos.v[2] = eye[2] + d[2] * s;
+}
+
 void camera_initialize(T3DVec3 *pos, T3DVec3 *dir, float rotX, float rotY) 
 {
     // Camera
@@ -169,6 +232,11 @@ void camera_initialize(T3DVec3 *pos, T3DVec3 *dir, float rotX, float rotY)
 
     characterCamPos = camPos;
     characterCamTarget = camTarget;
+    characterCamViewPos = camPos;
+    characterCamPrevPos = camPos;
+    characterCamPrevTarget = camTarget;
+    characterCamLerpTarget = camTarget;
+    cameraOcclusionDist = -1.0f;
 
     customCamPos = camPos;
     customCamTarget = camTarget;
@@ -259,8 +327,51 @@ void camera_set_projection(T3DViewport *viewport)
     }
 }
 
+void camera_interp_capture(void)
+{
+    characterCamPrevPos = characterCamPos;
+    characterCamPrevTarget = characterCamTarget;
+}
+
+void camera_interp_apply(T3DViewport *viewport, float alpha)
+{
+    float knightAlpha = alpha;
+    bool toCharacter = cameraTransitionActive && cameraTransitionTarget == CAMERA_CHARACTER;
+    if (cameraState != CAMERA_CHARACTER && !toCharacter) return;
+
+    float dx = characterCamPos.v[0] - characterCamPrevPos.v[0];
+    float dy = characterCamPos.v[1] - characterCamPrevPos.v[1];
+    float dz = characterCamPos.v[2] - characterCamPrevPos.v[2];
+    if (dx*dx + dy*dy + dz*dz > CAMERA_INTERP_SNAP_DIST * CAMERA_INTERP_SNAP_DIST) alpha = 1.0f;
+
+    T3DVec3 followPos;
+    vec3_lerp_local(&followPos, &characterCamPrevPos, &characterCamPos, alpha);
+    vec3_lerp_local(&characterCamLerpTarget, &characterCamPrevTarget, &characterCamTarget, alpha);
+
+    float knightPos[3];
+    character_interp_position(knightAlpha, knightPos);
+    camera_occlusion_update(&followPos, knightPos);
+
+    // Transitions blend towards last frame's view from camera_update
+    if (cameraState != CAMERA_CHARACTER || cameraTransitionActive) return;
+
+    camPos = characterCamViewPos;
+    camTarget = characterCamLerpTarget;
+
+    camDir.v[0] = camTarget.v[0] - camPos.v[0];
+    camDir.v[1] = camTarget.v[1] - camPos.v[1];
+    camDir.v[2] = camTarget.v[2] - camPos.v[2];
+    t3d_vec3_norm(&camDir);
+
+    camera_set_projection(viewport);
+
+    camera_apply_screen_shake(&camPos, &camTarget, &up);
+    t3d_viewport_look_at(viewport, &camPos, &camTarget, &up);
+}
+
 void camera_update(T3DViewport *viewport)
 {
+	anim_sched_set_viewport(viewport);
 	animation_utility_screen_shake_update();
 
 	if (cameraTransitionActive)
@@ -336,19 +447,7 @@ void camera_update(T3DViewport *viewport)
             camera_reset_third_person();
         }
         
-        // Set up camera viewport
-        camPos = characterCamPos;
-        camTarget = characterCamTarget;
-
-        camDir.v[0] = camTarget.v[0] - camPos.v[0];  // X component
-        camDir.v[1] = camTarget.v[1] - camPos.v[1];  // Y component
-        camDir.v[2] = camTarget.v[2] - camPos.v[2];  // Z component
-        t3d_vec3_norm(&camDir);
-
-        camera_set_projection(viewport);
-
-        camera_apply_screen_shake(&camPos, &camTarget, &up);
-        t3d_viewport_look_at(viewport, &camPos, &camTarget, &up);
+        // The view itself is set after the fixed steps, in camera_interp_apply
     }
     else if(cameraState == CAMERA_FREECAM)
     {
@@ -556,6 +655,11 @@ void camera_reset(void)
 
     characterCamPos = camPos;
     characterCamTarget = camTarget;
+    characterCamViewPos = camPos;
+    characterCamPrevPos = camPos;
+    characterCamPrevTarget = camTarget;
+    characterCamLerpTarget = camTarget;
+    cameraOcclusionDist = -1.0f;
 
     cameraLockOnActive = false;
     cameraLockOnTarget = (T3DVec3){{0.0f, 0.0f, 0.0f}};
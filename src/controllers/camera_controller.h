@@ -43,6 +43,9 @@ extern bool cameraLockOnActive;
 extern T3DVec3 cameraLockOnTarget;
 extern float cameraLockBlend;    // 0: follow, 1: lock-on
 
+// Character camera moves in toward the knight when room geometry blocks the view
+extern bool cameraOcclusionPullIn;
+
 // Third-person camera variables
 extern float cameraDistance;      // Distance behind character
 extern float cameraHeight;        // Height offset above character  
@@ -57,6 +60,10 @@ extern float customCamRoll;
 
 void camera_initialize(T3DVec3 *pos, T3DVec3 *dir, float rotX, float rotY);
 void camera_update(T3DViewport *viewport);
+// Render interpolation of the character camera, which follows the knight
+// from the fixed step: capture before each step, apply after the last one
+void camera_interp_capture(void);
+void camera_interp_apply(T3DViewport *viewport, float alpha);
 void camera_switch_state(CameraState state);
 T3DVec3* camera_get_camera_pos(void);
 void camera_reset(void);
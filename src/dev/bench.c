@@ -0,0 +1,351 @@
+#include "bench.h"
+
+#include <rspq_profile.h>
+#include <malloc.h>
+#include <string.h>
+
+#include "game_time.h"
+#include "collision_stats.h"
+#include "anim_scheduler.h"
+#include "character.h"
+#include "scene.h"
+#include "game/bosses/boss.h"
+#include "game/bosses/boss_ai.h"
+
+// Player distance each attack needs to be picked by boss_ai_select_attack()
+typedef struct {
+    BossAttackId id;
+    float dist;
+    bool phase2;
+} BenchAttack;
+
+static const BenchAttack BENCH_ATTACKS[] = {
+    { BOSS_ATTACK_STOMP,                 20.0f, false },
+    { BOSS_ATTACK_ATTACK1,               50.0f, false },
+    { BOSS_ATTACK_COMBO_STARTER,         50.0f, false },
+    { BOSS_ATTACK_COMBO,                 50.0f, false },
+    { BOSS_ATTACK_COMBO_LUNGE,           50.0f, false },
+    { BOSS_ATTACK_TRACKING_SLAM,         70.0f, false },
+    { BOSS_ATTACK_LUNGE_STARTER,        150.0f, false },
+    { BOSS_ATTACK_FLIP_ATTACK,          150.0f, false },
+    { BOSS_ATTACK_POWER_JUMP,           220.0f, false },
+    { BOSS_ATTACK_GROUND_SWEEP,         150.0f, true  },
+    { BOSS_ATTACK_AERIAL_SWORD_BARRAGE, 300.0f, true  },
+};
+#define BENCH_ATTACK_COUNT (int)(sizeof(BENCH_ATTACKS) / sizeof(BENCH_ATTACKS[0]))
+
+#define BENCH_FORCE_TIMEOUT_S 8.0f   // give up on an attack that never starts
+#define BENCH_ATTACK_GAP_S    1.0f   // idle time between attacks
+
+// Frame time histogram, 100us buckets up to 100ms
+#define BENCH_HIST_BUCKET_US 100
+#define BENCH_HIST_BUCKETS 1000
+
+typedef enum {
+    BENCH_FORCING,   // positioning until the forced attack starts
+    BENCH_ATTACKING, // attack running, bot fights
+    BENCH_GAP,
+    BENCH_DONE,
+} BenchPhase;
+
+static BenchPhase phase = BENCH_FORCING;
+static int attackIndex = 0;
+static float phaseTimer = 0.0f;
+static float simTime = 0.0f;
+static uint16_t attacksSeen = 0;   // bit per BENCH_ATTACKS entry
+
+static uint32_t frameHist[BENCH_HIST_BUCKETS];
+static uint64_t frameTotalUs = 0;
+static uint32_t frameMinUs = UINT32_MAX;
+static uint32_t frameCount = 0;
+static uint32_t frameCounter = 0;
+static uint64_t lastFrameUs = 0;
+// A profile sync (rspq_wait) at the end of a frame is timed as part of the
+// next one, which also starts with an idle RSP; those frames are counted
+// here instead of in the frame time stats
+static uint32_t syncFrames = 0;
+static bool syncPending = false;
+
+// Collision counters per frame (dev_frame_update doesn't run in bench builds)
+static uint64_t collisionTotal[COLLISION_STAT_COUNT];
+static uint32_t collisionPeak[COLLISION_STAT_COUNT];
+static uint32_t narrowPeak = 0;
+
+// Animation LOD totals over the measured frames
+static float animUpdateUs = 0.0f;
+static float animSavedUs = 0.0f;
+static float animUpdates = 0.0f;
+static float animSkips = 0.0f;
+
+static uint64_t rspBusyTicks = 0;
+static uint64_t rdpBusyTicks = 0;
+static uint32_t profiledFrames = 0;
+
+// Largest heap use seen at a fixed step or frame boundary. Not the allocator's
+// high-water mark: memory allocated and freed between two samples is missed.
+static int heapSampledMax = 0;
+
+static uint16_t lastHeld = 0;
+
+// isAttacking drops before some attack states (combo, ground sweep) hand
+// control back to the chase/strafe logic, so the state is checked as well.
+static bool bench_boss_busy(const Boss *boss)
+{
+    return boss->isAttacking || boss_ai_state_is_attack(boss->state);
+}
+
+static void bench_sample_heap(void)
+{
+    heap_stats_t heap;
+    sys_get_heap_stats(&heap);
+    if (heap.used > heapSampledMax) heapSampledMax = heap.used;
+}
+
+static void bench_start_attack(void)
+{
+    Boss *boss = boss_get_instance();
+    const BenchAttack *a = &BENCH_ATTACKS[attackIndex];
+    if (a->phase2) boss->phaseIndex = 2;
+    boss_ai_force_attack(boss, a->id);
+    phase = BENCH_FORCING;
+    phaseTimer = 0.0f;
+}
+
+void bench_init(void)
+{
+    if (!DEV_MODE) debug_init_isviewer();
+
+    scene_start_fight_skip_intro();
+
+    attackIndex = 0;
+    simTime = 0.0f;
+    attacksSeen = 0;
+    bench_start_attack();
+
+    // Every report covers one run (the host sim starts one per fight)
+    memset(frameHist, 0, sizeof(frameHist));
+    frameTotalUs = 0;
+    frameMinUs = UINT32_MAX;
+    frameCount = 0;
+    frameCounter = 0;
+    syncFrames = 0;
+    syncPending = false;
+    memset(collisionTotal, 0, sizeof(collisionTotal));
+    memset(collisionPeak, 0, sizeof(collisionPeak));
+    narrowPeak = 0;
+    animUpdateUs = 0.0f;
+    animSavedUs = 0.0f;
+    animUpdates = 0.0f;
+    animSkips = 0.0f;
+    rspBusyTicks = 0;
+    rdpBusyTicks = 0;
+    profiledFrames = 0;
+    heapSampledMax = 0;
+    lastHeld = 0;
+
+    rspq_profile_reset();
+    lastFrameUs = get_ticks_us();
+    debugf("@BENCH_START duration_s=%.0f attacks=%d\n", BENCH_DURATION_S, BENCH_ATTACK_COUNT);
+}
+
+void bench_fixed_step(void)
+{
+    if (phase == BENCH_DONE) return;
+
+    Boss *boss = boss_get_instance();
+    bench_sample_heap();
+    simTime += deltaTime;
+    phaseTimer += deltaTime;
+
+    // Nobody dies during a benchmark (also keeps the phase 2 cutscene from firing)
+    character.health = character.maxHealth;
+    boss->health = boss->maxHealth;
+
+    switch (phase) {
+        case BENCH_FORCING: {
+            if (boss_ai_get_forced_attack() == BOSS_ATTACK_COUNT) {
+                attacksSeen |= (uint16_t)(1u << attackIndex);
+                phase = BENCH_ATTACKING;
+                phaseTimer = 0.0f;
+                break;
+            }
+            if (phaseTimer >= BENCH_FORCE_TIMEOUT_S) {
+                debugf("@BENCH_WARN attack %d did not start\n", BENCH_ATTACKS[attackIndex].id);
+                boss_ai_force_attack(boss, BOSS_ATTACK_COUNT);
+                phase = BENCH_GAP;
+                phaseTimer = 0.0f;
+                break;
+            }
+            // Re-arm every step: other attacks ending can reset combo flags
+            boss_ai_force_attack(boss, BENCH_ATTACKS[attackIndex].id);
+
+            // Hold both fighters on the room's X axis at the attack's distance
+            float half = BENCH_ATTACKS[attackIndex].dist * 0.5f;
+            boss->pos[0] = half;
+            boss->pos[2] = 0.0f;
+            character.pos[0] = -half;
+            character.pos[2] = 0.0f;
+        } break;
+        case BENCH_ATTACKING:
+            if (!bench_boss_busy(boss)) {
+                phase = BENCH_GAP;
+                phaseTimer = 0.0f;
+            }
+            break;
+        case BENCH_GAP:
+            if (phaseTimer >= BENCH_ATTACK_GAP_S && !bench_boss_busy(boss)) {
+                attackIndex = (attackIndex + 1) % BENCH_ATTACK_COUNT;
+                bench_start_attack();
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void bench_filter_inputs(joypad_inputs_t *inputs, joypad_buttons_t *pressed, joypad_buttons_t *released)
+{
+    joypad_buttons_t held = {0};
+    int8_t stickY = 0;
+
+    if (phase == BENCH_ATTACKING || phase == BENCH_GAP) {
+        // Press forward into the boss (lock-on is active), slash, roll now and then
+        stickY = 70;
+        float t = simTime;
+        held.b = (t - (float)(int)(t / 0.5f) * 0.5f) < 0.07f;
+        held.a = (t - (float)(int)(t / 3.0f) * 3.0f) < 0.07f;
+    }
+
+    inputs->btn = held;
+    inputs->stick_x = 0;
+    inputs->stick_y = stickY;
+    inputs->cstick_x = 0;
+    inputs->cstick_y = 0;
+    pressed->raw = held.raw & (uint16_t)~lastHeld;
+    released->raw = lastHeld & (uint16_t)~held.raw;
+    lastHeld = held.raw;
+}
+
+static void bench_collect_profile(void)
+{
+    rspq_profile_data_t data;
+    rspq_wait();
+    syncPending = true;
+    rspq_profile_get_data(&data);
+    rspq_profile_reset();
+    if (data.frame_count == 0) return;
+
+    uint64_t idle = 0;
+    for (int i = 0; i < RSPQ_PROFILE_SLOT_COUNT; i++) {
+        if (i == RSPQ_PROFILE_CSLOT_WAIT_CPU || i == RSPQ_PROFILE_CSLOT_WAIT_RDP
+            || i == RSPQ_PROFILE_CSLOT_WAIT_RDP_SYNCFULL || i == RSPQ_PROFILE_CSLOT_WAIT_RDP_SYNCFULL_MULTI) {
+            idle += data.slots[i].total_ticks;
+        }
+    }
+    rspBusyTicks += data.total_ticks > idle ? data.total_ticks - idle : 0;
+    rdpBusyTicks += data.rdp_busy_ticks;
+    profiledFrames += data.frame_count;
+}
+
+static float bench_percentile_ms(float pct)
+{
+    uint32_t target = (uint32_t)((float)frameCount * pct);
+    uint32_t acc = 0;
+    for (int i = 0; i < BENCH_HIST_BUCKETS; i++) {
+        acc += frameHist[i];
+        if (acc > target) return (float)((i + 1) * BENCH_HIST_BUCKET_US) / 1000.0f;
+    }
+    return (float)(BENCH_HIST_BUCKETS * BENCH_HIST_BUCKET_US) / 1000.0f;
+}
+
+static void bench_report(void)
+{
+    const float RCP_US = 1000000.0f / (float)RCP_FREQUENCY;
+    float pf = profiledFrames ? (float)profiledFrames : 1.0f;
+    int seen = 0;
+    for (int i = 0; i < BENCH_ATTACK_COUNT; i++) {
+        if (attacksSeen & (1u << i)) seen++;
+    }
+
+    debugf("@BENCH frames=%lu sync_frames=%lu sim_s=%.1f min_ms=%.3f avg_ms=%.3f p99_ms=%.3f rsp_busy_ms=%.3f rdp_busy_ms=%.3f heap_sampled_max_kb=%d attacks=%d/%d\n",
+        (unsigned long)frameCount, (unsigned long)syncFrames, simTime,
+        frameCount ? (float)frameMinUs / 1000.0f : 0.0f,
+        frameCount ? (float)frameTotalUs / (float)frameCount / 1000.0f : 0.0f,
+        bench_percentile_ms(0.99f),
+        (float)rspBusyTicks * RCP_US / pf / 1000.0f,
+        (float)rdpBusyTicks * RCP_US / pf / 1000.0f,
+        heapSampledMax / 1024, seen, BENCH_ATTACK_COUNT);
+    uint64_t narrowTotal = 0;
+    for (int s = COLLISION_STAT_NARROW_FIRST; s <= COLLISION_STAT_NARROW_LAST; s++) {
+        narrowTotal += collisionTotal[s];
+    }
+    float fc = frameCount ? (float)frameCount : 1.0f;
+    debugf("@BENCH_COLLISION broad_avg=%.1f broad_peak=%lu broad_dropped=%llu narrow_avg=%.1f narrow_peak=%lu cap_cap_avg=%.1f cap_obb_avg=%.1f cap_aabb_avg=%.1f mesh_polys_avg=%.1f mesh_polys_peak=%lu ray_avg=%.1f room_passes_avg=%.2f msa_walls_avg=%.1f msa_walls_peak=%lu\n",
+        (float)collisionTotal[COLLISION_STAT_BROAD_TESTS] / fc, (unsigned long)collisionPeak[COLLISION_STAT_BROAD_TESTS],
+        (unsigned long long)collisionTotal[COLLISION_STAT_BROAD_DROPPED],
+        (float)narrowTotal / fc, (unsigned long)narrowPeak,
+        (float)collisionTotal[COLLISION_STAT_CAPSULE_CAPSULE] / fc,
+        (float)collisionTotal[COLLISION_STAT_CAPSULE_OBB] / fc,
+        (float)collisionTotal[COLLISION_STAT_CAPSULE_AABB] / fc,
+        (float)collisionTotal[COLLISION_STAT_CAPSULE_MESH] / fc, (unsigned long)collisionPeak[COLLISION_STAT_CAPSULE_MESH],
+        (float)collisionTotal[COLLISION_STAT_RAY] / fc,
+        (float)collisionTotal[COLLISION_STAT_ROOM_PASSES] / fc,
+        (float)collisionTotal[COLLISION_STAT_MSA_WALL_CHECKS] / fc, (unsigned long)collisionPeak[COLLISION_STAT_MSA_WALL_CHECKS]);
+    debugf("@BENCH_ANIM update_us_avg=%.1f saved_us_avg=%.1f updates_avg=%.2f skips_avg=%.2f\n",
+        animUpdateUs / fc, animSavedUs / fc, animUpdates / fc, animSkips / fc);
+    debugf("@BENCH_DONE\n");
+}
+
+void bench_frame_end(void)
+{
+    collision_stats_frame_end();
+    anim_sched_frame_end();
+    if (phase == BENCH_DONE) return;
+
+    rspq_profile_next_frame();
+
+    uint64_t now = get_ticks_us();
+    uint32_t frameUs = (uint32_t)(now - lastFrameUs);
+    lastFrameUs = now;
+
+    bool synced = syncPending;
+    syncPending = false;
+    if (++frameCounter > BENCH_WARMUP_FRAMES && synced) {
+        syncFrames++;
+    } else if (frameCounter > BENCH_WARMUP_FRAMES) {
+        int bucket = (int)(frameUs / BENCH_HIST_BUCKET_US);
+        if (bucket >= BENCH_HIST_BUCKETS) bucket = BENCH_HIST_BUCKETS - 1;
+        frameHist[bucket]++;
+        frameTotalUs += frameUs;
+        if (frameUs < frameMinUs) frameMinUs = frameUs;
+        frameCount++;
+    }
+
+    if (frameCounter > BENCH_WARMUP_FRAMES) {
+        uint32_t counts[COLLISION_STAT_COUNT];
+        collision_stats_get_last_frame(counts);
+        for (int s = 0; s < COLLISION_STAT_COUNT; s++) {
+            collisionTotal[s] += counts[s];
+            if (counts[s] > collisionPeak[s]) collisionPeak[s] = counts[s];
+        }
+        uint32_t narrow = collision_stats_narrow_total(counts);
+        if (narrow > narrowPeak) narrowPeak = narrow;
+
+        AnimSchedStats anim;
+        anim_sched_get_last_frame(&anim);
+        animUpdateUs += anim.updateAvgUs;
+        animSavedUs += anim.savedAvgUs;
+        animUpdates += anim.updatesAvg;
+        animSkips += anim.skipsAvg;
+    }
+
+    bench_sample_heap();
+
+    if ((frameCounter % 30) == 0) bench_collect_profile();
+
+    if (simTime >= BENCH_DURATION_S) {
+        bench_collect_profile();
+        bench_report();
+        phase = BENCH_DONE;
+    }
+}
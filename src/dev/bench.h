@@ -0,0 +1,20 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <libdragon.h>
+#include "globals.h"
+
+// Scripted boss-fight benchmark (`make bench`, BENCH_MODE builds only).
+// Boots straight into the fight, drives the knight with a bot, forces every
+// BossAttackId in turn and prints a single "@BENCH ..." result line over the
+// debug log after BENCH_DURATION_S of simulated time.
+
+#define BENCH_DURATION_S 240.0f   // simulated seconds
+#define BENCH_WARMUP_FRAMES 60    // frames ignored by the frame time stats
+
+void bench_init(void);
+void bench_fixed_step(void);
+void bench_frame_end(void);
+void bench_filter_inputs(joypad_inputs_t *inputs, joypad_buttons_t *pressed, joypad_buttons_t *released);
+
+#endif
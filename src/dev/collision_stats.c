@@ -0,0 +1,81 @@
+#include "collision_stats.h"
+
+#include <string.h>
+
+static const char *STAT_NAMES[COLLISION_STAT_COUNT] = {
+    "broad",
+    "broad hit",
+    "broad drop",
+    " cap/cap",
+    " cap/obb",
+    " cap/aabb",
+    " cap/mesh",
+    " ray",
+    "room pass",
+    "msa walls",
+};
+
+// Counts for the frame in progress
+uint32_t collisionStatCur[COLLISION_STAT_COUNT];
+
+// Rolling history, one row per finished frame.
+static uint32_t ring[COLLISION_STATS_HISTORY][COLLISION_STAT_COUNT];
+static int ringHead = 0;
+static int ringFilled = 0;
+
+void collision_stats_frame_end(void)
+{
+    memcpy(ring[ringHead], collisionStatCur, sizeof(collisionStatCur));
+    ringHead = (ringHead + 1) % COLLISION_STATS_HISTORY;
+    if (ringFilled < COLLISION_STATS_HISTORY) ringFilled++;
+
+    memset(collisionStatCur, 0, sizeof(collisionStatCur));
+}
+
+uint32_t collision_stats_narrow_total(const uint32_t counts[COLLISION_STAT_COUNT])
+{
+    uint32_t total = 0;
+    for (int s = COLLISION_STAT_NARROW_FIRST; s <= COLLISION_STAT_NARROW_LAST; s++) {
+        total += counts[s];
+    }
+    return total;
+}
+
+void collision_stats_get_summary(CollisionStatsSummary *out)
+{
+    memset(out, 0, sizeof(*out));
+    out->frameCount = ringFilled;
+    if (ringFilled == 0) return;
+
+    for (int s = 0; s < COLLISION_STAT_COUNT; s++) {
+        uint64_t sum = 0;
+        uint32_t peak = 0;
+        for (int f = 0; f < ringFilled; f++) {
+            sum += ring[f][s];
+            if (ring[f][s] > peak) peak = ring[f][s];
+        }
+        out->avg[s] = (float)sum / (float)ringFilled;
+        out->peak[s] = peak;
+    }
+
+    uint64_t narrowSum = 0;
+    for (int f = 0; f < ringFilled; f++) {
+        uint32_t narrow = collision_stats_narrow_total(ring[f]);
+        narrowSum += narrow;
+        if (narrow > out->narrowPeak) out->narrowPeak = narrow;
+    }
+    out->narrowAvg = (float)narrowSum / (float)ringFilled;
+}
+
+void collision_stats_get_last_frame(uint32_t out[COLLISION_STAT_COUNT])
+{
+    int last = (ringHead + COLLISION_STATS_HISTORY - 1) % COLLISION_STATS_HISTORY;
+    for (int s = 0; s < COLLISION_STAT_COUNT; s++) {
+        out[s] = (ringFilled > 0) ? ring[last][s] : 0;
+    }
+}
+
+const char *collision_stat_name(CollisionStatId id)
+{
+    return (id < COLLISION_STAT_COUNT) ? STAT_NAMES[id] : "?";
+}
@@ -0,0 +1,55 @@
+#ifndef COLLISION_STATS_H
+#define COLLISION_STATS_H
+
+#include <stdint.h>
+#include "globals.h"
+
+// Per-frame collision work counters for the dev Collision pane and the perf log.
+// Usage:
+//   collision_stat_add(COLLISION_STAT_CAPSULE_OBB, 1);
+// Counts accumulate over the frame's fixed steps and are rolled into a history
+// by collision_stats_frame_end(). Like the CPU timers they vanish when DEV_MODE is false.
+
+#define COLLISION_STATS_HISTORY 32 // frames kept in the rolling ring buffer
+
+typedef enum {
+    COLLISION_STAT_BROAD_TESTS,     // body bounds tested by collision_world queries/pairs
+    COLLISION_STAT_BROAD_HITS,      // candidates those tests handed on
+    COLLISION_STAT_BROAD_DROPPED,   // candidates past a caller's output limit (should stay 0)
+    // Narrowphase tests by shape pair (their sum is the narrow total)
+    COLLISION_STAT_CAPSULE_CAPSULE,
+    COLLISION_STAT_CAPSULE_OBB,
+    COLLISION_STAT_CAPSULE_AABB,
+    COLLISION_STAT_CAPSULE_MESH,    // collision mesh wall planes visited
+    COLLISION_STAT_RAY,             // segment casts: wall triangles and room boxes tested
+    COLLISION_STAT_ROOM_PASSES,     // push-outs + sweep/slide passes of the room move
+    COLLISION_STAT_MSA_WALL_CHECKS, // ribbon wall segments tested (also counted as capsule/obb)
+    COLLISION_STAT_COUNT
+} CollisionStatId;
+
+#define COLLISION_STAT_NARROW_FIRST COLLISION_STAT_CAPSULE_CAPSULE
+#define COLLISION_STAT_NARROW_LAST  COLLISION_STAT_RAY
+
+typedef struct {
+    float avg[COLLISION_STAT_COUNT];
+    uint32_t peak[COLLISION_STAT_COUNT];
+    float narrowAvg;
+    uint32_t narrowPeak;
+    int frameCount;        // valid frames in the window
+} CollisionStatsSummary;
+
+extern uint32_t collisionStatCur[COLLISION_STAT_COUNT];
+
+void collision_stats_frame_end(void);
+void collision_stats_get_summary(CollisionStatsSummary *out);
+void collision_stats_get_last_frame(uint32_t out[COLLISION_STAT_COUNT]);
+uint32_t collision_stats_narrow_total(const uint32_t counts[COLLISION_STAT_COUNT]);
+const char *collision_stat_name(CollisionStatId id);
+
+static inline void collision_stat_add(CollisionStatId id, uint32_t n)
+{
+    if (!DEV_MODE) return;
+    collisionStatCur[id] += n;
+}
+
+#endif
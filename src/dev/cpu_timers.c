@@ -0,0 +1,98 @@
+#include "cpu_timers.h"
+
+#include <string.h>
+
+static const char *TIMER_NAMES[CPU_TIMER_COUNT] = {
+    "camera",
+    "scene upd",
+    " character",
+    " boss",
+    "  boss ai",
+    " msa",
+    " collision",
+    "scene draw",
+    "menu draw",
+};
+
+// Accumulators for the frame in progress (a timer may fire several times per
+// frame, e.g. once per fixed step).
+static uint32_t curTicks[CPU_TIMER_COUNT];
+static uint16_t curCalls[CPU_TIMER_COUNT];
+
+// Rolling history, one row per finished frame.
+static uint32_t ringTicks[CPU_TIMER_HISTORY][CPU_TIMER_COUNT];
+static uint16_t ringCalls[CPU_TIMER_HISTORY][CPU_TIMER_COUNT];
+static uint32_t ringFrameTicks[CPU_TIMER_HISTORY];
+static int ringHead = 0;
+static int ringFilled = 0;
+
+static uint32_t lastFrameEnd = 0;
+static bool lastFrameEndValid = false;
+
+void cpu_timer_add(CpuTimerId id, uint32_t ticks)
+{
+    curTicks[id] += ticks;
+    curCalls[id]++;
+}
+
+void cpu_timer_frame_end(void)
+{
+    uint32_t now = C0_COUNT();
+
+    memcpy(ringTicks[ringHead], curTicks, sizeof(curTicks));
+    memcpy(ringCalls[ringHead], curCalls, sizeof(curCalls));
+    ringFrameTicks[ringHead] = lastFrameEndValid ? (now - lastFrameEnd) : 0;
+
+    ringHead = (ringHead + 1) % CPU_TIMER_HISTORY;
+    if (ringFilled < CPU_TIMER_HISTORY) ringFilled++;
+
+    memset(curTicks, 0, sizeof(curTicks));
+    memset(curCalls, 0, sizeof(curCalls));
+
+    lastFrameEnd = now;
+    lastFrameEndValid = true;
+}
+
+void cpu_timer_get_stats(CpuTimerStats *out)
+{
+    memset(out, 0, sizeof(*out));
+    out->frameCount = ringFilled;
+    if (ringFilled == 0) return;
+
+    for (int t = 0; t < CPU_TIMER_COUNT; t++) {
+        uint64_t sum = 0;
+        uint32_t peak = 0;
+        uint32_t calls = 0;
+        for (int f = 0; f < ringFilled; f++) {
+            uint32_t ticks = ringTicks[f][t];
+            sum += ticks;
+            if (ticks > peak) peak = ticks;
+            calls += ringCalls[f][t];
+        }
+        out->avgUs[t] = (uint32_t)TICKS_TO_US(sum / ringFilled);
+        out->peakUs[t] = (uint32_t)TICKS_TO_US((uint64_t)peak);
+        out->avgCalls[t] = (float)calls / (float)ringFilled;
+    }
+
+    uint64_t frameSum = 0;
+    uint32_t framePeak = 0;
+    for (int f = 0; f < ringFilled; f++) {
+        frameSum += ringFrameTicks[f];
+        if (ringFrameTicks[f] > framePeak) framePeak = ringFrameTicks[f];
+    }
+    out->frameAvgUs = (uint32_t)TICKS_TO_US(frameSum / ringFilled);
+    out->framePeakUs = (uint32_t)TICKS_TO_US((uint64_t)framePeak);
+}
+
+void cpu_timer_get_last_frame(uint32_t outUs[CPU_TIMER_COUNT])
+{
+    int last = (ringHead + CPU_TIMER_HISTORY - 1) % CPU_TIMER_HISTORY;
+    for (int t = 0; t < CPU_TIMER_COUNT; t++) {
+        outUs[t] = (ringFilled > 0) ? (uint32_t)TICKS_TO_US((uint64_t)ringTicks[last][t]) : 0;
+    }
+}
+
+const char *cpu_timer_name(CpuTimerId id)
+{
+    return (id < CPU_TIMER_COUNT) ? TIMER_NAMES[id] : "?";
+}
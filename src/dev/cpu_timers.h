@@ -0,0 +1,57 @@
+#ifndef CPU_TIMERS_H
+#define CPU_TIMERS_H
+
+#include <stdint.h>
+#include <libdragon.h>
+#include "globals.h"
+
+// Scoped CPU timers read straight from the COP0 count register.
+// Usage:
+//   uint32_t t = cpu_timer_begin();
+//   character_update();
+//   cpu_timer_end(CPU_TIMER_CHARACTER_UPDATE, t);
+// Both helpers collapse to nothing when DEV_MODE is false.
+
+#define CPU_TIMER_HISTORY 32 // frames kept in the rolling ring buffer
+
+typedef enum {
+    CPU_TIMER_CAMERA_UPDATE,
+    CPU_TIMER_SCENE_UPDATE,
+    CPU_TIMER_CHARACTER_UPDATE,
+    CPU_TIMER_BOSS_UPDATE,
+    CPU_TIMER_BOSS_AI_UPDATE,
+    CPU_TIMER_MSA_UPDATE,
+    CPU_TIMER_COLLISION_UPDATE,
+    CPU_TIMER_SCENE_DRAW,
+    CPU_TIMER_MENU_DRAW,
+    CPU_TIMER_COUNT
+} CpuTimerId;
+
+typedef struct {
+    uint32_t avgUs[CPU_TIMER_COUNT];
+    uint32_t peakUs[CPU_TIMER_COUNT];
+    float avgCalls[CPU_TIMER_COUNT];
+    uint32_t frameAvgUs;   // whole CPU frame, frame_end to frame_end
+    uint32_t framePeakUs;
+    int frameCount;        // valid frames in the window
+} CpuTimerStats;
+
+void cpu_timer_add(CpuTimerId id, uint32_t ticks);
+void cpu_timer_frame_end(void);
+void cpu_timer_get_stats(CpuTimerStats *out);
+void cpu_timer_get_last_frame(uint32_t outUs[CPU_TIMER_COUNT]);
+const char *cpu_timer_name(CpuTimerId id);
+
+static inline uint32_t cpu_timer_begin(void)
+{
+    if (!DEV_MODE) return 0;
+    return C0_COUNT();
+}
+
+static inline void cpu_timer_end(CpuTimerId id, uint32_t start)
+{
+    if (!DEV_MODE) return;
+    cpu_timer_add(id, C0_COUNT() - start);
+}
+
+#endif
@@ -6,6 +6,11 @@
 #define DEBUG_OVERLAY_H
 
 #include <libdragon.h>
+#include "cpu_timers.h"
+#include "collision_stats.h"
+#include "hitch_detector.h"
+#include "anim_scheduler.h"
+#include "quality_governor.h"
 
 typedef struct {
   uint32_t calls;
@@ -327,4 +332,186 @@ void debug_draw_perf_overlay(float measuredFps)
     }
 }
 
+static CpuTimerStats cpu_timer_stats;
+static AnimSchedStats anim_sched_stats;
+
+void debug_draw_cpu_overlay(void)
+{
+    if(cpu_timer_stats.frameCount == 0)return;
+
+    const float TABLE_POS_X = 104;
+    const float TABLE_POS_Y = 12;
+    const float BAR_POS_Y = 178;
+
+    float posY = TABLE_POS_Y;
+    t3d_debug_print(TABLE_POS_X, posY, "CPU        Calls  Avg   Peak");
+    posY += 12;
+
+    for(int i = 0; i < CPU_TIMER_COUNT; i++)
+    {
+      rdpq_set_prim_color(THEME_COLORS[i % 8]);
+      t3d_debug_print(TABLE_POS_X-10, posY, "*");
+      rdpq_set_prim_color(RGBA32(0xFF, 0xFF, 0xFF, 0xFF));
+      t3d_debug_printf(TABLE_POS_X, posY, "%-10.10s %4.1f %5lu %6lu#",
+        cpu_timer_name(i), cpu_timer_stats.avgCalls[i],
+        cpu_timer_stats.avgUs[i], cpu_timer_stats.peakUs[i]);
+      posY += 10;
+    }
+
+    posY += 2; float endSectionY = posY;
+    posY += 1;
+
+    rdpq_set_prim_color((color_t){0x99, 0x99, 0xEE, 0xFF});
+    t3d_debug_printf(TABLE_POS_X, posY, "Frame           %5lu %6lu#",
+      cpu_timer_stats.frameAvgUs, cpu_timer_stats.framePeakUs);
+    rdpq_set_prim_color((color_t){0x99, 0x99, 0x99, 0xFF});
+    t3d_debug_printf(TABLE_POS_X, posY + 12, "(f:%d)", cpu_timer_stats.frameCount);
+    t3d_debug_printf(TABLE_POS_X + 48, posY + 12, "Q:%s %.1fms",
+      quality_level_name(quality_governor_get_level()), quality_governor_get_smoothed_ms());
+    t3d_debug_printf(TABLE_POS_X, posY + 24, "Anim %.0f# saved %.0f# (%.1f/%.1f)",
+      anim_sched_stats.updateAvgUs, anim_sched_stats.savedAvgUs,
+      anim_sched_stats.updatesAvg, anim_sched_stats.skipsAvg);
+    rdpq_set_prim_color(RGBA32(0xFF, 0xFF, 0xFF, 0xFF));
+
+    // Frame time bars (avg / peak) against the 30fps budget
+    float timeScale = 1.0f / (200.0f); // 1 / (us per pixel)
+    float barPos[2] = {48, BAR_POS_Y + 16};
+    const float BAR_HEIGHT = 10;
+    const float BAR_BORDER = 2;
+    float posFps30 = (1'000'000.0f / 30.0f) * timeScale;
+    float posFps20 = (1'000'000.0f / 20.0f) * timeScale;
+
+    float avgWidth = fminf((float)cpu_timer_stats.frameAvgUs * timeScale, posFps20);
+    float peakWidth = fminf((float)cpu_timer_stats.framePeakUs * timeScale, posFps20);
+
+    rdpq_mode_combiner(RDPQ_COMBINER_TEX_FLAT);
+    rdpq_set_prim_color(RGBA32(0xFF, 0xFF, 0xFF, 0xFF));
+    t3d_debug_print(barPos[0]-30, BAR_POS_Y + 4 + (BAR_HEIGHT+BAR_BORDER), "Avg");
+    t3d_debug_print(barPos[0]-30, BAR_POS_Y + 4 + (BAR_HEIGHT+BAR_BORDER)*2, "Max");
+
+    rdpq_set_prim_color(RGBA32(0xAA, 0xAA, 0xAA, 0xFF));
+    float fpsMarkerY = BAR_POS_Y + 8 + (BAR_HEIGHT+BAR_BORDER)*3;
+    t3d_debug_print(barPos[0]-30, fpsMarkerY, "FPS Target:");
+    t3d_debug_printf(barPos[0] + posFps30 - 20, fpsMarkerY, "30");
+    t3d_debug_printf(barPos[0] + posFps20 - 20, fpsMarkerY, "20");
+
+    // ======== FILL MODE ========
+
+    rdpq_set_mode_fill(RGBA32(0x22, 0x22, 0x22, 0xFF));
+
+    rdpq_set_fill_color(RGBA32(44, 44, 44, 0xFF));
+    debug_draw_line_hori(94, TABLE_POS_Y+11, 210);
+    debug_draw_line_hori(94, endSectionY,    210);
+
+    rdpq_fill_rectangle(barPos[0]-2, barPos[1]-2, barPos[0]+posFps20, barPos[1] + (BAR_HEIGHT + BAR_BORDER)*2);
+
+    debug_draw_color_rect(barPos[0], barPos[1], avgWidth, BAR_HEIGHT, RGBA32(0x44, 0x44, 0xAA, 0xFF));
+    debug_draw_color_rect(barPos[0], barPos[1] + BAR_HEIGHT + BAR_BORDER, peakWidth, BAR_HEIGHT, RGBA32(0xAA, 0x44, 0x44, 0xFF));
+
+    rdpq_set_fill_color(RGBA32(0xFF, 0xFF, 0xFF, 0xFF));
+    debug_draw_line_vert(barPos[0] + posFps30, barPos[1]-BAR_BORDER, BAR_HEIGHT + 30);
+    debug_draw_line_vert(barPos[0] + posFps20, barPos[1]-BAR_BORDER, BAR_HEIGHT + 30);
+
+    rdpq_set_mode_standard();
+}
+
+static CollisionStatsSummary collision_stats_summary;
+
+// Collision work per frame, drawn under the Collision pane toggles
+void debug_draw_collision_stats(float posX, float posY)
+{
+    if(collision_stats_summary.frameCount == 0)return;
+
+    t3d_debug_print(posX, posY, "Tests/frame  Avg   Peak");
+    posY += 12;
+
+    for(int i = 0; i < COLLISION_STAT_COUNT; i++)
+    {
+      t3d_debug_printf(posX, posY, "%-10.10s %6.1f %6lu",
+        collision_stat_name(i), collision_stats_summary.avg[i], collision_stats_summary.peak[i]);
+      posY += 10;
+      if(i == COLLISION_STAT_CAPSULE_CAPSULE - 1)
+      {
+        rdpq_set_prim_color((color_t){0x99, 0x99, 0xEE, 0xFF});
+        t3d_debug_printf(posX, posY, "%-10.10s %6.1f %6lu",
+          "narrow", collision_stats_summary.narrowAvg, collision_stats_summary.narrowPeak);
+        rdpq_set_prim_color(RGBA32(0xFF, 0xFF, 0xFF, 0xFF));
+        posY += 10;
+      }
+    }
+
+    rdpq_set_prim_color((color_t){0x99, 0x99, 0x99, 0xFF});
+    t3d_debug_printf(posX, posY + 2, "(f:%d)", collision_stats_summary.frameCount);
+    rdpq_set_prim_color(RGBA32(0xFF, 0xFF, 0xFF, 0xFF));
+}
+
+void debug_draw_frame_histogram(void)
+{
+    const float TABLE_POS_X = 104;
+    const float TABLE_POS_Y = 12;
+    const float BAR_MAX_W = 96;
+
+    const uint32_t *hist = hitch_detector_get_histogram();
+    uint32_t total = 0;
+    uint32_t maxCount = 1;
+    for(int i = 0; i < HITCH_HIST_BUCKETS; i++)
+    {
+      total += hist[i];
+      if(hist[i] > maxCount) maxCount = hist[i];
+    }
+
+    float posY = TABLE_POS_Y;
+    t3d_debug_printf(TABLE_POS_X, posY, "Frame ms   Count  (budget %lu#)", hitch_detector_get_budget_us());
+    posY += 12;
+
+    float barsY = posY;
+    for(int i = 0; i < HITCH_HIST_BUCKETS; i++)
+    {
+      int lo = (i * HITCH_HIST_BUCKET_US) / 1000;
+      if(i == HITCH_HIST_BUCKETS - 1) {
+        t3d_debug_printf(TABLE_POS_X, posY, "%3d+ %7lu", lo, hist[i]);
+      } else {
+        t3d_debug_printf(TABLE_POS_X, posY, "%3d  %7lu", lo, hist[i]);
+      }
+      posY += 10;
+    }
+
+    posY += 3;
+    rdpq_set_prim_color((color_t){0x99, 0x99, 0xEE, 0xFF});
+    t3d_debug_printf(TABLE_POS_X, posY, "Frames %lu  Hitches %lu", total, hitch_detector_get_hitch_count());
+    rdpq_set_prim_color(RGBA32(0xFF, 0xFF, 0xFF, 0xFF));
+    posY += 12;
+
+    const HitchSnapshot *last = hitch_detector_get_last();
+    if(last)
+    {
+      rdpq_set_prim_color(RGBA32(0xAA, 0xAA, 0xAA, 0xFF));
+      t3d_debug_printf(TABLE_POS_X, posY, "Last: %lu# g%d c%d", last->frameUs, last->gameState, last->cutsceneState);
+      posY += 10;
+      if(last->bossPresent) {
+        t3d_debug_printf(TABLE_POS_X, posY, "%-.22s msa%d", last->bossAttackName ? last->bossAttackName : "-", last->msaPhase);
+      }
+      rdpq_set_prim_color(RGBA32(0xFF, 0xFF, 0xFF, 0xFF));
+    }
+
+    // ======== FILL MODE ========
+
+    rdpq_set_mode_fill(RGBA32(0x22, 0x22, 0x22, 0xFF));
+
+    rdpq_set_fill_color(RGBA32(44, 44, 44, 0xFF));
+    debug_draw_line_hori(94, TABLE_POS_Y+11, 210);
+
+    uint32_t budgetBucket = hitch_detector_get_budget_us() / HITCH_HIST_BUCKET_US;
+    for(int i = 0; i < HITCH_HIST_BUCKETS; i++)
+    {
+      if(hist[i] == 0) continue;
+      float w = (float)hist[i] / (float)maxCount * BAR_MAX_W;
+      if(w < 1) w = 1;
+      color_t color = ((uint32_t)i >= budgetBucket) ? RGBA32(0xAA, 0x44, 0x44, 0xFF) : RGBA32(0x44, 0x44, 0xAA, 0xFF);
+      debug_draw_color_rect(TABLE_POS_X + 100, barsY + i * 10, w, 7, color);
+    }
+
+    rdpq_set_mode_standard();
+}
+
 #endif //DEBUG_OVERLAY_H
\ No newline at end of file
@@ -14,10 +14,12 @@
 #include "camera_controller.h"
 #include "character.h"
 #include "game/bosses/boss.h"
+#include "scene.h"
 
 #include "game_lighting.h"
 #include "game_time.h"
 #include "joypad_utility.h"
+#include "input_replay.h"
 
 #include "globals.h"
 
@@ -26,6 +28,7 @@ bool debugDraw = true;
 static bool displayMetrics = false;
 static bool requestDisplayMetrics = false;
 static float last3dFPS = 0.0f;
+static int profilerPage = 0; // Profiler pane: 0 = RCP, 1 = CPU timers, 2 = frame histogram
 
 static float lightAzimuth = 0.0f;   // Rotation around Y axis (left/right)
 static float lightElevation = 0.0f; // Rotation around X axis (up/down)
@@ -38,8 +41,9 @@ enum {
     DEV_COLLISION,
     DEV_RSPQ_PROFILER,
     DEV_MEMORY_DEBUG,
+    DEV_INPUT_REPLAY,
 };
-static int rowCount = 6;
+static int rowCount = 7;
 static int controlling = DEV_NONE;
 
 static bool toggleDevMenu = false;
@@ -56,6 +60,8 @@ static const int sceneCount = 1;
 static bool inCategoryScreen = false;
 
 static bool toggleColliders = false;
+static bool showCollisionGridQuery = false; // cells + walls the character capsule query tests
+static bool showCollisionGrid = false;      // every collision grid cell that holds walls
 
 // Button state tracking for C-pad Up+Down toggle
 static bool lastCUpPressed = false;
@@ -85,6 +91,7 @@ void dev_tools_init()
 {
     debug_init_isviewer();
     debug_init_usblog();
+    debug_init_sdfs("sd:/", -1);
     console_init();
     console_set_debug(true);
     profile_data.frame_count = 0;
@@ -108,6 +115,10 @@ void dev_models_init()
 void dev_frame_update()
 {
     rspq_profile_next_frame();
+    cpu_timer_frame_end();
+    collision_stats_frame_end();
+    anim_sched_frame_end();
+    hitch_detector_frame_end();
 }
 
 void dev_handle_camera_state()
@@ -184,6 +195,14 @@ void dev_controller_update()
                     {
                         toggleColliders = !toggleColliders;
                     } 
+                    if(selected == 2 && (btn.d_left || btn.d_right))
+                    {
+                        showCollisionGridQuery = !showCollisionGridQuery;
+                    }
+                    if(selected == 3 && (btn.d_left || btn.d_right))
+                    {
+                        showCollisionGrid = !showCollisionGrid;
+                    }
                     break;
                 case DEV_LIGHTDIR:
                     // Update light direction based on joystick input
@@ -230,6 +249,31 @@ void dev_controller_update()
 
                     t3d_mat4fp_set_pos(devArrowMatFP, (float[]){targetPos2[0], targetPos2[1], targetPos2[2]});
                     break;
+                case DEV_RSPQ_PROFILER:
+                    if(btn.d_up) profilerPage = (profilerPage + 2) % 3;
+                    if(btn.d_down) profilerPage = (profilerPage + 1) % 3;
+                    break;
+                case DEV_INPUT_REPLAY:
+                    if(btn.d_up) selected = (selected + 2) % 3;
+                    if(btn.d_down) selected = (selected + 1) % 3;
+                    if(btn.c_down)
+                    {
+                        // Runs start from a fresh scene so record and playback match
+                        if(selected == 0)
+                        {
+                            scene_restart();
+                            input_replay_record_start();
+                        }
+                        else if(selected == 1)
+                        {
+                            if(input_replay_play_start()) scene_restart();
+                        }
+                        else
+                        {
+                            input_replay_stop();
+                        }
+                    }
+                    break;
                 case DEV_MEMORY_DEBUG:
                     // Use Z to take snapshot instead of A
                     if(btn.c_down) 
@@ -374,7 +418,8 @@ void dev_update()
             "Camera Position",
             "Collision",
             "Profiler",
-            "Memory Debug"
+            "Memory Debug",
+            "Input Replay"
         };
         int sidebarCount = rowCount + 1;
         int sidebarX = 10;
@@ -447,10 +492,21 @@ void dev_update()
                     else
                         t3d_debug_printf(paneX, 24, "Toggle Colliders Off");
 
-                    t3d_debug_printf(paneX, 48, "Show BVH Leaf Node Intersections");
-                    t3d_debug_printf(paneX, 60, "Show BVH");
+                    t3d_debug_printf(paneX, 48, "Show Grid Cell Intersections %s", showCollisionGridQuery ? "On" : "Off");
+                    t3d_debug_printf(paneX, 60, "Show Collision Grid %s", showCollisionGrid ? "On" : "Off");
+                    debug_draw_collision_stats(paneX, 84);
                     break;
                 case DEV_RSPQ_PROFILER:
+                    if(profilerPage == 1)
+                    {
+                        debug_draw_cpu_overlay();
+                        break;
+                    }
+                    if(profilerPage == 2)
+                    {
+                        debug_draw_frame_histogram();
+                        break;
+                    }
                     if(profile_data.frame_count == 0)
                         t3d_debug_printf(paneX, 24, "%s", "See wiki/profiling.md");
                     debug_draw_perf_overlay(last3dFPS);
@@ -466,6 +522,31 @@ void dev_update()
                         t3d_debug_printf(paneX, 44, "No snapshot taken yet.");
                     }
                     break;
+                case DEV_INPUT_REPLAY:
+                    rdpq_set_prim_color(RGBA32(0, 0, 0, 200));
+                    rdpq_fill_rectangle(paneX-8, 42 + (selected * 12) - 6, display_get_width(), 42 + (selected * 12) + 6);
+                    t3d_debug_print_start();
+
+                    t3d_debug_printf(paneX, 24, "Down C to select");
+                    t3d_debug_printf(paneX, 36, "Record (restarts)");
+                    t3d_debug_printf(paneX, 48, "Play (restarts)");
+                    t3d_debug_printf(paneX, 60, "Stop");
+
+                    switch(input_replay_get_mode())
+                    {
+                        case REPLAY_RECORDING:
+                            t3d_debug_printf(paneX, 84, "Recording: %d", input_replay_get_frame());
+                            break;
+                        case REPLAY_PLAYING:
+                            t3d_debug_printf(paneX, 84, "Playing: %d/%d", input_replay_get_frame(), input_replay_get_frame_count());
+                            break;
+                        default:
+                            t3d_debug_printf(paneX, 84, "Idle (%d frames stored)", input_replay_get_frame_count());
+                            break;
+                    }
+                    if(input_replay_has_desynced())
+                        t3d_debug_printf(paneX, 96, "RNG desync detected");
+                    break;
             }
         }
     }
@@ -576,6 +657,25 @@ void dev_draw_debug_update(T3DViewport *viewport) {
 }
 
 
+// Collision pane grid views, drawn with the other gameplay debug shapes
+void dev_draw_collision_grid(T3DViewport *viewport)
+{
+    if(showCollisionGrid)
+        collision_mesh_debug_draw_grid(viewport);
+
+    if(showCollisionGridQuery)
+    {
+        float s = character.scale[0];
+        float capA[3], capB[3];
+        for(int k = 0; k < 3; k++)
+        {
+            capA[k] = character.pos[k] + character.capsuleCollider.localCapA.v[k] * s;
+            capB[k] = character.pos[k] + character.capsuleCollider.localCapB.v[k] * s;
+        }
+        collision_mesh_debug_draw_grid_query(viewport, capA, capB);
+    }
+}
+
 void dev_frames_end_update()
 {
     if(!displayMetrics)
@@ -583,6 +683,9 @@ void dev_frames_end_update()
         last3dFPS = display_get_fps();
         rspq_wait();
         rspq_profile_get_data(&profile_data);
+        cpu_timer_get_stats(&cpu_timer_stats);
+        collision_stats_get_summary(&collision_stats_summary);
+        anim_sched_get_stats(&anim_sched_stats);
         if(requestDisplayMetrics)displayMetrics = true;
     }
     
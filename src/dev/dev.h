@@ -12,6 +12,7 @@ void dev_models_init(void);
 void dev_update(void);
 void dev_draw_update(T3DViewport *viewport);
 void dev_draw_debug_update(T3DViewport *viewport);
+void dev_draw_collision_grid(T3DViewport *viewport);
 void dev_frame_update(void);
 void dev_controller_update(void);
 void dev_frames_end_update(void);
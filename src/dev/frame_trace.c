@@ -0,0 +1,76 @@
+#include "frame_trace.h"
+
+#include <libdragon.h>
+#include <stdio.h>
+
+static const char *PHASE_NAMES[TRACE_PHASE_COUNT] = {
+    "input",
+    "save",
+    "attach",
+    "audio",
+    "update",
+    "draw",
+    "present",
+};
+
+typedef struct {
+    uint64_t us;
+    uint8_t phase;
+    bool isEnd;
+} TraceEvent;
+
+static TraceEvent events[FRAME_TRACE_MAX_EVENTS];
+static int eventCount = 0;
+static uint32_t droppedEvents = 0;
+static uint32_t traceFrame = 0; // main.c's frame counter wraps every 30 frames
+
+void frame_trace_init(void)
+{
+    if (!FRAME_TRACE_ENABLED) return;
+
+    // Header line lets the host tool map phase ids back to names.
+    debugf("@TP");
+    for (int i = 0; i < TRACE_PHASE_COUNT; i++) {
+        debugf(" %d=%s", i, PHASE_NAMES[i]);
+    }
+    debugf("\n");
+    eventCount = 0;
+}
+
+void frame_trace_push(TracePhase phase, bool isEnd)
+{
+    if (eventCount >= FRAME_TRACE_MAX_EVENTS) {
+        droppedEvents++;
+        return;
+    }
+    events[eventCount++] = (TraceEvent){
+        .us = get_ticks_us(),
+        .phase = (uint8_t)phase,
+        .isEnd = isEnd,
+    };
+}
+
+void frame_trace_flush(void)
+{
+    if (eventCount == 0) return;
+
+    // Build the whole line first; one debugf per frame keeps the log overhead flat.
+    char line[FRAME_TRACE_MAX_EVENTS * 16 + 48];
+    uint64_t base = events[0].us;
+    int len = snprintf(line, sizeof(line), "@T %lu %llu",
+        (unsigned long)traceFrame++, (unsigned long long)base);
+
+    for (int i = 0; i < eventCount && len < (int)sizeof(line); i++) {
+        len += snprintf(line + len, sizeof(line) - len, " %u%c%lu",
+            events[i].phase, events[i].isEnd ? 'e' : 'b',
+            (unsigned long)(events[i].us - base));
+    }
+
+    if (droppedEvents > 0) {
+        debugf("%s d%lu\n", line, (unsigned long)droppedEvents);
+        droppedEvents = 0;
+    } else {
+        debugf("%s\n", line);
+    }
+    eventCount = 0;
+}
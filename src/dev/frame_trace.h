@@ -0,0 +1,52 @@
+#ifndef FRAME_TRACE_H
+#define FRAME_TRACE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "globals.h"
+
+// Main loop timeline trace, streamed over debugf (ISViewer / USB log).
+// Enable with FRAME_TRACE in globals.h, capture the emulator log and convert it
+// with tools/trace_to_chrome.py for chrome://tracing or Perfetto.
+//
+// One line per frame:
+//   @T <frame> <baseUs> <phase><b|e><offsetUs> ...
+// where offsets are relative to baseUs (microseconds since boot).
+
+#define FRAME_TRACE_ENABLED (DEV_MODE && FRAME_TRACE)
+#define FRAME_TRACE_MAX_EVENTS 32
+
+typedef enum {
+    TRACE_INPUT,
+    TRACE_SAVE,
+    TRACE_ATTACH,   // display_get() + rdpq_attach (waits for a free framebuffer)
+    TRACE_AUDIO,
+    TRACE_UPDATE,
+    TRACE_DRAW,
+    TRACE_PRESENT,  // rdpq_detach_show
+    TRACE_PHASE_COUNT
+} TracePhase;
+
+void frame_trace_init(void);
+void frame_trace_push(TracePhase phase, bool isEnd);
+void frame_trace_flush(void);
+
+static inline void frame_trace_begin(TracePhase phase)
+{
+    if (!FRAME_TRACE_ENABLED) return;
+    frame_trace_push(phase, false);
+}
+
+static inline void frame_trace_end(TracePhase phase)
+{
+    if (!FRAME_TRACE_ENABLED) return;
+    frame_trace_push(phase, true);
+}
+
+static inline void frame_trace_frame_end(void)
+{
+    if (!FRAME_TRACE_ENABLED) return;
+    frame_trace_flush();
+}
+
+#endif
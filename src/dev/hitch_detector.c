@@ -0,0 +1,164 @@
+#include "hitch_detector.h"
+
+#include <libdragon.h>
+#include <string.h>
+
+#include "scene.h"
+#include "game/bosses/boss.h"
+#include "multi_sword_attacks.h"
+#include "utilities/sword_trail.h"
+#include "quality_governor.h"
+
+// Skip the first frames after boot; asset loading always blows the budget.
+#define HITCH_WARMUP_FRAMES 30
+// Minimum frames between two printed snapshots (the print itself costs time).
+#define HITCH_PRINT_COOLDOWN 15
+
+static uint32_t histogram[HITCH_HIST_BUCKETS];
+static uint32_t budgetUs = HITCH_BUDGET_US;
+static uint32_t hitchCount = 0;
+static uint32_t frameIndex = 0;
+static uint32_t lastPrintFrame = 0;
+static uint32_t suppressed = 0;
+
+static uint64_t lastFrameEndUs = 0;
+static bool lastFrameEndValid = false;
+
+static HitchSnapshot lastHitch;
+static bool lastHitchValid = false;
+
+void hitch_detector_reset(void)
+{
+    memset(histogram, 0, sizeof(histogram));
+    hitchCount = 0;
+    suppressed = 0;
+    lastHitchValid = false;
+}
+
+void hitch_detector_set_budget_us(uint32_t us)
+{
+    budgetUs = us;
+}
+
+uint32_t hitch_detector_get_budget_us(void)
+{
+    return budgetUs;
+}
+
+const uint32_t *hitch_detector_get_histogram(void)
+{
+    return histogram;
+}
+
+uint32_t hitch_detector_get_hitch_count(void)
+{
+    return hitchCount;
+}
+
+const HitchSnapshot *hitch_detector_get_last(void)
+{
+    return lastHitchValid ? &lastHitch : NULL;
+}
+
+static int trail_live_samples(const SwordTrail *t)
+{
+    if (!t) return 0;
+    int n = 0;
+    for (int i = 0; i < TRAIL_MAX_SAMPLES; i++) {
+        if (t->samples[i].valid) n++;
+    }
+    return n;
+}
+
+static void hitch_capture(HitchSnapshot *s, uint32_t frameUs)
+{
+    memset(s, 0, sizeof(*s));
+    s->frameUs = frameUs;
+    s->frameIndex = frameIndex;
+
+    s->gameState = (int)scene_get_game_state();
+    s->cutsceneState = (int)scene_get_cutscene_state();
+
+    Boss *boss = boss_get_instance();
+    if (boss && scene_is_boss_active()) {
+        s->bossPresent = true;
+        s->bossState = (int)boss->state;
+        s->bossAttackId = (int)boss->currentAttackId;
+        s->bossAttackName = boss->currentAttackName;
+    }
+
+    s->msaPhase = msa_get_phase();
+    s->msaSwords = msa_get_active_sword_count();
+
+    s->dust = scene_get_active_dust_count();
+    s->groundCrush = scene_get_active_ground_crush_count();
+    s->playerTrail = trail_live_samples(sword_trail_get_player());
+    s->bossTrail = trail_live_samples(sword_trail_get_boss());
+    s->qualityLevel = (int)quality_governor_get_level();
+
+    // dev_frame_update closes the CPU timer and collision frames before
+    // calling us, so their "last frame" is the one that just overran
+    cpu_timer_get_last_frame(s->timerUs);
+    collision_stats_get_last_frame(s->collision);
+}
+
+static void hitch_print(const HitchSnapshot *s)
+{
+    debugf("[HITCH] frame %lu: %lu us (budget %lu us, %lu not printed since last)\n",
+        (unsigned long)s->frameIndex, (unsigned long)s->frameUs, (unsigned long)budgetUs,
+        (unsigned long)suppressed);
+    debugf("  game %d cutscene %d", s->gameState, s->cutsceneState);
+    if (s->bossPresent) {
+        debugf(" | boss state %d attack %d (%s)", s->bossState, s->bossAttackId,
+            s->bossAttackName ? s->bossAttackName : "-");
+    }
+    debugf(" | msa phase %d swords %d\n", s->msaPhase, s->msaSwords);
+    debugf("  fx: dust %d crush %d trail p%d b%d quality %d\n",
+        s->dust, s->groundCrush, s->playerTrail, s->bossTrail, s->qualityLevel);
+    debugf("  cpu:");
+    for (int i = 0; i < CPU_TIMER_COUNT; i++) {
+        if (s->timerUs[i] == 0) continue;
+        debugf(" %s=%lu", cpu_timer_name(i), (unsigned long)s->timerUs[i]);
+    }
+    debugf("\n");
+    debugf("  col: narrow=%lu", (unsigned long)collision_stats_narrow_total(s->collision));
+    for (int i = 0; i < COLLISION_STAT_COUNT; i++) {
+        if (s->collision[i] == 0) continue;
+        debugf(" %s=%lu", collision_stat_name(i), (unsigned long)s->collision[i]);
+    }
+    debugf("\n");
+}
+
+void hitch_detector_frame_end(void)
+{
+    uint64_t now = get_ticks_us();
+    if (!lastFrameEndValid) {
+        lastFrameEndUs = now;
+        lastFrameEndValid = true;
+        return;
+    }
+
+    uint32_t frameUs = (uint32_t)(now - lastFrameEndUs);
+    lastFrameEndUs = now;
+    frameIndex++;
+
+    if (frameIndex < HITCH_WARMUP_FRAMES) return;
+
+    int bucket = (int)(frameUs / HITCH_HIST_BUCKET_US);
+    if (bucket >= HITCH_HIST_BUCKETS) bucket = HITCH_HIST_BUCKETS - 1;
+    histogram[bucket]++;
+
+    if (frameUs <= budgetUs) return;
+
+    hitchCount++;
+    hitch_capture(&lastHitch, frameUs);
+    lastHitchValid = true;
+
+    if (frameIndex - lastPrintFrame < HITCH_PRINT_COOLDOWN) {
+        suppressed++;
+        return;
+    }
+    hitch_print(&lastHitch);
+    lastPrintFrame = frameIndex;
+    suppressed = 0;
+}
@@ -0,0 +1,57 @@
+#ifndef HITCH_DETECTOR_H
+#define HITCH_DETECTOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cpu_timers.h"
+#include "collision_stats.h"
+
+// Dev-mode frame time histogram + hitch snapshots.
+// Every frame longer than the budget captures the gameplay context and prints
+// it over debugf so long frames can be tied to an attack or transition.
+
+#ifndef HITCH_BUDGET_US
+#define HITCH_BUDGET_US 40000   // default budget; 30fps frame plus some slack
+#endif
+
+#define HITCH_HIST_BUCKET_US 5000
+#define HITCH_HIST_BUCKETS 13   // last bucket collects everything >= 60ms
+
+typedef struct {
+    uint32_t frameUs;
+    uint32_t frameIndex;
+
+    int gameState;
+    int cutsceneState;
+
+    bool bossPresent;
+    int bossState;
+    int bossAttackId;
+    const char *bossAttackName;
+
+    int msaPhase;
+    int msaSwords;
+
+    int dust;
+    int groundCrush;
+    int playerTrail;
+    int bossTrail;
+    int qualityLevel;
+
+    uint32_t timerUs[CPU_TIMER_COUNT];           // the hitching frame's own timers
+    uint32_t collision[COLLISION_STAT_COUNT];    // and collision counts
+} HitchSnapshot;
+
+void hitch_detector_reset(void);
+// Call after cpu_timer_frame_end and collision_stats_frame_end (dev_frame_update)
+void hitch_detector_frame_end(void);
+
+void hitch_detector_set_budget_us(uint32_t budgetUs);
+uint32_t hitch_detector_get_budget_us(void);
+
+// Histogram access for the dev overlay
+const uint32_t *hitch_detector_get_histogram(void);
+uint32_t hitch_detector_get_hitch_count(void);
+const HitchSnapshot *hitch_detector_get_last(void); // NULL until the first hitch
+
+#endif
@@ -22,12 +22,13 @@
 #include "globals.h"
 #include "utilities/collision_mesh.h"
 #include "utilities/sword_trail.h"
+#include "dev/cpu_timers.h"
 
 // Forward declarations for internal functions
 static void boss_apply_intent(Boss* boss, const BossIntent* intent);
 static void boss_update_transforms(Boss* boss);
 static void boss_update_movement(Boss* boss, float dt);
-static inline void boss_update_shadow_mat(Boss* boss);
+static inline void boss_update_shadow_mat(Boss* boss, const float pos[3]);
 
 // Boss structure is defined in boss.h
 
@@ -66,26 +67,11 @@ void boss_turn_towards_player(Boss *boss, float dt, float turnScalar) {
 }
 
 // Sword trail sampling for boss: use the same bone-local segment as the weapon collider.
-static inline bool boss_weapon_world_segment(const Boss* boss, float outBase[3], float outTip[3]) {
+static inline bool boss_weapon_world_segment(Boss* boss, float outBase[3], float outTip[3]) {
     if (!boss) return false;
-    if (!boss->skeleton || !boss->modelMat) return false;
-    if (boss->handRightBoneIndex < 0) return false;
 
-    T3DSkeleton *sk = (T3DSkeleton*)boss->skeleton;
-    const T3DMat4FP *B = &sk->boneMatricesFP[boss->handRightBoneIndex]; // bone in MODEL space
-    const T3DMat4FP *M = (const T3DMat4FP*)boss->modelMat;             // model in WORLD space
-
-    const float p0_local[3] = { 0.0f, 0.0f, 0.0f };
-    const float len = 640.0f;
-    const float p1_local[3] = { -len, 0.0f, 0.0f };
-
-    float p0_model[3], p1_model[3];
-    mat4fp_mul_point_f32_row3_colbasis(B, p0_local, p0_model);
-    mat4fp_mul_point_f32_row3_colbasis(B, p1_local, p1_model);
-
-    mat4fp_mul_point_f32_row3_colbasis(M, p0_model, outBase);
-    mat4fp_mul_point_f32_row3_colbasis(M, p1_model, outTip);
-    return true;
+    return bone_cache_world_segment(&boss->boneCache, boss->skeleton, boss->modelMat,
+        boss->handRightBoneIndex, 640.0f, outBase, outTip);
 }
 
 // Apply intent from AI to animation system
@@ -109,9 +95,10 @@ static void boss_update_transforms(Boss* boss) {
     // Update transformation matrix
     T3DMat4FP* mat = (T3DMat4FP*)boss->modelMat;
     t3d_mat4fp_from_srt_euler(mat, boss->scale, boss->rot, boss->pos);
+    bone_cache_invalidate(&boss->boneCache);
 
     // Update shadow matrix
-    boss_update_shadow_mat(boss);
+    boss_update_shadow_mat(boss, boss->pos);
 }
 
 // Update movement and physics
@@ -315,11 +302,12 @@ Boss* boss_spawn(void) {
     return g_boss;
 }
 
-static inline void boss_update_shadow_mat(Boss* boss)
+static inline void boss_update_shadow_mat(Boss* boss, const float pos[3])
 {
     if (!boss || !boss->shadowMat) return;
 
-    float h = boss->pos[1] - BOSS_SHADOW_GROUND_Y;
+    float groundY = collision_mesh_floor_height(pos[0], pos[1], pos[2], BOSS_SHADOW_GROUND_Y);
+    float h = pos[1] - groundY;
     if (h < 0.0f) h = 0.0f;
 
     float t = (BOSS_JUMP_REF_HEIGHT > 0.0f) ? (h / BOSS_JUMP_REF_HEIGHT) : 0.0f;
@@ -327,7 +315,7 @@ static inline void boss_update_shadow_mat(Boss* boss)
 
     float shrink = 1.0f - BOSS_SHADOW_SHRINK_AMOUNT * t;
 
-    float shadowPos[3]   = { boss->pos[0], BOSS_SHADOW_GROUND_Y + BOSS_SHADOW_Y_OFFSET, boss->pos[2] };
+    float shadowPos[3]   = { pos[0], groundY + BOSS_SHADOW_Y_OFFSET, pos[2] };
     float shadowRot[3]   = { 0.0f, 0.0f, 0.0f };
     float shadowScale[3] = {
         boss->scale[0] * BOSS_SHADOW_SIZE_MULT * shrink,
@@ -348,7 +336,9 @@ void boss_update(Boss* boss) {
     // Strict update order:
     // 1. AI decides intent
     BossIntent intent = {0};
+    uint32_t tAi = cpu_timer_begin();
     boss_ai_update(boss, &intent);
+    cpu_timer_end(CPU_TIMER_BOSS_AI_UPDATE, tAi);
     
     // 2. Apply intent (only place that calls boss_anim_request)
     boss_apply_intent(boss, &intent);
@@ -382,6 +372,37 @@ void boss_draw(Boss* boss) {
     boss_render_draw(boss);
 }
 
+void boss_interp_capture(Boss* boss) {
+    if (!boss) return;
+    for (int i = 0; i < 3; i++) {
+        boss->prevPos[i] = boss->pos[i];
+        boss->prevRot[i] = boss->rot[i];
+    }
+}
+
+// Rebuild model/shadow matrices between the previous and current fixed step.
+// Simulation code always rebuilds them from pos/rot before reading them back.
+void boss_interp_apply(Boss* boss, float alpha) {
+    if (!boss || !boss->modelMat) return;
+
+    // Anything further than this in one step is a teleport (reset, cutscene placement)
+    const float SNAP_DIST = 150.0f;
+    float dx = boss->pos[0] - boss->prevPos[0];
+    float dy = boss->pos[1] - boss->prevPos[1];
+    float dz = boss->pos[2] - boss->prevPos[2];
+    if (dx*dx + dy*dy + dz*dz > SNAP_DIST * SNAP_DIST) alpha = 1.0f;
+
+    float pos[3], rot[3];
+    for (int i = 0; i < 3; i++) {
+        pos[i] = boss->prevPos[i] + (boss->pos[i] - boss->prevPos[i]) * alpha;
+        rot[i] = boss->prevRot[i] + wrap_pi(boss->rot[i] - boss->prevRot[i]) * alpha;
+    }
+
+    t3d_mat4fp_from_srt_euler((T3DMat4FP*)boss->modelMat, boss->scale, rot, pos);
+    bone_cache_invalidate(&boss->boneCache);
+    boss_update_shadow_mat(boss, pos);
+}
+
 void boss_draw_ui(Boss* boss, void* viewport) {
     if (!boss) return;
     boss_render_debug(boss, viewport);
@@ -439,15 +460,11 @@ void boss_init(Boss* boss) {
     T3DModel* bossModel = t3d_model_load("rom:/boss/boss_anim.t3dm"); 
     boss->model = bossModel;
     
-    // Create skeletons
+    // Create skeleton
     T3DSkeleton* skeleton = malloc(sizeof(T3DSkeleton));
     *skeleton = t3d_skeleton_create(bossModel);
     boss->skeleton = skeleton;
     
-    T3DSkeleton* skeletonBlend = malloc(sizeof(T3DSkeleton));
-    *skeletonBlend = t3d_skeleton_clone(skeleton, false);
-    boss->skeletonBlend = skeletonBlend;
-    
     // Create animations
     const int animationCount = BOSS_ANIM_COUNT;
     const char* animationNames[] = {
@@ -589,6 +606,8 @@ void boss_init(Boss* boss) {
     T3DMat4FP* modelMat = malloc_uncached(sizeof(T3DMat4FP));
     t3d_mat4fp_identity(modelMat);
     boss->modelMat = modelMat;
+    bone_cache_reset(&boss->boneCache);
+    anim_rig_init(&boss->animRig, "boss", ANIM_PRIORITY_GAMEPLAY);
 
     // Initialize shadow matrix
     T3DMat4FP* shadowMat = malloc_uncached(sizeof(T3DMat4FP));
@@ -819,11 +838,6 @@ void boss_free(Boss* boss) {
         free(boss->skeleton);
     }
     
-    if (boss->skeletonBlend) {
-        t3d_skeleton_destroy((T3DSkeleton*)boss->skeletonBlend);
-        free(boss->skeletonBlend);
-    }
-    
     if (boss->animations) {
         T3DAnim** anims = (T3DAnim**)boss->animations;
 
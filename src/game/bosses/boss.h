@@ -80,10 +80,16 @@ typedef struct Boss {
     float pos[3];
     float rot[3];
     float scale[3];
+
+    // Transform at the start of the current fixed step (render interpolation)
+    float prevPos[3];
+    float prevRot[3];
     
     // Model and rendering (owned by boss_render.c)
     void *model;  // T3DModel* (avoiding header dependency)
     void *modelMat;  // T3DMat4FP* 
+    BoneCache boneCache;  // world transforms of bones read back this pose (see bone_cache.h)
+    AnimRig animRig;      // animation LOD bookkeeping (gameplay: always full rate)
     void *dpl;  // rspq_block_t*
     void *shadowMat; // T3DMat4FP*
     void *dpl_shadow; // rspq_block_t*
@@ -91,7 +97,6 @@ typedef struct Boss {
     
     // Animation system (owned by boss_anim.c - ONLY boss_anim.c touches these)
     void *skeleton;  // T3DSkeleton*
-    void *skeletonBlend;  // T3DSkeleton*
     void **animations;  // T3DAnim**
     int animationCount;
 
@@ -269,6 +274,8 @@ typedef struct {
 Boss* boss_spawn(void);
 void boss_update(Boss* boss);
 void boss_draw(Boss* boss);
+void boss_interp_capture(Boss* boss);
+void boss_interp_apply(Boss* boss, float alpha);
 void boss_draw_ui(Boss* boss, void* viewport);  // T3DViewport* but avoiding header dependency
 void boss_turn_towards_yaw(Boss *boss, float targetYaw, float maxTurn);
 void boss_turn_towards_player(Boss *boss, float dt, float turnScalar);
@@ -16,6 +16,7 @@
 #include <string.h>
 
 #include "game_time.h"
+#include "general_utility.h"
 #include "character.h"
 #include "scene.h"
 #include "simple_collision_utility.h"
@@ -25,7 +26,6 @@
 static void boss_ai_update_targeting_system(Boss* boss, float dt);
 static void boss_ai_update_cooldowns(Boss* boss, float dt);
 static void boss_ai_select_attack(Boss* boss, float dist);
-static bool boss_ai_state_is_attack(BossState state);
 static void predict_character_position(float *predictedPos, float predictionTime);
 static float boss_ai_attack_dust_delay_s(BossAttackId id);
 
@@ -34,6 +34,9 @@ static bool bossWasActive = false;
 static float bossStrafeDirection = 1.0f; // 1.0 = right, -1.0 = left
 static float strafeDirectionTimer = 0.0f; // Timer for alternating direction when stationary
 
+// Forced attack (benchmarks / testing). BOSS_ATTACK_COUNT = normal selection.
+static BossAttackId forcedAttack = BOSS_ATTACK_COUNT;
+
 // Sound flags shared with attack handlers
 bool bossPowerJumpImpactPlayed = false;
 bool bossRoarImpactSoundPlayed = false;
@@ -80,7 +83,38 @@ void boss_ai_init(Boss* boss) {
     boss->strafeDirection = 1.0f;
 }
 
-static bool boss_ai_state_is_attack(BossState state) {
+static inline bool boss_ai_attack_allowed(BossAttackId id) {
+    return forcedAttack == BOSS_ATTACK_COUNT || forcedAttack == id;
+}
+
+void boss_ai_force_attack(Boss* boss, BossAttackId id) {
+    forcedAttack = id;
+    if (!boss || id == BOSS_ATTACK_COUNT) return;
+
+    // Clear whatever would keep the forced attack from being picked.
+    // Distance bands (and phase 2 for the MSA attacks) are still up to the caller.
+    boss->attackCooldown = 0.0f;
+    switch (id) {
+        case BOSS_ATTACK_COMBO_LUNGE:
+        case BOSS_ATTACK_LUNGE_STARTER:      boss->comboLungeCooldown = 0.0f; boss->comboStarterCompleted = true; break;
+        case BOSS_ATTACK_POWER_JUMP:         boss->powerJumpCooldown = 0.0f; break;
+        case BOSS_ATTACK_COMBO:              boss->comboCooldown = 0.0f; boss->comboStarterCompleted = true; break;
+        case BOSS_ATTACK_COMBO_STARTER:      boss->comboStarterCooldown = 0.0f; break;
+        case BOSS_ATTACK_TRACKING_SLAM:      boss->trackingSlamCooldown = 0.0f; break;
+        case BOSS_ATTACK_FLIP_ATTACK:        boss->flipAttackCooldown = 0.0f; break;
+        case BOSS_ATTACK_STOMP:              boss->stompCooldown = 0.0f; break;
+        case BOSS_ATTACK_ATTACK1:            boss->attack1Cooldown = 0.0f; break;
+        case BOSS_ATTACK_AERIAL_SWORD_BARRAGE: boss->swordBarrageCooldown = 0.0f; boss->consecutiveSwordRingUses = 0; break;
+        case BOSS_ATTACK_GROUND_SWEEP:       boss->groundSweepCooldown = 0.0f; break;
+        default: break;
+    }
+}
+
+BossAttackId boss_ai_get_forced_attack(void) {
+    return forcedAttack;
+}
+
+bool boss_ai_state_is_attack(BossState state) {
     return state == BOSS_STATE_LUNGE_STARTER
         || state == BOSS_STATE_COMBO_LUNGE
         || state == BOSS_STATE_POWER_JUMP
@@ -321,7 +355,7 @@ static void boss_ai_select_attack(Boss* boss, float dist) {
     const float CLOSE_MAX   = 60.0f;     // overlap with close-lunge mode (<= 80)
 
     // 1) Stomp: highest priority at super close
-    if (dist <= STOMP_RANGE && boss->stompCooldown <= 0.0f) {
+    if (dist <= STOMP_RANGE && boss->stompCooldown <= 0.0f && boss_ai_attack_allowed(BOSS_ATTACK_STOMP)) {
         boss->state = BOSS_STATE_STOMP;
         boss->stateTimer = 0.0f;
 
@@ -343,11 +377,11 @@ static void boss_ai_select_attack(Boss* boss, float dist) {
     // 2) Attack1: close band, slightly more frequent than tracking slam + close-lunge
     if (dist >= CLOSE_MIN && dist <= CLOSE_MAX) {
 
-        bool attack1Ready = (boss->attack1Cooldown <= 0.0f);
-        bool slamReady    = (boss->trackingSlamCooldown <= 0.0f);
+        bool attack1Ready = (boss->attack1Cooldown <= 0.0f) && boss_ai_attack_allowed(BOSS_ATTACK_ATTACK1);
+        bool slamReady    = (boss->trackingSlamCooldown <= 0.0f) && boss_ai_attack_allowed(BOSS_ATTACK_TRACKING_SLAM);
         bool lungeReady   = (boss->comboStarterCompleted &&
                              boss->comboLungeCooldown <= 0.0f &&
-                             boss->attackCooldown <= 0.0f);
+                             boss->attackCooldown <= 0.0f) && boss_ai_attack_allowed(BOSS_ATTACK_COMBO_LUNGE);
 
         // weights (Attack1 slightly more frequent than both)
         float wA1    = attack1Ready ? 0.45f : 0.0f;
@@ -357,7 +391,7 @@ static void boss_ai_select_attack(Boss* boss, float dist) {
         float sum = wA1 + wSlam + wLunge;
 
         if (sum > 0.0f) {
-            float r = (float)(rand() % 1000) / 1000.0f; // 0..1
+            float r = (float)(rand_xorshift64() % 1000) / 1000.0f; // 0..1
             r *= sum;
 
             if (r < wA1) {
@@ -395,7 +429,7 @@ static void boss_ai_select_attack(Boss* boss, float dist) {
     }
 
     // 3) Combo Starter: close band
-    if (dist >= CLOSE_MIN && dist <= CLOSE_MAX && boss->comboStarterCooldown <= 0.0f) {
+    if (dist >= CLOSE_MIN && dist <= CLOSE_MAX && boss->comboStarterCooldown <= 0.0f && boss_ai_attack_allowed(BOSS_ATTACK_COMBO_STARTER)) {
         boss->state = BOSS_STATE_COMBO_STARTER;
         boss->stateTimer = 0.0f;
 
@@ -424,7 +458,7 @@ static void boss_ai_select_attack(Boss* boss, float dist) {
     }
 
 
-    if (boss->flipAttackCooldown <= 0.0f && dist >= 100.0f && dist < 200.0f) {
+    if (boss->flipAttackCooldown <= 0.0f && dist >= 100.0f && dist < 200.0f && boss_ai_attack_allowed(BOSS_ATTACK_FLIP_ATTACK)) {
         boss->isAttacking = true;
         boss->state = BOSS_STATE_FLIP_ATTACK;
         boss->stateTimer = 0.0f;
@@ -482,7 +516,7 @@ static void boss_ai_select_attack(Boss* boss, float dist) {
         boss->attackNameDisplayTimer = 2.0f;
         boss->currentAttackId = BOSS_ATTACK_FLIP_ATTACK;
     }
-    else if (boss->powerJumpCooldown <= 0.0f && dist >= 200.0f) {
+    else if (boss->powerJumpCooldown <= 0.0f && dist >= 200.0f && boss_ai_attack_allowed(BOSS_ATTACK_POWER_JUMP)) {
         boss->state = BOSS_STATE_POWER_JUMP;
         boss->stateTimer = 0.0f;
         boss->powerJumpCooldown = 12.0f;
@@ -502,13 +536,13 @@ static void boss_ai_select_attack(Boss* boss, float dist) {
         boss->powerJumpTargetPos[1] = boss->lockedTargetingPos[1];
         boss->powerJumpTargetPos[2] = boss->lockedTargetingPos[2];
 
-        boss->powerJumpHeight = 250.0f + ((float)(rand() % 5));
+        boss->powerJumpHeight = 250.0f + ((float)(rand_xorshift64() % 5));
 
         boss->currentAttackName = "Power Jump";
         boss->attackNameDisplayTimer = 2.0f;
         boss->currentAttackId = BOSS_ATTACK_POWER_JUMP;
     }
-    else if (dist >= 50.0f && dist <= 90.0f && boss->trackingSlamCooldown <= 0.0f) {
+    else if (dist >= 50.0f && dist <= 90.0f && boss->trackingSlamCooldown <= 0.0f && boss_ai_attack_allowed(BOSS_ATTACK_TRACKING_SLAM)) {
         boss->state = BOSS_STATE_TRACKING_SLAM;
         boss->stateTimer = 0.0f;
         boss->trackingSlamCooldown = 15.0f;
@@ -532,7 +566,7 @@ static void boss_ai_select_attack(Boss* boss, float dist) {
         boss->attackNameDisplayTimer = 2.0f;
         boss->currentAttackId = BOSS_ATTACK_TRACKING_SLAM;
     }
-    else if (boss->comboCooldown <= 0.0f && boss->comboStarterCompleted) {
+    else if (boss->comboCooldown <= 0.0f && boss->comboStarterCompleted && boss_ai_attack_allowed(BOSS_ATTACK_COMBO)) {
         boss->state = BOSS_STATE_COMBO_ATTACK;
         boss->stateTimer = 0.0f;
         boss->comboCooldown = 10.0f;
@@ -556,7 +590,7 @@ static void boss_ai_select_attack(Boss* boss, float dist) {
         // ------------------------------------------------------------
         if (dist < CLOSE_MIN)
         {
-            if (dist <= 22.0f && boss->stompCooldown <= 0.0f) {
+            if (dist <= 22.0f && boss->stompCooldown <= 0.0f && boss_ai_attack_allowed(BOSS_ATTACK_STOMP)) {
                 boss->state = BOSS_STATE_STOMP;
                 boss->stateTimer = 0.0f;
 
@@ -576,10 +610,10 @@ static void boss_ai_select_attack(Boss* boss, float dist) {
                 return;
             }
 
-            bool starterReady = (boss->comboStarterCooldown <= 0.0f);
+            bool starterReady = (boss->comboStarterCooldown <= 0.0f) && boss_ai_attack_allowed(BOSS_ATTACK_COMBO_STARTER);
             bool comboReady   = (boss->comboCooldown <= 0.0f);          // combo itself
-            bool a1Ready      = (boss->attack1Cooldown <= 0.0f);
-            bool slamReady    = (boss->trackingSlamCooldown <= 0.0f);
+            bool a1Ready      = (boss->attack1Cooldown <= 0.0f) && boss_ai_attack_allowed(BOSS_ATTACK_ATTACK1);
+            bool slamReady    = (boss->trackingSlamCooldown <= 0.0f) && boss_ai_attack_allowed(BOSS_ATTACK_TRACKING_SLAM);
 
             // weights: ensure starter shows up often enough when close
             float wStarter = starterReady ? 0.40f : 0.0f;
@@ -589,7 +623,7 @@ static void boss_ai_select_attack(Boss* boss, float dist) {
             float sum = wStarter + wA1 + wSlam;
 
             if (sum > 0.0f) {
-                float r = ((float)(rand() % 1000) / 1000.0f) * sum;
+                float r = ((float)(rand_xorshift64() % 1000) / 1000.0f) * sum;
 
                 if (r < wStarter) {
                     // COMBO STARTER (close-range allowed)
@@ -667,7 +701,7 @@ static void boss_ai_select_attack(Boss* boss, float dist) {
     
     // Ground Sweep: mid-range, boss stays on ground while MSA drops swords from ceiling.
     // Phase 2 only.
-    if (boss->phaseIndex == 2 && dist >= 100.0f && dist <= 350.0f && boss->groundSweepCooldown <= 0.0f) {
+    if (boss->phaseIndex == 2 && dist >= 100.0f && dist <= 350.0f && boss->groundSweepCooldown <= 0.0f && boss_ai_attack_allowed(BOSS_ATTACK_GROUND_SWEEP)) {
         boss->state = BOSS_STATE_GROUND_SWEEP;
         boss->stateTimer = 0.0f;
         boss->groundSweepCooldown = 25.0f;
@@ -690,14 +724,14 @@ static void boss_ai_select_attack(Boss* boss, float dist) {
     // -------------------------------------------
     // Aerial Sword Barrage: very long range, limited consecutive uses
     // Phase 2 only.
-    if (boss->phaseIndex == 2 && dist >= 250.0f && boss->swordBarrageCooldown <= 0.0f && boss->consecutiveSwordRingUses < 2) {
+    if (boss->phaseIndex == 2 && dist >= 250.0f && boss->swordBarrageCooldown <= 0.0f && boss->consecutiveSwordRingUses < 2 && boss_ai_attack_allowed(BOSS_ATTACK_AERIAL_SWORD_BARRAGE)) {
         boss->state = BOSS_STATE_AERIAL_SWORD_BARRAGE;
         boss->stateTimer = 0.0f;
         boss->swordBarrageCooldown = 15.0f;
         boss->attackCooldown = 1.0f;
         
         // Randomly select variation
-        boss->currentBarrageVariation = rand() % 2;
+        boss->currentBarrageVariation = rand_xorshift64() % 2;
         boss->consecutiveSwordRingUses++;
         
         // Reset state
@@ -830,7 +864,7 @@ void boss_ai_update(Boss* boss, BossIntent* out_intent) {
                 break;
             }
             // Distance-closer lunge: allowed WITHOUT combo starter, but only when far enough
-            if (boss->comboLungeCooldown <= 0.0f && dist >= 80.0f && dist <= 300.0f) {
+            if (boss->comboLungeCooldown <= 0.0f && dist >= 80.0f && dist <= 300.0f && boss_ai_attack_allowed(BOSS_ATTACK_LUNGE_STARTER)) {
                 boss->state = BOSS_STATE_LUNGE_STARTER;
                 boss->stateTimer = 0.0f;
 
@@ -863,8 +897,8 @@ void boss_ai_update(Boss* boss, BossIntent* out_intent) {
                 break;
             }
             // Charge past attack: only trigger when player is within 80 distance AND combo starter has completed
-            if (boss->comboLungeCooldown <= 0.0f && dist > 0.0f && dist < 80.0f && boss->comboStarterCompleted) {
-                float r = (float)(rand() % 100) / 100.0f;
+            if (boss->comboLungeCooldown <= 0.0f && dist > 0.0f && dist < 80.0f && boss->comboStarterCompleted && boss_ai_attack_allowed(BOSS_ATTACK_COMBO_LUNGE)) {
+                float r = (float)(rand_xorshift64() % 100) / 100.0f;
                 if (r < 0.5f) { // 50% chance for charge after combo starter
                     boss_ai_combo_lunge_helper(boss, dist, dx, dz);
                 } else {
@@ -886,7 +920,7 @@ void boss_ai_update(Boss* boss, BossIntent* out_intent) {
                 break;
             }
             // Distance-closer lunge: allowed WITHOUT combo starter, but only when far enough
-            if (boss->comboLungeCooldown <= 0.0f && dist >= 80.0f && dist <= 300.0f) {
+            if (boss->comboLungeCooldown <= 0.0f && dist >= 80.0f && dist <= 300.0f && boss_ai_attack_allowed(BOSS_ATTACK_LUNGE_STARTER)) {
                 boss->state = BOSS_STATE_LUNGE_STARTER;
                 boss->stateTimer = 0.0f;
 
@@ -919,8 +953,8 @@ void boss_ai_update(Boss* boss, BossIntent* out_intent) {
                 break;
             }
             // Charge past attack: only trigger when player is within 80 distance AND combo starter has completed
-            if (boss->comboLungeCooldown <= 0.0f && boss->stateTimer >= 3.0f && dist > 0.0f && dist < 80.0f && boss->comboStarterCompleted) {
-                float r = (float)(rand() % 100) / 100.0f;
+            if (boss->comboLungeCooldown <= 0.0f && boss->stateTimer >= 3.0f && dist > 0.0f && dist < 80.0f && boss->comboStarterCompleted && boss_ai_attack_allowed(BOSS_ATTACK_COMBO_LUNGE)) {
+                float r = (float)(rand_xorshift64() % 100) / 100.0f;
                 if (r < 0.5f) { // 50% chance for charge after combo starter
                     boss_ai_combo_lunge_helper(boss, dist, dx, dz);
                 } else {
@@ -1116,7 +1150,7 @@ void boss_ai_update(Boss* boss, BossIntent* out_intent) {
                     bool comboAvailable  = (boss->comboCooldown <= 0.0f);
 
                     if (chargeAvailable && comboAvailable) {
-                        float r = (float)(rand() % 100) / 100.0f;
+                        float r = (float)(rand_xorshift64() % 100) / 100.0f;
                         if (r < 0.5f) {
                             boss_ai_combo_lunge_helper(boss, dist, dx, dz);
                             break;
@@ -1411,6 +1445,9 @@ void boss_ai_update(Boss* boss, BossIntent* out_intent) {
         boss->dustImpactDelayS = boss_ai_attack_dust_delay_s(boss->currentAttackId);
         out_intent->attack_req = true;
         out_intent->attack = boss->currentAttackId;
+
+        // A forced attack is one-shot
+        if (boss->currentAttackId == forcedAttack) forcedAttack = BOSS_ATTACK_COUNT;
     }
     
     // Sound triggers on state entry (matching old boss code behavior)
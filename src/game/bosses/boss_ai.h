@@ -10,6 +10,14 @@
 void boss_ai_init(Boss* boss);
 void boss_ai_update(Boss* boss, BossIntent* out_intent);
 
+// Restrict attack selection to one attack until it starts (benchmarks / testing).
+// Pass BOSS_ATTACK_COUNT to go back to normal selection.
+void boss_ai_force_attack(Boss* boss, BossAttackId id);
+BossAttackId boss_ai_get_forced_attack(void);
+
+// True while the boss is in one of its attack states
+bool boss_ai_state_is_attack(BossState state);
+
 #endif // BOSS_AI_H
 
 
@@ -37,13 +37,10 @@ void boss_anim_init(Boss* boss) {
         }
     }
     
-    // Reset skeletons
+    // Reset skeleton
     if (boss->skeleton) {
         t3d_skeleton_reset((T3DSkeleton*)boss->skeleton);
     }
-    if (boss->skeletonBlend) {
-        t3d_skeleton_reset((T3DSkeleton*)boss->skeletonBlend);
-    }
     
     // Initialize animation state
     boss->currentAnimation = 10;
@@ -108,20 +105,7 @@ void boss_anim_request(Boss* boss, BossAnimState target, float start_time, bool
     // Start blending if we have a valid previous animation
     if (boss->previousAnimation >= 0 && boss->previousAnimation < boss->animationCount) {
         T3DAnim** anims = (T3DAnim**)boss->animations;
-        T3DSkeleton* skeletonBlend = (T3DSkeleton*)boss->skeletonBlend;
-        
-        // Save the current animation time before switching
-        float savedTime = 0.0f;
-        if (boss->currentAnimation >= 0 && boss->currentAnimation < boss->animationCount && 
-            anims[boss->currentAnimation]) {
-            savedTime = anims[boss->currentAnimation]->time;
-        }
-        
-        // Set up blend skeleton to preserve current visual state
-        t3d_skeleton_reset(skeletonBlend);
-        t3d_anim_attach(anims[boss->previousAnimation], skeletonBlend);
         t3d_anim_set_playing(anims[boss->previousAnimation], true);
-        t3d_anim_set_time(anims[boss->previousAnimation], savedTime);
         
         // Start blending
         boss->isBlending = true;
@@ -154,7 +138,7 @@ void boss_anim_request(Boss* boss, BossAnimState target, float start_time, bool
 }
 
 void boss_anim_update(Boss* boss) {
-    if (!boss || !boss->skeleton || !boss->animations || !boss->skeletonBlend) return;
+    if (!boss || !boss->skeleton || !boss->animations) return;
     // Safety check: ensure deltaTime is valid (not zero, negative, or denormal)
     // Use a minimum threshold to prevent denormal floating point values
     const float MIN_DELTA_TIME = 0.0001f;
@@ -205,13 +189,17 @@ void boss_anim_update(Boss* boss) {
         boss->lockFrames--;
     }
     
+    // Gameplay rig: the scheduler always runs it, this only accounts its cost
+    float animDt;
+    if (!anim_rig_begin(&boss->animRig, deltaTime, &animDt)) return;
+
     T3DAnim** anims = (T3DAnim**)boss->animations;
     // Update animation
-    t3d_anim_update(anims[boss->currentAnimation], deltaTime);
+    t3d_anim_update(anims[boss->currentAnimation], animDt);
 
     // Update blending
     if (boss->isBlending) {
-        boss->blendTimer += deltaTime;
+        boss->blendTimer += animDt;
         
         // Safety check: ensure blendDuration is valid to prevent division by zero or denormal results
         // Use a minimum threshold (0.001f) to prevent denormal floating point values
@@ -249,9 +237,10 @@ void boss_anim_update(Boss* boss) {
         }
     }
     
-    // Blend skeletons if blending is active
-    if (boss->isBlending && boss->skeletonBlend) {
-        T3DAnim** anims = (T3DAnim**)boss->animations;
+    // Crossfade bookkeeping only: the pose is the current clip's alone. Hand-Right
+    // feeds the weapon collider, so sampling the previous clip in would move the
+    // hitbox during every transition and change the attack timings.
+    if (boss->isBlending) {
         bool canBlend = (boss->previousAnimation >= 0 && 
                         boss->previousAnimation < boss->animationCount && 
                         anims[boss->previousAnimation] != NULL &&
@@ -260,13 +249,7 @@ void boss_anim_update(Boss* boss) {
                         boss->blendFactor <= 1.0f &&
                         boss->blendTimer >= 0.0f);
         
-        if (canBlend) {
-            T3DSkeleton* skeleton = (T3DSkeleton*)boss->skeleton;
-            T3DSkeleton* skeletonBlend = (T3DSkeleton*)boss->skeletonBlend;
-            
-            // Blend skeletons: blend from skeletonBlend (old) to skeleton (new), store result in skeleton
-            t3d_skeleton_blend(skeletonBlend, skeleton, skeleton, boss->blendFactor);
-        } else {
+        if (!canBlend) {
             // Not safe to blend - disable blending
             boss->isBlending = false;
             boss->blendFactor = 0.0f;
@@ -279,7 +262,7 @@ void boss_anim_update(Boss* boss) {
         }
     }
     
-    // Update main skeleton (ONLY the main skeleton, never the blend skeleton)
+    // Update main skeleton
     // Only update if we have a valid current animation
     // We ensure the animation is attached in boss_anim_request, so we can safely update here
     if (boss->currentAnimation >= 0 && boss->currentAnimation < boss->animationCount) {
@@ -289,8 +272,10 @@ void boss_anim_update(Boss* boss) {
             // Update the skeleton - animation should already be attached from boss_anim_request
             // If not attached, this will cause issues, but boss_anim_request should always attach it
             t3d_skeleton_update(skeleton);
+            bone_cache_invalidate(&boss->boneCache);
         }
     }
+    anim_rig_end(&boss->animRig);
 }
 
 
@@ -78,7 +78,7 @@ static inline void boss_spawn_ground_crushed_toward_player(Boss *boss, float for
 
     float cx = boss->pos[0] + dirX * forwardDist;
     float cz = boss->pos[2] + dirZ * forwardDist;
-    scene_spawn_ground_crushed(cx, cz);
+    scene_spawn_ground_crushed(cx, boss->pos[1], cz);
 }
 
 static inline void boss_attacks_on_player_hit(float damage)
@@ -25,6 +25,7 @@
 #include "game_time.h"
 #include "globals.h"
 #include "general_utility.h"
+#include "collision_mesh.h"
 
 // Shadow tuning (duplicated from boss.c for rendering alpha)
 static const float BOSS_SHADOW_GROUND_Y = -1.0f;  // Match roomY floor level
@@ -129,7 +130,7 @@ void boss_draw_shadow(Boss* boss) {
     if (!boss->dpl_shadow || !boss->shadowMat) return;
 
     // Compute alpha like character: fade with height
-    float h = boss->pos[1] - BOSS_SHADOW_GROUND_Y;
+    float h = boss->pos[1] - collision_mesh_floor_height(boss->pos[0], boss->pos[1], boss->pos[2], BOSS_SHADOW_GROUND_Y);
     if (h < 0.0f) h = 0.0f;
     float t = (BOSS_JUMP_REF_HEIGHT > 0.0f) ? (h / BOSS_JUMP_REF_HEIGHT) : 0.0f;
     if (t > 1.0f) t = 1.0f;
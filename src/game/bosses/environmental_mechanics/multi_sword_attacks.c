@@ -15,12 +15,16 @@
 
 #include "character.h"
 #include "simple_collision_utility.h"
+#include "collision_world.h"
 #include "debug_draw.h"
 #include "dev.h"
+#include "collision_stats.h"
 #include "globals.h"
 #include "game_math.h"
+#include "game_time.h"
 
 #include "path_ribbon.h"
+#include "quality_governor.h"
 #include "fx/lightning_fx.h"
 
 // ============================================================
@@ -145,6 +149,10 @@ typedef struct {
     float t;
     uint32_t seed;
 
+    // Position at the start of the current fixed step (render interpolation)
+    float prevPos[3];
+    uint8_t prevValid;
+
     MsaSwordState state;
 
     float spawnX;
@@ -164,6 +172,10 @@ typedef struct {
     uint8_t renormTick;
 
     uint8_t glowVisible;
+
+    // Collision world bodies: the landed blade and the bounds of its ribbon wall
+    CollisionBodyId bodyId;
+    CollisionBodyId wallId;
 } MsaSword;
 
 // ============================================================
@@ -435,11 +447,12 @@ static inline void msa_build_wall_obb_from_seg(SCU_OBB *o, float x0, float z0, f
 }
 
 static bool msa_wall_hit_or_block_capsule(
+    const CollisionBodyId *walls, int wallCount,
     float capA[3], float capB[3], float r,
     float *io_vx, float *io_vz)
 {
 #if !MSA_DO_WALL_COLLISION
-    (void)capA; (void)capB; (void)r; (void)io_vx; (void)io_vz;
+    (void)walls; (void)wallCount; (void)capA; (void)capB; (void)r; (void)io_vx; (void)io_vz;
     return false;
 #else
     float yMin = fminf(capA[1], capB[1]) - r;
@@ -450,7 +463,15 @@ static bool msa_wall_hit_or_block_capsule(
 
     bool anyHit = false;
 
-    for (int si = 0; si < gCount; si++) {
+    // Only ribbons whose bounds the broadphase found around the capsule, still
+    // pushed in sword order so overlapping walls resolve the same way
+    uint32_t candidates = 0;
+    for (int wi = 0; wi < wallCount; wi++) {
+        candidates |= 1u << collision_world_get(walls[wi])->tag;
+    }
+
+    for (int si = 0; candidates != 0; si++, candidates >>= 1) {
+        if (!(candidates & 1u)) continue;
         const MsaSword *sw = &gSwords[si];
         const PathRibbon *pr = &sw->ribbon;
 
@@ -471,6 +492,8 @@ static bool msa_wall_hit_or_block_capsule(
 
             float push[3] = {0}, nrm[3] = {0};
 
+            collision_stat_add(COLLISION_STAT_MSA_WALL_CHECKS, 1);
+            collision_stat_add(COLLISION_STAT_CAPSULE_OBB, 1);
             if (scu_capsule_vs_obb_push_xz_f(capA, capB, r, &o, push, nrm)) {
                 anyHit = true;
 
@@ -503,6 +526,49 @@ static bool msa_wall_hit_or_block_capsule(
 #endif
 }
 
+// ============================================================
+// COLLISION WORLD SYNC
+// ============================================================
+static void msa_sync_collision_bodies(void) {
+    for (int i = 0; i < MSA_MAX_SWORDS; i++) {
+        MsaSword *s = &gSwords[i];
+
+        if (i < gCount && (s->state == SW_LANDED || s->state == SW_SCURVE)) {
+            float swordMin[3], swordMax[3];
+            swordBodyAabb(s, swordMin, swordMax);
+            collision_world_set_aabb(s->bodyId, swordMin, swordMax);
+        } else {
+            collision_world_set_enabled(s->bodyId, false);
+        }
+
+        const PathRibbon *pr = &s->ribbon;
+        int n = (int)pr->count;
+        if (i >= gCount || pr->dead || n < 2) {
+            collision_world_set_enabled(s->wallId, false);
+            continue;
+        }
+
+        // Segment boxes are WALL_THICKNESS wide around the polyline
+        const float pad = 0.5f * WALL_THICKNESS;
+        float wallMin[3] = { INFINITY, gFloorY, INFINITY };
+        float wallMax[3] = { -INFINITY, gFloorY + WALL_HEIGHT, -INFINITY };
+        for (int k = 0; k < n; k++) {
+            float x = pr->pts[k][0];
+            float z = pr->pts[k][2];
+            if (!isfinite(x) || !isfinite(z)) continue;
+            wallMin[0] = fminf(wallMin[0], x - pad);
+            wallMax[0] = fmaxf(wallMax[0], x + pad);
+            wallMin[2] = fminf(wallMin[2], z - pad);
+            wallMax[2] = fmaxf(wallMax[2], z + pad);
+        }
+        if (wallMin[0] > wallMax[0]) {
+            collision_world_set_enabled(s->wallId, false);
+            continue;
+        }
+        collision_world_set_aabb(s->wallId, wallMin, wallMax);
+    }
+}
+
 // ============================================================
 // T3D MATRIX BUILD
 // ============================================================
@@ -620,6 +686,9 @@ static void reset_sword_runtime(MsaSword *s) {
 
     s->lastRibbonXZ[0] = s->pos[0];
     s->lastRibbonXZ[1] = s->pos[2];
+
+    // Freshly placed: draw at pos until the next step captures a start point
+    s->prevValid = 0;
 }
 
 static void make_drop_order(uint32_t *seed) {
@@ -749,6 +818,18 @@ bool msa_ground_sweep_is_done(void) {
     return gGroundSweepDone;
 }
 
+int msa_get_phase(void) {
+    return (int)gPhase;
+}
+
+int msa_get_active_sword_count(void) {
+    int n = 0;
+    for (int i = 0; i < MSA_MAX_SWORDS; i++) {
+        if (gSwords[i].state != SW_INACTIVE) n++;
+    }
+    return n;
+}
+
 // ============================================================
 // INIT / SHUTDOWN
 // ============================================================
@@ -794,6 +875,9 @@ void msa_init(void) {
         s->state = SW_INACTIVE;
         s->glowVisible = 0;
 
+        s->bodyId = collision_world_add(COLLISION_SHAPE_AABB, COLLISION_LAYER_SWORD, COLLISION_LAYER_CHAR_BODY, i);
+        s->wallId = collision_world_add(COLLISION_SHAPE_AABB, COLLISION_LAYER_RIBBON_WALL, COLLISION_LAYER_CHAR_BODY, i);
+
         path_ribbon_init(&s->ribbon, (uint8_t)MSA_PATH_MAX_POINTS, (float)MSA_PATH_MIN_STEP);
         path_ribbon_set_floor(&s->ribbon, gFloorY);
         path_ribbon_set_seed(&s->ribbon, s->seed);
@@ -1175,18 +1259,24 @@ void msa_update(float dt) {
     // ========================================================
     // COLLISION
     // ========================================================
+    msa_sync_collision_bodies();
+
     bool hitBody = false;
 
 #if MSA_DO_BODY_COLLISION
-    for (int i = 0; i < gCount; i++) {
-        MsaSword *s = &gSwords[i];
-        if (s->state != SW_LANDED && s->state != SW_SCURVE) continue;
-
-        float swordMin[3], swordMax[3];
-        swordBodyAabb(s, swordMin, swordMax);
-        if (scu_capsule_vs_rect_f(charA, charB, charR, swordMin, swordMax)) {
-            hitBody = true;
-            break;
+    {
+        CollisionBodyId blades[MSA_MAX_SWORDS];
+        int bladeCount = collision_world_query_capsule(charA, charB, charR, COLLISION_LAYER_SWORD,
+            blades, MSA_MAX_SWORDS);
+        if (bladeCount > MSA_MAX_SWORDS) bladeCount = MSA_MAX_SWORDS;
+
+        for (int i = 0; i < bladeCount; i++) {
+            const CollisionBody *b = collision_world_get(blades[i]);
+            collision_stat_add(COLLISION_STAT_CAPSULE_AABB, 1);
+            if (scu_capsule_vs_rect_f(charA, charB, charR, b->aabb.min, b->aabb.max)) {
+                hitBody = true;
+                break;
+            }
         }
     }
 #endif
@@ -1209,7 +1299,12 @@ void msa_update(float dt) {
         float capB[3] = { charB[0], charB[1], charB[2] };
         float r = charR;
 
-        hitWall = msa_wall_hit_or_block_capsule(capA, capB, r,
+        CollisionBodyId walls[MSA_MAX_SWORDS];
+        int wallCount = collision_world_query_capsule(capA, capB, r, COLLISION_LAYER_RIBBON_WALL,
+            walls, MSA_MAX_SWORDS);
+        if (wallCount > MSA_MAX_SWORDS) wallCount = MSA_MAX_SWORDS;
+
+        hitWall = msa_wall_hit_or_block_capsule(walls, wallCount, capA, capB, r,
 #if MSA_WALLS_BLOCKING
             &vx, &vz
 #else
@@ -1234,6 +1329,16 @@ void msa_update(float dt) {
     }
 }
 
+void msa_interp_capture(void) {
+    for (int i = 0; i < MSA_MAX_SWORDS; i++) {
+        MsaSword *s = &gSwords[i];
+        s->prevPos[0] = s->pos[0];
+        s->prevPos[1] = s->pos[1];
+        s->prevPos[2] = s->pos[2];
+        s->prevValid = (s->state != SW_INACTIVE) ? 1 : 0;
+    }
+}
+
 // ============================================================
 // DRAW
 // ============================================================
@@ -1243,6 +1348,8 @@ void msa_draw_visuals(T3DViewport *viewport) {
     if (!gEnabled) return;
     if (!swordDpl || !swordMatrix || !floorGlowModel || !floorGlowMatrix) return;
 
+    const float alpha = msa_clampf(renderAlpha, 0.0f, 1.0f);
+
     // 1) Swords (zbuf ON)
     t3d_matrix_push_pos(1);
     for (int i = 0; i < gCount; i++) {
@@ -1250,6 +1357,14 @@ void msa_draw_visuals(T3DViewport *viewport) {
         if (s->state == SW_INACTIVE) continue;
         if (!msa_isfinite3(s->pos[0], s->pos[1], s->pos[2])) continue;
 
+        // Blend between the last two fixed steps
+        float p[3] = { s->pos[0], s->pos[1], s->pos[2] };
+        if (s->prevValid) {
+            p[0] = s->prevPos[0] + (s->pos[0] - s->prevPos[0]) * alpha;
+            p[1] = s->prevPos[1] + (s->pos[1] - s->prevPos[1]) * alpha;
+            p[2] = s->prevPos[2] + (s->pos[2] - s->prevPos[2]) * alpha;
+        }
+
         float yaw = 0.0f;
 #if MSA_FACE_DIR
         yaw = atan2f(s->dir[1], s->dir[0]) + MSA_MODEL_YAW_OFFSET;
@@ -1259,16 +1374,16 @@ void msa_draw_visuals(T3DViewport *viewport) {
             // Keep dormant ring swords straight-down until activated.
             const float scale[3] = { MODEL_SCALE*2.0f, MODEL_SCALE*2.0f, MODEL_SCALE*2.0f };
             const float rot[3] = { 0.0f, 0.0f, 0.0f };
-            const float trans[3] = { s->pos[0], s->pos[1], s->pos[2] };
+            const float trans[3] = { p[0], p[1], p[2] };
             t3d_mat4fp_from_srt_euler(&swordMatrix[i], scale, rot, trans);
         } else if (gAerialMode && (s->state == SW_AERIAL_AIM || s->state == SW_AERIAL_FLY)) {
             float tx = gAerialTargets[i][0];
             float ty = gAerialTargets[i][1];
             float tz = gAerialTargets[i][2];
 
-            float dx = tx - s->pos[0];
-            float dy = ty - s->pos[1];
-            float dz = tz - s->pos[2];
+            float dx = tx - p[0];
+            float dy = ty - p[1];
+            float dz = tz - p[2];
             float xz = sqrtf(dx*dx + dz*dz);
             float tgtYaw   = atan2f(dz, dx) + MSA_MODEL_YAW_OFFSET;
             float tgtPitch = -atan2f(dy, xz + 0.0001f) + AERIAL_MODEL_PITCH_OFFSET;
@@ -1291,17 +1406,17 @@ void msa_draw_visuals(T3DViewport *viewport) {
 
             const float scale[3] = { MODEL_SCALE*2.0f, MODEL_SCALE*2.0f, MODEL_SCALE*2.0f };
             const float rot[3] = { finalPitch, finalYaw, finalRoll };
-            const float trans[3] = { s->pos[0], s->pos[1], s->pos[2] };
+            const float trans[3] = { p[0], p[1], p[2] };
             t3d_mat4fp_from_srt_euler(&swordMatrix[i], scale, rot, trans);
         } else if (gAerialMode && s->state == SW_AERIAL_STUCK) {
             // Keep exactly the orientation locked in at the moment of impact —
             // no rotation, just sink straight into the ground.
             const float scale[3] = { MODEL_SCALE*2.0f, MODEL_SCALE*2.0f, MODEL_SCALE*2.0f };
             const float rot[3] = { gAerialLandPitch[i], gAerialLandYaw[i], gAerialLandRoll[i] };
-            const float trans[3] = { s->pos[0], s->pos[1], s->pos[2] };
+            const float trans[3] = { p[0], p[1], p[2] };
             t3d_mat4fp_from_srt_euler(&swordMatrix[i], scale, rot, trans);
         } else {
-            msa_build_srt_scaled(&swordMatrix[i], MODEL_SCALE*2.0f, s->pos[0], s->pos[1], s->pos[2], yaw);
+            msa_build_srt_scaled(&swordMatrix[i], MODEL_SCALE*2.0f, p[0], p[1], p[2], yaw);
         }
 
         t3d_matrix_set(&swordMatrix[i], true);
@@ -1312,12 +1427,15 @@ void msa_draw_visuals(T3DViewport *viewport) {
     // Lightning FX
     if (gLightningFx) lightning_fx_draw(gLightningFx);
 
-    // Glows
+    // Glows (quality governor may cap how many are drawn)
+    const int glowMax = quality_budgets()->msaGlowMax;
+    int glowsDrawn = 0;
     t3d_matrix_push_pos(1);
     for (int i = 0; i < gCount; i++) {
         const MsaSword *s = &gSwords[i];
         if (s->state == SW_INACTIVE) continue;
         if (!s->glowVisible) continue;
+        if (glowsDrawn >= glowMax) break;
 
         if (!isfinite(s->spawnX) || !isfinite(s->spawnZ) || !isfinite(gFloorY)) continue;
 
@@ -1335,6 +1453,7 @@ void msa_draw_visuals(T3DViewport *viewport) {
             .userData = &floorGlowScrollParams,
             .tileCb   = tile_scroll,
         });
+        glowsDrawn++;
     }
     t3d_matrix_pop(1);
 
@@ -1481,6 +1600,7 @@ void msa_spawn_aerial_ring(float centerX, float centerY, float centerZ, float ra
 
         s->lastRibbonXZ[0] = s->pos[0];
         s->lastRibbonXZ[1] = s->pos[2];
+        s->prevValid = 0;
 
         gAerialTargets[i][0] = s->pos[0];
         gAerialTargets[i][1] = s->pos[1];
@@ -10,6 +10,8 @@ void msa_shutdown(void);
 
 // Main loop
 void msa_update(float dt);
+// Snapshot sword positions at the start of a fixed step (draw interpolates by renderAlpha)
+void msa_interp_capture(void);
 
 // Draws
 void msa_draw_visuals(T3DViewport *viewport);
@@ -47,4 +49,8 @@ void msa_cleanup_aerial_swords(void);
 void msa_ground_sweep_start(void);
 bool msa_ground_sweep_is_done(void);
 
+// Debug state (dev hitch snapshots)
+int msa_get_phase(void);
+int msa_get_active_sword_count(void);
+
 #endif
@@ -6,14 +6,20 @@
 #include "globals.h"
 #include "game_time.h"
 #include "joypad_utility.h"
+#include "input_replay.h"
 #include "camera_controller.h"
 #include "audio_controller.h"
 #include "display_utility.h"
 #include "menu_controller.h"
 #include "save_controller.h"
 #include "collision_system.h"
+#include "quality_governor.h"
+#include "render_scale_utility.h"
 #include "scene.h"
 #include "dev.h"
+#include "dev/cpu_timers.h"
+#include "dev/frame_trace.h"
+#include "dev/bench.h"
 #include "dev/crt_safe_area_overlay.h"
 #include "video_player_utility.h"
 
@@ -22,6 +28,7 @@ int main(void)
     if (DEV_MODE) 
     {
         dev_tools_init();
+        frame_trace_init();
     }
 
     if(DEBUG_DRAW)
@@ -81,17 +88,30 @@ int main(void)
     scene_init();
     menu_controller_init();
 
+    if (BENCH_MODE) bench_init();
+
     if (DEV_MODE && debugDraw) {
         offscreenBuffer = surface_alloc(FMT_RGBA16, SCREEN_WIDTH, SCREEN_HEIGHT);
     }
 
     for (uint64_t frame = 0;; ++frame)
     {
+        // Dev menu state as the frame starts decides the whole frame, so replays
+        // hold on exactly the frames that run no fixed steps
+        bool devMenuOpen = DEV_MODE && dev_menu_is_open();
+        input_replay_set_held(devMenuOpen);
+
         // Update time + input first
+        frame_trace_begin(TRACE_INPUT);
         game_time_update();
+        quality_governor_frame_update(frameDeltaTime);
+        render_scale_update();
         joypad_update();
+        frame_trace_end(TRACE_INPUT);
         // Debounced EEPROM save flush (eg: audio sliders)
+        frame_trace_begin(TRACE_SAVE);
         save_controller_update();
+        frame_trace_end(TRACE_SAVE);
 
         // ------------------------------------------------------------
         // VIDEO PUMP (MUST be BEFORE any rdpq_attach() in the frame)
@@ -99,33 +119,56 @@ int main(void)
         if (video_player_pump_and_play(&viewport)) {
             // Video played. The utility restores display/rdpq/t3d and can scene_restart().
             // Start next frame cleanly.
+            // Close this frame's trace line first, or its input/save events
+            // would be printed as part of the next frame.
+            frame_trace_frame_end();
             continue;
         }
 
         // Attach render target for the frame
+        frame_trace_begin(TRACE_ATTACH);
         if (DEV_MODE && debugDraw) {
             rdpq_attach(&offscreenBuffer, display_get_zbuf());
         } else {
             rdpq_attach(display_get(), display_get_zbuf());
         }
+        frame_trace_end(TRACE_ATTACH);
         // ===== UPDATE LOOP =====
+        frame_trace_begin(TRACE_AUDIO);
         mixer_try_play();
+        frame_trace_end(TRACE_AUDIO);
+
+        frame_trace_begin(TRACE_UPDATE);
 
         if (DEV_MODE) {
             dev_controller_update();
         }
 
-        bool devMenuOpen = DEV_MODE && dev_menu_is_open();
         bool cameraNeedsUpdate = (cameraState == CAMERA_FREECAM);
 
         if (!devMenuOpen)
         {
+            uint32_t t = cpu_timer_begin();
             camera_update(&viewport);
+            cpu_timer_end(CPU_TIMER_CAMERA_UPDATE, t);
 
             menu_controller_update();
 
+            t = cpu_timer_begin();
             scene_update();
-            scene_fixed_update();
+
+            // Gameplay runs in FIXED_TIMESTEP_MS steps; whatever is left of the
+            // accumulator becomes renderAlpha for interpolated drawing.
+            int steps = game_time_fixed_begin();
+            for (int i = 0; i < steps; ++i) {
+                joypad_fixed_step_begin();
+                if (BENCH_MODE) bench_fixed_step();
+                scene_fixed_update();
+                joypad_fixed_step_end();
+            }
+            game_time_fixed_end();
+            camera_interp_apply(&viewport, renderAlpha);
+            cpu_timer_end(CPU_TIMER_SCENE_UPDATE, t);
         }
         else
         {
@@ -135,15 +178,21 @@ int main(void)
 
             menu_controller_update();
         }
+        frame_trace_end(TRACE_UPDATE);
 
         // ===== DRAW LOOP =====
+        frame_trace_begin(TRACE_DRAW);
         if (!devMenuOpen || cameraNeedsUpdate) {
+            uint32_t t = cpu_timer_begin();
             scene_draw(&viewport);
+            cpu_timer_end(CPU_TIMER_SCENE_DRAW, t);
         }
 
         t3d_tri_sync();
         rdpq_sync_pipe();
+        uint32_t tMenu = cpu_timer_begin();
         menu_controller_draw();
+        cpu_timer_end(CPU_TIMER_MENU_DRAW, tMenu);
         
         if (DEV_MODE)
         {
@@ -159,6 +208,9 @@ int main(void)
             rdpq_sync_pipe();
             rdpq_text_printf(NULL, FONT_BUILTIN_DEBUG_MONO, 250, 225, " %.2f", display_get_fps());
         }
+        frame_trace_end(TRACE_DRAW);
+
+        frame_trace_begin(TRACE_PRESENT);
 
         if (DEV_MODE && debugDraw)
         {
@@ -178,15 +230,22 @@ int main(void)
             }
             rdpq_detach_show();
         }
+        frame_trace_end(TRACE_PRESENT);
 
-        if (DEV_MODE)
+        if (BENCH_MODE)
+        {
+            bench_frame_end();
+        }
+        else if (DEV_MODE)
         {
             dev_frame_update();
         }
 
+        frame_trace_frame_end();
+
         if (frame >= 30)
         {
-            if (DEV_MODE)
+            if (DEV_MODE && !BENCH_MODE)
                 dev_frames_end_update();
 
             frame = 0;
@@ -18,6 +18,7 @@
 #include "scene.h"
 #include "simple_collision_utility.h"
 #include "collision_system.h"
+#include "collision_mesh.h"
 #include "game_math.h"
 #include "display_utility.h"
 #include "controllers/audio_controller.h"
@@ -25,6 +26,7 @@
 #include "utilities/general_utility.h"
 #include "utilities/sword_trail.h"
 #include "animation_utility.h"
+#include "pose_blend.h"
 
 /*
  Character Controller
@@ -143,8 +145,8 @@ static const float FOOTSTEP_RUN_INTERVAL  = 0.40f;
  * -------------------------------------------------------------------------- */
 
 // Lock-on blend “drivers”
-static int activeMainAnim  = -1; // clip attached to character.skeleton
-static int activeBlendAnim = -1; // clip attached to character.skeletonBlend
+static int activeMainAnim  = -1; // base clip
+static int activeBlendAnim = -1; // strafe clip blended over the base
 static int lastBaseAnimLock   = -1;
 static int lastStrafeAnimLock = -1;
 
@@ -242,18 +244,11 @@ typedef struct {
 } StickInput;
 
 
-#define STRAFEPOSE_MAX_BONES 64
+// Crossfade "from" pose: action/locomotion switches (hasBlendSnapshot) and
+// lock-on strafe switches (strafePoseBlending). Lock-on blending never runs
+// while character.isBlending, so the two never need it at the same time.
+static AnimPose blendFromPose;
 
-typedef struct {
-    bool   valid;
-    int    count;
-    T3DVec3 pos[STRAFEPOSE_MAX_BONES];
-    T3DQuat rot[STRAFEPOSE_MAX_BONES];
-    T3DVec3 scl[STRAFEPOSE_MAX_BONES];
-} StrafePoseBuf;
-
-// NOTE: no 'g_' prefix — match compiler hints
-static StrafePoseBuf strafeFromPose;
 static float         strafePoseBlendT   = 0.0f;
 static float         strafePoseBlendDur = 0.0f;
 static bool          strafePoseBlending = false;
@@ -287,43 +282,6 @@ static inline float stick_axis_deadzone(float raw)
     return (a < 0.0f) ? -t : t;
 }
 
-static inline void pose_capture(StrafePoseBuf* pb, const T3DSkeleton* sk)
-{
-    if (!pb || !sk || !sk->bones || !sk->skeletonRef) return;
-
-    int n = sk->skeletonRef->boneCount;
-    if (n > STRAFEPOSE_MAX_BONES) n = STRAFEPOSE_MAX_BONES;
-
-    pb->valid = true;
-    pb->count = n;
-
-    for (int i = 0; i < n; i++) {
-        pb->pos[i] = sk->bones[i].position;
-        pb->rot[i] = sk->bones[i].rotation;
-        pb->scl[i] = sk->bones[i].scale;
-    }
-}
-
-static inline void pose_blend_into_skeleton(const StrafePoseBuf* pb,
-                                            T3DSkeleton* sk,
-                                            float t)
-{
-    if (!pb || !pb->valid || !sk || !sk->bones || !sk->skeletonRef) return;
-
-    int n = sk->skeletonRef->boneCount;
-    if (n > pb->count) n = pb->count;
-
-    for (int i = 0; i < n; i++) {
-        T3DBone* b = &sk->bones[i];
-
-        t3d_vec3_lerp(&b->position, &pb->pos[i], &b->position, t);
-        t3d_vec3_lerp(&b->scale,    &pb->scl[i], &b->scale,    t);
-        t3d_quat_nlerp(&b->rotation, &pb->rot[i], &b->rotation, t);
-
-        b->hasChanged = true;
-    }
-}
-
 static inline float clamp01(float x) {
     if (x < 0.0f) return 0.0f;
     if (x > 1.0f) return 1.0f;
@@ -335,32 +293,6 @@ static inline float smoothstep01(float t) {
     return t * t * (3.0f - 2.0f * t);
 }
 
-// Copy pose by copying bone SRT (THIS is what t3d_skeleton_blend uses)
-static inline void skeleton_copy_pose_bones(T3DSkeleton* dest, const T3DSkeleton* src)
-{
-    if (!dest || !src) return;
-    if (!dest->bones || !src->bones) return;
-    if (!dest->skeletonRef || !src->skeletonRef) return;
-
-    // Assuming both skeletons are clones of the same model skeleton
-    const int count = dest->skeletonRef->boneCount;
-
-    for (int i = 0; i < count; i++) {
-        dest->bones[i].position = src->bones[i].position;
-        dest->bones[i].rotation = src->bones[i].rotation;
-        dest->bones[i].scale    = src->bones[i].scale;
-
-        // mark changed so if someone ever updates matrices, they rebuild
-        dest->bones[i].hasChanged = true;
-    }
-}
-
-static inline void skeleton_prime_from_pose(T3DSkeleton* skel, const T3DSkeleton* poseSrc)
-{
-    if (!skel || !poseSrc) return;
-    skeleton_copy_pose_bones(skel, poseSrc);
-}
-
 static inline void anim_stop_all_except(T3DAnim** set, int count, int keepIdx)
 {
     if (!set) return;
@@ -507,24 +439,7 @@ static void character_anim_apply_pose(void)
 {
     if (!character.skeleton) return;
     t3d_skeleton_update(character.skeleton);
-}
-
-// Copy pose by copying bone matrices (safe-ish cap, same model clone)
-static inline void skeleton_copy_pose(T3DSkeleton* dest, T3DSkeleton* src)
-{
-    if (!dest || !src) return;
-
-    t3d_skeleton_update(src);
-
-    T3DSkeleton* dest_sk = (T3DSkeleton*)dest;
-    T3DSkeleton* src_sk  = (T3DSkeleton*)src;
-
-    if (!dest_sk->boneMatricesFP || !src_sk->boneMatricesFP) return;
-
-    const int MAX_BONES = 64;
-    for (int i = 0; i < MAX_BONES; i++) {
-        dest_sk->boneMatricesFP[i] = src_sk->boneMatricesFP[i];
-    }
+    bone_cache_invalidate(&character.boneCache);
 }
 
 static inline bool is_locomotion_anim(int a)
@@ -594,7 +509,7 @@ static inline void strong_knockback_update(float dt)
  * Shadow + transform
  * -------------------------------------------------------------------------- */
 
-static inline void character_update_shadow_mat(void);
+static inline void character_update_shadow_mat(const float pos[3]);
 
 static void character_finalize_frame(bool updateCamera)
 {
@@ -603,14 +518,16 @@ static void character_finalize_frame(bool updateCamera)
     }
     float rotAdjusted[3] = { character.rot[0], character.rot[1] + MODEL_YAW_OFFSET, character.rot[2] };
     t3d_mat4fp_from_srt_euler(character.modelMat, character.scale, rotAdjusted, character.pos);
-    character_update_shadow_mat();
+    bone_cache_invalidate(&character.boneCache);
+    character_update_shadow_mat(character.pos);
 }
 
-static inline void character_update_shadow_mat(void)
+static inline void character_update_shadow_mat(const float pos[3])
 {
     if (!character.shadowMat) return;
 
-    float h = character.pos[1] - SHADOW_GROUND_Y;
+    float groundY = collision_mesh_floor_height(pos[0], pos[1], pos[2], SHADOW_GROUND_Y);
+    float h = pos[1] - groundY;
     if (h < 0.0f) h = 0.0f;
 
     float t = h / JUMP_HEIGHT;
@@ -618,7 +535,7 @@ static inline void character_update_shadow_mat(void)
 
     float shrink = 1.0f - SHADOW_SHRINK_AMOUNT * t;
 
-    float shadowPos[3]   = { character.pos[0], SHADOW_GROUND_Y, character.pos[2] };
+    float shadowPos[3]   = { pos[0], groundY, pos[2] };
     float shadowRot[3]   = { 0.0f, 0.0f, 0.0f };
     float shadowScale[3] = {
         character.scale[0] * 2.25f * shrink,
@@ -797,22 +714,8 @@ static inline void anim_stop_all_except_two(T3DAnim** set, int count, int keepA,
 
 static inline bool character_sword_world_segment(float outBase[3], float outTip[3])
 {
-    if (characterSwordBoneIndex < 0 || !character.skeleton || !character.modelMat) return false;
-
-    T3DSkeleton *sk = (T3DSkeleton*)character.skeleton;
-    const T3DMat4FP *B = &sk->boneMatricesFP[characterSwordBoneIndex];
-    const T3DMat4FP *M = (const T3DMat4FP*)character.modelMat;
-
-    const float p0_local[3] = { 0.0f, 0.0f, 0.0f };
-    const float p1_local[3] = { -SWORD_LENGTH, 0.0f, 0.0f };
-
-    float p0_model[3], p1_model[3];
-    mat4fp_mul_point_f32_row3_colbasis(B, p0_local, p0_model);
-    mat4fp_mul_point_f32_row3_colbasis(B, p1_local, p1_model);
-
-    mat4fp_mul_point_f32_row3_colbasis(M, p0_model, outBase);
-    mat4fp_mul_point_f32_row3_colbasis(M, p1_model, outTip);
-    return true;
+    return bone_cache_world_segment(&character.boneCache, character.skeleton, character.modelMat,
+        characterSwordBoneIndex, SWORD_LENGTH, outBase, outTip);
 }
 
 /* -----------------------------------------------------------------------------
@@ -898,7 +801,7 @@ static inline bool try_free_locomotion_speed_blend(float speedRatio, CharacterSt
     if (state != CHAR_STATE_NORMAL) return false;
     if (cameraLockOnActive) return false;
     if (character.isBlending) return false; // don't fight your existing crossfades
-    if (!character.animations || !character.skeleton || !character.skeletonBlend) return false;
+    if (!character.animations || !character.skeleton) return false;
 
     // Not moving => let normal system handle idle etc.
     if (speedRatio <= IDLE_THRESHOLD) return false;
@@ -936,18 +839,13 @@ static inline bool try_free_locomotion_speed_blend(float speedRatio, CharacterSt
     T3DAnim* walkA = character.animations[walkAnim];
     T3DAnim* runA  = character.animations[runAnim];
 
-    // ---------------------------------------------------------------------
-    // CRITICAL FIX:
-    // Always ensure attachments are correct for this mode.
-    // "s_freeBlend" was not sufficient because other paths can attach ANIM_RUN
-    // to the main skeleton, leaving runA writing into the wrong skeleton.
-    // ---------------------------------------------------------------------
+    // Both clips sample into the main skeleton (pose_blend folds them together)
     if (lastAttachedMain != walkAnim) {
         t3d_anim_attach(walkA, character.skeleton);
         lastAttachedMain = walkAnim;
     }
     if (lastAttachedBlend != runAnim) {
-        t3d_anim_attach(runA, character.skeletonBlend);
+        t3d_anim_attach(runA, character.skeleton);
         lastAttachedBlend = runAnim;
     }
 
@@ -967,7 +865,8 @@ static inline bool try_free_locomotion_speed_blend(float speedRatio, CharacterSt
     // Phase-locked update:
     // Walk advances normally. Run is slaved to walk's phase.
     // ---------------------------------------------------------------------
-    t3d_anim_update(walkA, dt);
+    pose_blend_begin(character.skeleton);
+    pose_blend_clip(walkA, dt, 1.0f - wRun);
 
     float walkLen = t3d_anim_get_length(walkA);
     float walkT   = t3d_anim_get_time(walkA);
@@ -979,9 +878,6 @@ static inline bool try_free_locomotion_speed_blend(float speedRatio, CharacterSt
         phase = walkT / walkLen;
     }
 
-    // Prime blend skeleton from walk pose first
-    skeleton_copy_pose_bones(character.skeletonBlend, character.skeleton);
-
     float runLen = t3d_anim_get_length(runA);
     if (runLen > 0.0001f) {
         float runT = phase * runLen;
@@ -991,11 +887,10 @@ static inline bool try_free_locomotion_speed_blend(float speedRatio, CharacterSt
     }
 
     // Sample run pose at that time without advancing
-    t3d_anim_update(runA, 0.0f);
-
-    // Blend run into walk on main skeleton
-    t3d_skeleton_blend(character.skeleton, character.skeleton, character.skeletonBlend, wRun);
+    pose_blend_clip(runA, 0.0f, wRun);
+    pose_blend_end();
     t3d_skeleton_update(character.skeleton);
+    bone_cache_invalidate(&character.boneCache);
 
     // Keep state machine sane
     character.currentAnimation = (wRun >= 0.5f) ? runAnim : walkAnim;
@@ -1366,22 +1261,20 @@ static inline bool try_lockon_locomotion_blend(float speedRatio, CharacterState
     }
 
     // ------------------------------------------------------------
-    // Strafe on blend skeleton
+    // Strafe over the base (same skeleton), crossfaded from the current pose
     // ------------------------------------------------------------
     if (strafeChanged) {
-        if (character.skeletonBlend) {
-            pose_capture(&strafeFromPose, character.skeletonBlend);
-            strafePoseBlendT   = 0.0f;
-            strafePoseBlendDur = 0.10f;
-            strafePoseBlending = true;
-        }
+        anim_pose_capture(&blendFromPose, character.skeleton);
+        strafePoseBlendT   = 0.0f;
+        strafePoseBlendDur = 0.10f;
+        strafePoseBlending = true;
 
         if (activeBlendAnim != -1 && activeBlendAnim != strafeAnim) {
             anim_stop(character.animations, activeBlendAnim);
         }
         activeBlendAnim = strafeAnim;
 
-        anim_bind_and_play(character.animations, strafeAnim, character.skeletonBlend, true, false);
+        anim_bind_and_play(character.animations, strafeAnim, character.skeleton, true, false);
 
         lastAttachedBlend  = strafeAnim;
         lastStrafeAnimLock = strafeAnim;
@@ -1414,27 +1307,30 @@ static inline bool try_lockon_locomotion_blend(float speedRatio, CharacterState
     }
 
     // ------------------------------------------------------------
-    // Update order
+    // One blend: base, strafe over it, and the crossfade across
+    // left/right switches. The strafe samples after the base, so bones it
+    // doesn't key keep the base pose.
     // ------------------------------------------------------------
-    t3d_anim_update(character.animations[baseAnim], dt);
-
-    // Prime blend skeleton from base pose first (prevents bind-pose on unkeyed bones)
-    skeleton_copy_pose_bones(character.skeletonBlend, character.skeleton);
-
-    t3d_anim_update(character.animations[strafeAnim], dt);
-
-    // Crossfade across left/right switches
+    float fade = 1.0f;
     if (strafePoseBlending) {
         strafePoseBlendT += dt;
         float t = (strafePoseBlendDur > 0.0f) ? (strafePoseBlendT / strafePoseBlendDur) : 1.0f;
         if (t >= 1.0f) { t = 1.0f; strafePoseBlending = false; }
-        t = smoothstep01(t);
-        pose_blend_into_skeleton(&strafeFromPose, character.skeletonBlend, t);
+        fade = smoothstep01(t);
     }
 
     float w = fminf(1.0f, fmaxf(0.0f, animStrafeBlendRatio));
-    t3d_skeleton_blend(character.skeleton, character.skeleton, character.skeletonBlend, w);
+    pose_blend_begin(character.skeleton);
+    if (strafeAnim == baseAnim) {
+        pose_blend_clip(character.animations[baseAnim], dt, fade);
+    } else {
+        pose_blend_clip(character.animations[baseAnim], dt, (1.0f - w) * fade);
+        pose_blend_clip(character.animations[strafeAnim], dt, w * fade);
+    }
+    pose_blend_pose(&blendFromPose, 1.0f - fade);
+    pose_blend_end();
     t3d_skeleton_update(character.skeleton);
+    bone_cache_invalidate(&character.boneCache);
 
     return true;
 }
@@ -1470,9 +1366,9 @@ static void switch_to_action_animation(int targetAnim)
     if (character.previousAnimation >= 0 &&
         character.previousAnimation < character.animationCount &&
         character.animations[character.previousAnimation] &&
-        character.skeleton && character.skeletonBlend)
+        character.skeleton)
     {
-        skeleton_copy_pose_bones(character.skeletonBlend, character.skeleton);
+        anim_pose_capture(&blendFromPose, character.skeleton);
         hasBlendSnapshot = true;
     }
 
@@ -1488,7 +1384,7 @@ static void switch_to_action_animation(int targetAnim)
 
         // PRIME from snapshot so first update isn't bind pose
         if (hasBlendSnapshot) {
-            skeleton_prime_from_pose(character.skeleton, character.skeletonBlend);
+            anim_pose_apply(&blendFromPose, character.skeleton);
         }
 
         t3d_anim_set_looping(character.animations[targetAnim], false);
@@ -1785,10 +1681,10 @@ static void switch_to_locomotion_animation(int targetAnim)
             prevClip = character.previousAnimation;
 
         if (prevClip >= 0 && prevClip < character.animationCount &&
-            character.animations[prevClip] && character.skeleton && character.skeletonBlend)
+            character.animations[prevClip] && character.skeleton)
         {
             // Snapshot FROM pose (bones currently on main skeleton)
-            skeleton_copy_pose_bones(character.skeletonBlend, character.skeleton);
+            anim_pose_capture(&blendFromPose, character.skeleton);
             hasBlendSnapshot = true;
             startCrossfade   = true;
             crossfadeDur     = 0.12f;
@@ -1798,8 +1694,8 @@ static void switch_to_locomotion_animation(int targetAnim)
         const bool fromIsLocomotion = is_locomotion_anim(fromAnim);
         const bool toIsLocomotion   = is_locomotion_anim(targetAnim);
 
-        if (fromIsLocomotion && toIsLocomotion && character.skeleton && character.skeletonBlend) {
-            skeleton_copy_pose_bones(character.skeletonBlend, character.skeleton);
+        if (fromIsLocomotion && toIsLocomotion && character.skeleton) {
+            anim_pose_capture(&blendFromPose, character.skeleton);
             hasBlendSnapshot = true;
             startCrossfade   = true;
             crossfadeDur     = LOCOMOTION_CROSSFADE_DURATION;
@@ -1818,7 +1714,7 @@ static void switch_to_locomotion_animation(int targetAnim)
         // CRITICAL: attach() can reset bones -> prime skeleton with FROM pose snapshot
         // so the very first anim_update starts from the previous pose, not bind pose.
         if (startCrossfade && hasBlendSnapshot) {
-            skeleton_prime_from_pose(character.skeleton, character.skeletonBlend);
+            anim_pose_apply(&blendFromPose, character.skeleton);
         }
 
         bool shouldLoop = (targetAnim == ANIM_IDLE || targetAnim == ANIM_IDLE_TITLE || targetAnim == ANIM_WALK ||
@@ -1913,10 +1809,10 @@ static inline void apply_run_end_transition(CharacterState state, float speedRat
 //     }
 // }
 
-static inline void update_animations(float speedRatio, CharacterState state, float dt,
-                                     float velMag, float inputMag)
+static inline void update_animations_pose(float speedRatio, CharacterState state, float dt,
+                                          float velMag, float inputMag)
 {
-    if (!character.animations || !character.skeleton || !character.skeletonBlend) return;
+    if (!character.animations || !character.skeleton) return;
 
     const bool lockonBlendMode = (state == CHAR_STATE_NORMAL &&
                                  cameraLockOnActive &&
@@ -1975,8 +1871,9 @@ static inline void update_animations(float speedRatio, CharacterState state, flo
 
     // Drive current anim
     const int cur = character.currentAnimation;
+    T3DAnim* currentAnim = NULL;
     if (cur >= 0 && cur < character.animationCount && character.animations[cur]) {
-        T3DAnim* currentAnim = character.animations[cur];
+        currentAnim = character.animations[cur];
 
         if (lastAttachedMain != cur) {
             t3d_anim_attach(currentAnim, character.skeleton);
@@ -2004,18 +1901,29 @@ static inline void update_animations(float speedRatio, CharacterState state, flo
             t3d_anim_set_speed(currentAnim, animSpeed);
             lastAnimSpeed = animSpeed;
         }
-
-        t3d_anim_update(currentAnim, dt);
     }
 
     if (character.isBlending && hasBlendSnapshot) {
-        t3d_skeleton_blend(character.skeleton,
-                           character.skeletonBlend,
-                           character.skeleton,
-                           character.blendFactor);
+        pose_blend_begin(character.skeleton);
+        pose_blend_clip(currentAnim, dt, character.blendFactor);
+        pose_blend_pose(&blendFromPose, 1.0f - character.blendFactor);
+        pose_blend_end();
+    } else if (currentAnim) {
+        t3d_anim_update(currentAnim, dt);
     }
 
     t3d_skeleton_update(character.skeleton);
+    bone_cache_invalidate(&character.boneCache);
+}
+
+// Gameplay rig: the scheduler always runs it, this only accounts its cost
+static inline void update_animations(float speedRatio, CharacterState state, float dt,
+                                     float velMag, float inputMag)
+{
+    float animDt;
+    if (!anim_rig_begin(&character.animRig, dt, &animDt)) return;
+    update_animations_pose(speedRatio, state, animDt, velMag, inputMag);
+    anim_rig_end(&character.animRig);
 }
 
 /* -----------------------------------------------------------------------------
@@ -2032,9 +1940,6 @@ void character_init(void)
     T3DSkeleton* skeleton = malloc(sizeof(T3DSkeleton));
     *skeleton = t3d_skeleton_create(characterModel);
 
-    T3DSkeleton* skeletonBlend = malloc(sizeof(T3DSkeleton));
-    *skeletonBlend = t3d_skeleton_clone(skeleton, false);
-
     characterSwordBoneIndex = t3d_skeleton_find_bone(skeleton, "Hand-Right");
 
     const int animationCount = ANIM_COUNT;
@@ -2126,7 +2031,6 @@ void character_init(void)
         .scale = {MODEL_SCALE, MODEL_SCALE, MODEL_SCALE},
         .scrollParams = NULL,
         .skeleton = skeleton,
-        .skeletonBlend = skeletonBlend,
         .animations = animations,
         .currentAnimation = 0,
         .previousAnimation = -1,
@@ -2150,6 +2054,8 @@ void character_init(void)
 
     t3d_mat4fp_identity(newCharacter.modelMat);
     t3d_mat4fp_identity(newCharacter.shadowMat);
+    bone_cache_reset(&newCharacter.boneCache);
+    anim_rig_init(&newCharacter.animRig, "knight", ANIM_PRIORITY_GAMEPLAY);
 
     character = newCharacter;
 
@@ -2488,7 +2394,51 @@ void character_update_position(void)
         (float[3]){character.rot[0], character.rot[1] + MODEL_YAW_OFFSET, character.rot[2]},
         (float[3]){character.pos[0], character.pos[1], character.pos[2]}
     );
-    character_update_shadow_mat();
+    bone_cache_invalidate(&character.boneCache);
+    character_update_shadow_mat(character.pos);
+}
+
+void character_interp_capture(void)
+{
+    for (int i = 0; i < 3; i++) {
+        character.prevPos[i] = character.pos[i];
+        character.prevRot[i] = character.rot[i];
+    }
+}
+
+// Anything further than this in one step is a teleport (restart, cutscene placement)
+static float character_interp_alpha(float alpha)
+{
+    const float SNAP_DIST = 150.0f;
+    float dx = character.pos[0] - character.prevPos[0];
+    float dy = character.pos[1] - character.prevPos[1];
+    float dz = character.pos[2] - character.prevPos[2];
+    return (dx*dx + dy*dy + dz*dz > SNAP_DIST * SNAP_DIST) ? 1.0f : alpha;
+}
+
+void character_interp_position(float alpha, float out[3])
+{
+    alpha = character_interp_alpha(alpha);
+    for (int i = 0; i < 3; i++) {
+        out[i] = character.prevPos[i] + (character.pos[i] - character.prevPos[i]) * alpha;
+    }
+}
+
+void character_interp_apply(float alpha)
+{
+    if (!character.modelMat) return;
+
+    alpha = character_interp_alpha(alpha);
+    float pos[3], rot[3];
+    for (int i = 0; i < 3; i++) {
+        pos[i] = character.prevPos[i] + (character.pos[i] - character.prevPos[i]) * alpha;
+        rot[i] = character.prevRot[i] + wrap_pi(character.rot[i] - character.prevRot[i]) * alpha;
+    }
+    rot[1] += MODEL_YAW_OFFSET;
+
+    t3d_mat4fp_from_srt_euler(character.modelMat, character.scale, rot, pos);
+    bone_cache_invalidate(&character.boneCache);
+    character_update_shadow_mat(pos);
 }
 
 void character_update_camera(void)
@@ -2633,7 +2583,7 @@ void character_draw_shadow(void)
     if (!character.visible) return;
     if (!character.dpl_shadow || !character.shadowMat) return;
 
-    float h = character.pos[1] - SHADOW_GROUND_Y;
+    float h = character.pos[1] - collision_mesh_floor_height(character.pos[0], character.pos[1], character.pos[2], SHADOW_GROUND_Y);
     if (h < 0.0f) h = 0.0f;
 
     float t = h / JUMP_HEIGHT;
@@ -2768,12 +2718,6 @@ void character_delete(void)
         character.skeleton = NULL;
     }
 
-    if (character.skeletonBlend) {
-        t3d_skeleton_destroy(character.skeletonBlend);
-        free(character.skeletonBlend);
-        character.skeletonBlend = NULL;
-    }
-
     if (character.animations) {
         for (int i = 0; i < character.animationCount; i++) {
             if (character.animations[i]) {
@@ -7,6 +7,8 @@
 #include <t3d/t3danim.h>
 
 #include "general_utility.h"
+#include "bone_cache.h"
+#include "anim_scheduler.h"
 
 // Animation states - these correspond to the animation indices
 typedef enum {
@@ -61,10 +63,12 @@ typedef struct {
     float rot[3];
     float scale[3];
 
+    // Transform at the start of the current fixed step (render interpolation)
+    float prevPos[3];
+    float prevRot[3];
+
     ScrollParams *scrollParams;
     T3DSkeleton *skeleton;
-    T3DSkeleton *skeletonBlend;
-    T3DSkeleton *skeletonLocomotion;
     T3DAnim **animations;
     int currentAnimation;
     int previousAnimation;
@@ -82,6 +86,8 @@ typedef struct {
     // Matrices
     T3DMat4FP *modelMat;     // character transform
     T3DMat4FP *shadowMat;    // ground-locked shadow transform
+    BoneCache boneCache;     // world transforms of bones read back this pose
+    AnimRig animRig;         // animation LOD bookkeeping (gameplay: always full rate)
 
     // Display lists
     rspq_block_t *dpl_model;   // skinned character
@@ -109,6 +115,12 @@ void character_reset(void);
 void character_update_position(void);
 void character_update_camera(void);
 
+// Render interpolation between fixed simulation steps
+void character_interp_capture(void);
+void character_interp_apply(float alpha);
+// Knight position as character_interp_apply draws it
+void character_interp_position(float alpha, float out[3]);
+
 void character_draw(void);
 void character_draw_shadow(void);
 void character_draw_ui(void);
@@ -34,13 +34,19 @@
 #include "display_utility.h"
 #include "menu_controller.h"
 #include "save_controller.h"
-//#include "collision_mesh.h"
+#include "collision_mesh.h"
 #include "collision_system.h"
+#include "collision_world.h"
+#include "quality_governor.h"
+#include "anim_scheduler.h"
+#include "render_scale_utility.h"
 #include "letterbox_utility.h"
 #include "utilities/sword_trail.h"
 
 // TODO: This should not be declared in the header file, as it is only used externally (temp)
 #include "dev.h"
+#include "cpu_timers.h"
+#include "collision_stats.h"
 #include "debug_draw.h"
 #include "utilities/simple_collision_utility.h"
 
@@ -59,6 +65,28 @@ static void ground_crush_reset(void);
 static void ground_crush_update(float dt);
 static void ground_crush_draw(T3DViewport *viewport);
 
+// Gameplay subsystems wrapped in dev CPU timers (no-ops outside DEV_MODE)
+static inline void scene_timed_character_update(void)
+{
+    uint32_t t = cpu_timer_begin();
+    character_update();
+    cpu_timer_end(CPU_TIMER_CHARACTER_UPDATE, t);
+}
+
+static inline void scene_timed_boss_update(Boss *boss)
+{
+    uint32_t t = cpu_timer_begin();
+    boss_update(boss);
+    cpu_timer_end(CPU_TIMER_BOSS_UPDATE, t);
+}
+
+static inline void scene_timed_collision_update(void)
+{
+    uint32_t t = cpu_timer_begin();
+    collision_update();
+    cpu_timer_end(CPU_TIMER_COLLISION_UPDATE, t);
+}
+
 static void boot_reinit_display_rdpq(void)
 {
     // The logo routines call display_close(), so we must restore a valid display + RDPQ
@@ -158,6 +186,13 @@ static T3DMat4FP* cutsceneChainBreakMatrix;
 static T3DSkeleton* cutsceneChainBreakSkeleton; 
 static T3DAnim** cutsceneChainBreakAnimations = NULL;
 
+// Animation LOD for the cosmetic rigs (see anim_scheduler.h)
+#define SCENE_RIG_PAD 40.0f  // mesh around the bone origins, world units
+static AnimRig dynamicBannerRig;
+static AnimRig cinematicChainsRig;
+static AnimRig cutsceneChainBreakRig;
+static float dynamicBannerOffset[3];
+
 static int currentTitleDialog = 0;
 static float titleTextActivationTimer = 0.0f;
 static float titleTextActivationTime = 50.0f;
@@ -199,7 +234,9 @@ static bool bossDeathMusicFadeStarted = false;
 #define WALL_THICKNESS 20.0f
 #define WALL_HEIGHT   200.0f
 
-static SCU_OBB g_roomOBBs[] = {
+// Hand-placed boxes, used until the room .glb has a COLLISION node for the
+// exporter to fit (filesystem/bossroom/bossroom.obb)
+static const SCU_OBB g_roomOBBsHandPlaced[] = {
 
     // -------------------------------------------------
     // right wall
@@ -301,7 +338,14 @@ static SCU_OBB g_roomOBBs[] = {
     },
 };
 
-static const int g_roomOBBCount = sizeof(g_roomOBBs) / sizeof(g_roomOBBs[0]);
+#define ROOM_OBB_HAND_PLACED_COUNT (int)(sizeof(g_roomOBBsHandPlaced) / sizeof(g_roomOBBsHandPlaced[0]))
+_Static_assert(ROOM_OBB_HAND_PLACED_COUNT <= SCU_STATIC_OBB_MAX, "room boxes exceed the static set");
+
+static SCU_OBB g_roomOBBs[SCU_STATIC_OBB_MAX];
+static int g_roomOBBCount = 0;
+
+// g_roomOBBs baked at init: the boxes never move, so their rotation frames are computed once
+static SCU_StaticOBBSet g_roomStatic;
 
 #define TITLE_DIALOG_COUNT (sizeof(titleDialogs) / sizeof(titleDialogs[0]))
 
@@ -528,47 +572,108 @@ static void scene_get_character_world_capsule(float capA[3], float capB[3], floa
     *radius = character.capsuleCollider.radius * character.scale[0];
 }
 
-void scene_resolve_character_room_obbs(void)
-{
-    // more iterations => less corner tunneling / less “elastic”
-    for (int iter = 0; iter < 8; iter++) {
-        float capA[3], capB[3], r;
-        scene_get_character_world_capsule(capA, capB, &r);
+// Move-and-slide: one sweep along the step's motion plus at most two slides
+#define CHARACTER_SLIDE_PASSES 2
+#define CHARACTER_SWEEP_SKIN 0.05f // stop this far short of a contact
+#define CHARACTER_SWEEP_MIN_MOVE 1e-4f
+#define CHARACTER_DEPENETRATE_PASSES 4 // start-of-move push-outs, deepest box first
 
-        float vx, vz;
-        character_get_velocity(&vx, &vz);
+// Earliest contact for the character capsule moving by (mx, mz) this step,
+// across the room OBBs and the collision mesh walls.
+static bool scene_sweep_character(const float capA[3], const float capB[3], float r,
+    float mx, float mz, float *toi, float n[3])
+{
+    bool hit = false;
+    *toi = 1.0f;
+
+    float t, hn[3];
+    collision_stat_add(COLLISION_STAT_CAPSULE_OBB, (uint32_t)g_roomStatic.count);
+    if (scu_capsule_sweep_static_obbs_xz_f(&g_roomStatic, capA, capB, r, mx, mz, &t, hn)) {
+        *toi = t;
+        n[0] = hn[0]; n[1] = 0.0f; n[2] = hn[2];
+        hit = true;
+    }
 
-        bool any = false;
+    if (collision_mesh_sweep_capsule(capA, capB, r, mx, mz, &t, hn) && t < *toi) {
+        *toi = t;
+        n[0] = hn[0]; n[1] = 0.0f; n[2] = hn[2];
+        hit = true;
+    }
+    return hit;
+}
 
-        for (int i = 0; i < g_roomOBBCount; i++) {
-            float push[3];
-            float n[3];
+// Replays this step's XZ motion (startPos -> character.pos) as a swept
+// capsule, so a long frame can't carry the character through a wall or a
+// pillar. Each contact stops the move at the time of impact and slides the
+// rest along the surface; velocity loses its inward component the same way.
+static void scene_move_character_in_room(const float startPos[3])
+{
+    float moveX = character.pos[0] - startPos[0];
+    float moveZ = character.pos[2] - startPos[2];
+    character.pos[0] = startPos[0];
+    character.pos[2] = startPos[2];
 
-            if (scu_capsule_vs_obb_push_xz_f(capA, capB, r, &g_roomOBBs[i], push, n)) {
+    float capA[3], capB[3], r;
+    scene_get_character_world_capsule(capA, capB, &r);
 
-                // push out (world)
-                character.pos[0] += push[0];
-                character.pos[2] += push[2];
+    // Motion that isn't swept (spawns, dev tools) can leave the start inside a
+    // box. Resolve the deepest contact and re-test, so boxes that overlap or
+    // share a face don't push the same penetration out twice.
+    for (int pass = 0; pass < CHARACTER_DEPENETRATE_PASSES; pass++) {
+        SCU_Contact contact;
+        collision_stat_add(COLLISION_STAT_CAPSULE_OBB, (uint32_t)g_roomStatic.count);
+        if (!scu_capsule_vs_static_obbs_deepest_xz_f(&g_roomStatic, capA, capB, r, &contact)) break;
+
+        collision_stat_add(COLLISION_STAT_ROOM_PASSES, 1);
+        const float *push = contact.push;
+        character.pos[0] += push[0];
+        character.pos[2] += push[2];
+        capA[0] += push[0]; capA[2] += push[2];
+        capB[0] += push[0]; capB[2] += push[2];
+    }
 
-                // IMPORTANT: keep capsule in sync for subsequent OBB checks THIS iter
-                capA[0] += push[0]; capA[2] += push[2];
-                capB[0] += push[0]; capB[2] += push[2];
+    float vx, vz;
+    character_get_velocity(&vx, &vz);
 
-                // slide: remove inward velocity component (vn < 0 means into the surface)
-                float vn = vx * n[0] + vz * n[2];
-                if (vn < 0.0f) {
-                    vx -= vn * n[0];
-                    vz -= vn * n[2];
-                }
+    for (int pass = 0; pass <= CHARACTER_SLIDE_PASSES; pass++) {
+        float len = sqrtf(moveX * moveX + moveZ * moveZ);
+        if (len < CHARACTER_SWEEP_MIN_MOVE) break;
 
-                any = true;
-            }
+        collision_stat_add(COLLISION_STAT_ROOM_PASSES, 1);
+        float toi, n[3];
+        if (!scene_sweep_character(capA, capB, r, moveX, moveZ, &toi, n)) {
+            character.pos[0] += moveX;
+            character.pos[2] += moveZ;
+            break;
         }
 
-        character_set_velocity_xz(vx, vz);
+        // Advance to the contact, minus the skin
+        float t = fmaxf(toi - CHARACTER_SWEEP_SKIN / len, 0.0f);
+        float stepX = moveX * t;
+        float stepZ = moveZ * t;
+        character.pos[0] += stepX;
+        character.pos[2] += stepZ;
+        capA[0] += stepX; capA[2] += stepZ;
+        capB[0] += stepX; capB[2] += stepZ;
+
+        // Slide the remainder along the contact (mn < 0 means into the surface)
+        moveX -= stepX;
+        moveZ -= stepZ;
+        float mn = moveX * n[0] + moveZ * n[2];
+        if (mn < 0.0f) {
+            moveX -= mn * n[0];
+            moveZ -= mn * n[2];
+        }
 
-        if (!any) break;
+        float vn = vx * n[0] + vz * n[2];
+        if (vn < 0.0f) {
+            vx -= vn * n[0];
+            vz -= vn * n[2];
+        }
     }
+    // Motion left after the last slide is pinned in a corner; dropping it is correct.
+
+    character_set_velocity_xz(vx, vz);
 }
 
 static void scene_begin_video_preroll(void)
@@ -592,6 +697,7 @@ static void scene_update_video_trigger(void)
     float capA[3], capB[3], r;
     scene_get_character_world_capsule(capA, capB, &r);
 
+    collision_stat_add(COLLISION_STAT_CAPSULE_AABB, 1);
     if (scu_capsule_vs_rect_f(capA, capB, r, videoTrigMin, videoTrigMax)) {
         scene_begin_video_preroll();
     }
@@ -810,6 +916,7 @@ void scene_load_environment(){
     cinematicChainsDpl = rspq_block_end(); 
     cinematicChainsMatrix = malloc_uncached(sizeof(T3DMat4FP)); 
     t3d_mat4fp_from_srt_euler(cinematicChainsMatrix, (float[3]){MODEL_SCALE, MODEL_SCALE, MODEL_SCALE}, (float[3]){0.0f, 0.0f, 0.0f}, (float[3]){0.0f, 0.0f, 0.0f} );
+    anim_rig_init(&cinematicChainsRig, "chains", ANIM_PRIORITY_CINEMATIC);
 
     // ===== LOAD Chain Break =====
     cutsceneChainBreakModel = t3d_model_load("rom:/cutscene/shatter_chain.t3dm"); 
@@ -832,6 +939,7 @@ void scene_load_environment(){
     cutsceneChainBreakDpl = rspq_block_end(); 
     cutsceneChainBreakMatrix = malloc_uncached(sizeof(T3DMat4FP)); 
     t3d_mat4fp_from_srt_euler(cutsceneChainBreakMatrix, (float[3]){MODEL_SCALE, MODEL_SCALE, MODEL_SCALE}, (float[3]){0.0f, 0.0f, 0.0f}, (float[3]){0.0f, 0.0f, 0.0f} );
+    anim_rig_init(&cutsceneChainBreakRig, "chain break", ANIM_PRIORITY_CINEMATIC);
 
 }
 
@@ -862,6 +970,8 @@ static void scene_title_init_dynamic_banner_assets(void)
     dynamicBannerDpl = rspq_block_end(); 
     dynamicBannerMatrix = malloc_uncached(sizeof(T3DMat4FP)); 
     t3d_mat4fp_from_srt_euler(dynamicBannerMatrix, (float[3]){MODEL_SCALE, MODEL_SCALE, MODEL_SCALE}, (float[3]){0.0f, 0.0f, 0.0f}, (float[3]){0.0f, roomY, 0.0f} );
+    dynamicBannerOffset[1] = roomY;
+    anim_rig_init(&dynamicBannerRig, "banner", ANIM_PRIORITY_AMBIENT);
 }
 
 static void scene_title_init(void)
@@ -898,6 +1008,7 @@ static void scene_title_init(void)
     if (dynamicBannerAnimations && dynamicBannerAnimations[0]) {
         t3d_anim_set_time(dynamicBannerAnimations[0], 0.0f);
         t3d_anim_set_playing(dynamicBannerAnimations[0], true);
+        anim_rig_reset_time(&dynamicBannerRig);
     }
 
     // Start Dialog
@@ -940,8 +1051,11 @@ void scene_init(void)
     // NOTE: If collision wireframe doesn't match the rendered room, adjust this scale.
     // The exported bossroom.collision is in glb units (~ +/- 100). Using 0.1 made the
     // collision volume a tiny square; start with 1.0 for now.
-    // collision_mesh_set_transform(6.2f, 0.0f, roomY, 0.0f);
-    // collision_mesh_init();
+    // The transform also places the exported mesh (bossroom.col) and room boxes
+    // (bossroom.obb) loaded below. room.glb has no COLLISION node yet, so neither
+    // file exists (see COLLISION_EXPORT in the Makefile): the mesh stays empty and
+    // the room collides through the hand-placed OBBs.
+    collision_mesh_set_transform(6.2f, 0.0f, roomY, 0.0f);
 
     scene_load_environment();
     
@@ -1032,6 +1146,21 @@ void scene_init(void)
 
     collision_init();
 
+    // Exported mesh and boxes are in glb units; the collision mesh transform set
+    // above moves them into the world space of the hand-placed ones. Without a
+    // .col the mesh walls, floor grid and raycast find nothing.
+    collision_mesh_load_binary("rom:/bossroom/bossroom.col");
+    g_roomOBBCount = collision_mesh_load_room_obbs("rom:/bossroom/bossroom.obb", g_roomOBBs, SCU_STATIC_OBB_MAX);
+    if (g_roomOBBCount == 0) {
+        memcpy(g_roomOBBs, g_roomOBBsHandPlaced, sizeof(g_roomOBBsHandPlaced));
+        g_roomOBBCount = ROOM_OBB_HAND_PLACED_COUNT;
+    }
+    scu_static_obbs_bake(&g_roomStatic, g_roomOBBs, g_roomOBBCount);
+    for (int i = 0; i < g_roomOBBCount; i++) {
+        CollisionBodyId id = collision_world_add(COLLISION_SHAPE_OBB, COLLISION_LAYER_STATIC, 0, i);
+        collision_world_set_obb(id, &g_roomOBBs[i]);
+    }
+
     scene_title_init();
 
     dust_reset();
@@ -1197,21 +1326,12 @@ static inline float scene_dist_xz(float ax, float az, float bx, float bz) {
 static bool scene_get_boss_bone_world_pos(int boneIndex, T3DVec3 *outWorld)
 {
     if (!outWorld) return false;
-    if (!g_boss || !g_boss->skeleton || !g_boss->modelMat) return false;
-    if (boneIndex < 0) return false;
-
-    T3DSkeleton* skel = (T3DSkeleton*)g_boss->skeleton;
-    const T3DMat4FP* boneMat = &skel->boneMatricesFP[boneIndex];
-    const T3DMat4FP* modelMat = (const T3DMat4FP*)g_boss->modelMat;
+    if (!g_boss) return false;
 
-    const float boneLocal[3] = { 0.0f, 0.0f, 0.0f };
-    float boneModel[3];
-    mat4fp_mul_point_f32_row3_colbasis(boneMat, boneLocal, boneModel);
+    const float (*W)[3] = bone_cache_world(&g_boss->boneCache, g_boss->skeleton, g_boss->modelMat, boneIndex);
+    if (!W) return false;
 
-    float boneWorld[3];
-    mat4fp_mul_point_f32_row3_colbasis(modelMat, boneModel, boneWorld);
-
-    *outWorld = (T3DVec3){{ boneWorld[0], boneWorld[1], boneWorld[2] }};
+    *outWorld = (T3DVec3){{ W[3][0], W[3][1], W[3][2] }};
     return true;
 }
 
@@ -1421,6 +1541,10 @@ GameState scene_get_game_state(void) {
     return gameState;
 }
 
+CutsceneState scene_get_cutscene_state(void) {
+    return cutsceneState;
+}
+
 void scene_set_game_state(GameState state) {
     if (state == gameState) return;
 
@@ -1627,6 +1751,7 @@ void scene_init_cutscene()
         case CUTSCENE_PHASE1_BREAK_CHAINS:
             screenTransition = false;
             cutsceneDialogActive = false;
+            anim_rig_reset_time(&cutsceneChainBreakRig);
             scene_set_cinematic_camera((T3DVec3){{-22.31f, 1.7f, 0.65f}}, (T3DVec3){{-42.31f, 1.7f, 0.65f}}, (T3DVec3){{-12.31f, 1.7f, 0.65f}});
             break;
         case CUTSCENE_PHASE1_INTRO_END:
@@ -1638,6 +1763,7 @@ void scene_init_cutscene()
             currentCinematicChainsAnimation = 1;
             t3d_anim_set_looping(cinematicChainsAnimations[currentCinematicChainsAnimation], false); 
             t3d_anim_set_playing(cinematicChainsAnimations[currentCinematicChainsAnimation], true); 
+            anim_rig_reset_time(&cinematicChainsRig);
 
             screenTransition = true;
             startScreenFade = true;
@@ -1732,12 +1858,33 @@ void scene_init_cutscene()
     }
 }
 
+// Jump from anywhere straight into the fight, as if the intro cutscene was skipped.
+void scene_start_fight_skip_intro(void)
+{
+    cutsceneState = CUTSCENE_PHASE1_INTRO;
+    cutsceneTimer = 0.0f;
+    cutsceneCameraTimer = 0.0f;
+    scene_init_cutscene();
+    scene_init_playing(true);
+}
+
 static inline float ease_in_out(float x) {
     if (x < 0.0f) x = 0.0f;
     if (x > 1.0f) x = 1.0f;
     return x * x * (3.0f - 2.0f * x);
 }
 
+// Poses a cosmetic skeleton when the scheduler gives its rig this step
+static void scene_rig_update(AnimRig *rig, T3DAnim *anim, T3DSkeleton *skeleton, const float offset[3])
+{
+    float animDt;
+    if (!anim_rig_begin(rig, deltaTime, &animDt)) return;
+    t3d_anim_update(anim, animDt);
+    t3d_skeleton_update(skeleton);
+    anim_rig_fit_skeleton(rig, skeleton, MODEL_SCALE, offset, SCENE_RIG_PAD);
+    anim_rig_end(rig);
+}
+
 void scene_cutscene_update()
 {
     // Update cutscene state
@@ -1747,13 +1894,14 @@ void scene_cutscene_update()
         cutsceneCameraTimer += deltaTime;
     }
     
-    t3d_anim_update(cinematicChainsAnimations[currentCinematicChainsAnimation], deltaTime);
-    t3d_skeleton_update(cinematicChainsSkeleton);
+    anim_rig_set_visible(&cinematicChainsRig, cinematicChainsVisible);
+    scene_rig_update(&cinematicChainsRig, cinematicChainsAnimations[currentCinematicChainsAnimation],
+        cinematicChainsSkeleton, (float[3]){0.0f, 0.0f, 0.0f});
 
     if(cutsceneState == CUTSCENE_PHASE1_BREAK_CHAINS)
     {
-        t3d_anim_update(cutsceneChainBreakAnimations[0], deltaTime);
-        t3d_skeleton_update(cutsceneChainBreakSkeleton);
+        scene_rig_update(&cutsceneChainBreakRig, cutsceneChainBreakAnimations[0],
+            cutsceneChainBreakSkeleton, (float[3]){0.0f, 0.0f, 0.0f});
     }
 
     if (g_boss) {
@@ -1762,6 +1910,7 @@ void scene_cutscene_update()
         T3DMat4FP* mat = (T3DMat4FP*)g_boss->modelMat;
         if (mat) {
             t3d_mat4fp_from_srt_euler(mat, g_boss->scale, g_boss->rot, g_boss->pos);
+            bone_cache_invalidate(&g_boss->boneCache);
         }
     }
 
@@ -2029,6 +2178,7 @@ void scene_cutscene_update()
                 T3DMat4FP* mat = (T3DMat4FP*)g_boss->modelMat;
                 if (mat) {
                     t3d_mat4fp_from_srt_euler(mat, g_boss->scale, g_boss->rot, g_boss->pos);
+                    bone_cache_invalidate(&g_boss->boneCache);
                 }
             }
 
@@ -2046,6 +2196,7 @@ void scene_cutscene_update()
                 T3DMat4FP* mat = (T3DMat4FP*)g_boss->modelMat;
                 if (mat) {
                     t3d_mat4fp_from_srt_euler(mat, g_boss->scale, g_boss->rot, g_boss->pos);
+                    bone_cache_invalidate(&g_boss->boneCache);
                 }
             }
 
@@ -2070,6 +2221,7 @@ void scene_cutscene_update()
                 T3DMat4FP* mat = (T3DMat4FP*)g_boss->modelMat;
                 if (mat) {
                     t3d_mat4fp_from_srt_euler(mat, g_boss->scale, g_boss->rot, g_boss->pos);
+                    bone_cache_invalidate(&g_boss->boneCache);
                 }
             }
 
@@ -2094,6 +2246,7 @@ void scene_cutscene_update()
                 T3DMat4FP* mat = (T3DMat4FP*)g_boss->modelMat;
                 if (mat) {
                     t3d_mat4fp_from_srt_euler(mat, g_boss->scale, g_boss->rot, g_boss->pos);
+                    bone_cache_invalidate(&g_boss->boneCache);
                 }
             }
 
@@ -2157,16 +2310,19 @@ void scene_cutscene_update()
         case CUTSCENE_POST_BOSS_RESTORED: {
             // Post-boss dialog runs while gameplay continues to animate (no "paused time" feel).
             // Player input stays disabled by `character_update()` while a cutscene is active.
-            character_update();
+            float moveStart[3] = { character.pos[0], character.pos[1], character.pos[2] };
+            scene_timed_character_update();
             // Keep constraints/collision up to date so the world stays consistent during dialog.
-            scene_resolve_character_room_obbs();
+            scene_move_character_in_room(moveStart);
             character_update_position();
 
             if (bossActivated && g_boss) {
-                boss_update(g_boss);
+                scene_timed_boss_update(g_boss);
             }
 
-            collision_update();
+            float pushStart[3] = { character.pos[0], character.pos[1], character.pos[2] };
+            scene_timed_collision_update();
+            scene_move_character_in_room(pushStart);
 
             // Run dialog sequence (2 lines) then return to gameplay
             // Allow A/Start to advance immediately to the next line (or end).
@@ -2388,13 +2544,16 @@ void scene_update(void)
     
     // Update all scrolling textures
     scroll_update();
+}
 
+// One fixed-rate gameplay step. deltaTime is FIXED_TIMESTEP_MS here (see main.c).
+static void scene_step(void)
+{
     if(gameState == GAME_STATE_TITLE || gameState == GAME_STATE_TITLE_TRANSITION)
     {
         scene_update_title();
-        character_update();
-        t3d_anim_update(dynamicBannerAnimations[0], deltaTime);
-        t3d_skeleton_update(dynamicBannerSkeleton);
+        scene_timed_character_update();
+        scene_rig_update(&dynamicBannerRig, dynamicBannerAnimations[0], dynamicBannerSkeleton, dynamicBannerOffset);
         // Keep animation state updated (bars not drawn during title)
         letterbox_update();
         return;
@@ -2417,11 +2576,11 @@ void scene_update(void)
         deathRestartLockoutTimer += deltaTime;
 
         // Still update the character so end-state animations (like Death) can play.
-        character_update();
+        scene_timed_character_update();
 
         // Keep boss AI updating so it continues moving during end screen
         if (bossActivated && g_boss) {
-            boss_update(g_boss);
+            scene_timed_boss_update(g_boss);
         }
 
         // Continue letterbox animation updates
@@ -2474,14 +2633,15 @@ void scene_update(void)
             lastInteractAHeld = joypad.btn.a;
         }
 
-        character_update();
-        // Constrain player inside obbs
-        scene_resolve_character_room_obbs();
+        float moveStart[3] = { character.pos[0], character.pos[1], character.pos[2] };
+        scene_timed_character_update();
+        // Sweep the step's motion against the room colliders
+        scene_move_character_in_room(moveStart);
         // Update character transform after constraint
         character_update_position();
         
         if (bossActivated && g_boss) {
-            boss_update(g_boss);
+            scene_timed_boss_update(g_boss);
             // Boss death no longer forces GAME_STATE_VICTORY.
             // The boss will play its collapse and remain still; the player can keep moving.
 
@@ -2498,7 +2658,10 @@ void scene_update(void)
             }
         }
 
-        collision_update();
+        // The boss body push moves the character too; sweep it like any other motion
+        float pushStart[3] = { character.pos[0], character.pos[1], character.pos[2] };
+        scene_timed_collision_update();
+        scene_move_character_in_room(pushStart);
 
 
         //dialog_controller_update();
@@ -2637,7 +2800,14 @@ void scene_update(void)
         }
     }
 
+    // Sword walls push the character out too; in gameplay that push is swept as well
+    float msaStart[3] = { character.pos[0], character.pos[1], character.pos[2] };
+    uint32_t tMsa = cpu_timer_begin();
     msa_update(deltaTime); // multi sword attack
+    cpu_timer_end(CPU_TIMER_MSA_UPDATE, tMsa);
+    if (cutsceneState == CUTSCENE_NONE) {
+        scene_move_character_in_room(msaStart);
+    }
 
     lastZPressed = zHeld;
     lastCLeftHeld = cLeftHeld;
@@ -2646,6 +2816,27 @@ void scene_update(void)
 
 void scene_fixed_update(void) 
 {
+    if (gameState == GAME_STATE_VIDEO) {
+        return;
+    }
+
+    // Remember where everything was before this step; scene_draw blends
+    // towards the post-step transforms by renderAlpha.
+    character_interp_capture();
+    camera_interp_capture();
+    if (g_boss) {
+        boss_interp_capture(g_boss);
+    }
+    msa_interp_capture();
+
+    scene_step();
+
+    // Dust puffs (boss landings/impacts) only live in the gameplay view
+    bool titleActive = (gameState == GAME_STATE_TITLE || gameState == GAME_STATE_TITLE_TRANSITION);
+    if (!titleActive && cutsceneState == CUTSCENE_NONE) {
+        ground_crush_update(deltaTime);
+        dust_update(deltaTime);
+    }
 }
 
 // Draws a small lock-on marker over the boss when Z-targeting is active.
@@ -2752,6 +2943,14 @@ static void dust_reset(void) {
     memset(s_dust, 0, sizeof(s_dust));
 }
 
+int scene_get_active_dust_count(void) {
+    int n = 0;
+    for (int i = 0; i < DUST_MAX; i++) {
+        if (s_dust[i].active) n++;
+    }
+    return n;
+}
+
 static int dust_alloc_slot(void) {
     for (int i = 0; i < DUST_MAX; i++) {
         if (!s_dust[i].active) return i;
@@ -2912,9 +3111,21 @@ static void dust_draw(T3DViewport *viewport) {
         rdpq_mode_blender(RDPQ_BLENDER_MULTIPLY);
     }
 
+    // Over the governor's budget, thin evenly across all live puffs rather
+    // than dropping whole bursts (bursts fill the low slots first).
+    const int active = scene_get_active_dust_count();
+    const int drawMax = quality_budgets()->dustDrawMax;
+    const float pixelScale = render_scale_factor();
+    int thinAcc = 0;
+
     for (int i = 0; i < DUST_MAX; i++) {
         const DustParticle *p = &s_dust[i];
         if (!p->active) continue;
+        if (active > drawMax) {
+            thinAcc += drawMax;
+            if (thinAcc < active) continue;
+            thinAcc -= active;
+        }
 
         T3DVec3 worldPos = {{ p->pos[0], p->pos[1], p->pos[2] }};
         T3DVec3 screenPos;
@@ -2940,7 +3151,7 @@ static void dust_draw(T3DViewport *viewport) {
 
         // Slight grow then fade.
         float grow = 1.0f + 0.7f * (p->age / p->life);
-        int half = (int)(p->size_px * grow);
+        int half = (int)(p->size_px * grow * pixelScale);
         if (half < 4) half = 4;
         if (half > 26) half = 26;
 
@@ -2983,6 +3194,14 @@ static void ground_crush_reset(void) {
     memset(s_groundCrush, 0, sizeof(s_groundCrush));
 }
 
+int scene_get_active_ground_crush_count(void) {
+    int n = 0;
+    for (int i = 0; i < GROUND_CRUSH_MAX; i++) {
+        if (s_groundCrush[i].active) n++;
+    }
+    return n;
+}
+
 static int ground_crush_alloc_slot(void) {
     for (int i = 0; i < GROUND_CRUSH_MAX; i++) {
         if (!s_groundCrush[i].active) return i;
@@ -2999,7 +3218,7 @@ static int ground_crush_alloc_slot(void) {
     return oldest;
 }
 
-void scene_spawn_ground_crushed(float x, float z)
+void scene_spawn_ground_crushed(float x, float y, float z)
 {
     int idx = ground_crush_alloc_slot();
     GroundCrushDecal *d = &s_groundCrush[idx];
@@ -3009,7 +3228,7 @@ void scene_spawn_ground_crushed(float x, float z)
     d->life = 3.0f;
 
     d->pos[0] = x;
-    d->pos[1] = roomY + 0.25f; // slightly above the floor to avoid z-fighting
+    d->pos[1] = collision_mesh_floor_height(x, y, z, roomY) + 0.25f; // slightly above the floor to avoid z-fighting
     d->pos[2] = z;
 }
 
@@ -3842,6 +4061,13 @@ void scene_draw(T3DViewport *viewport)
     if(gameState == GAME_STATE_VIDEO)
         return;
 
+    // Gameplay 3D may render below native resolution; the UI after it never does
+    bool scaled3D = false;
+    if (gameState != GAME_STATE_TITLE && gameState != GAME_STATE_TITLE_TRANSITION &&
+        cutsceneState == CUTSCENE_NONE) {
+        scaled3D = render_scale_begin(viewport);
+    }
+
     t3d_frame_start();
 
     if(!DITHER_ENABLED && !debugDraw)
@@ -3890,6 +4116,12 @@ void scene_draw(T3DViewport *viewport)
     }
     // ===== DRAW 3D =====
 
+    // Blend gameplay transforms between the last two fixed steps
+    character_interp_apply(renderAlpha);
+    if (g_boss) {
+        boss_interp_apply(g_boss, renderAlpha);
+    }
+
     rdpq_sync_pipe();
     rdpq_mode_zbuf(false, false);
 
@@ -4030,11 +4262,13 @@ void scene_draw(T3DViewport *viewport)
     sword_trail_draw_all(viewport);
 
     // Dust puffs (boss landings/impacts)
-    ground_crush_update(deltaTime);
     ground_crush_draw(viewport);
-    dust_update(deltaTime);
     dust_draw(viewport);
 
+    if (scaled3D) {
+        render_scale_end(viewport);
+    }
+
     // Post-boss interaction prompt ("A") above the defeated boss when close enough to interact
     draw_post_boss_a_prompt(viewport);
 
@@ -4055,6 +4289,8 @@ void scene_draw(T3DViewport *viewport)
 
             debug_draw_obb_xz(viewport, &g_roomOBBs[i], 0.0f, hit ? DEBUG_COLORS[0] : DEBUG_COLORS[2]);
         }
+
+        dev_draw_collision_grid(viewport);
     }
 
     scene_draw_video_trigger(viewport);
@@ -4298,7 +4534,7 @@ void scene_delete_environment(void)
 
 void scene_cleanup(void) // Realistically we never want to call this for the jam.
 {
-    //collision_mesh_cleanup();
+    collision_mesh_cleanup();
     scene_delete_environment();
     camera_reset();
     
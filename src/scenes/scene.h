@@ -42,6 +42,7 @@ typedef enum {
 void scene_init(void);
 void scene_reset(void);
 void scene_restart(void);
+void scene_start_fight_skip_intro(void);
 void scene_update(void);
 void scene_fixed_update(void);
 void scene_draw(T3DViewport *viewport);
@@ -53,7 +54,7 @@ void scene_spawn_dust_burst(float x, float y, float z, float strength);
 
 // Ground "crush" decal under an impact point (world-space quad, depth-tested).
 // Intended for boss slam landings. Auto-expires (~3 seconds).
-void scene_spawn_ground_crushed(float x, float z);
+void scene_spawn_ground_crushed(float x, float y, float z);
 
 // Boot helpers
 // Runs startup logos (skipped in DEV_MODE) and restores display/rdpq state.
@@ -63,12 +64,17 @@ void scene_boot_logos(void);
 // Cutscene state functions
 bool scene_is_cutscene_active(void);
 bool scene_is_boss_active(void);
+CutsceneState scene_get_cutscene_state(void);
 
 // Game state functions
 GameState scene_get_game_state(void);
 void scene_set_game_state(GameState state);
 bool scene_is_menu_active(void);
 
+// Active effect counts (dev hitch snapshots)
+int scene_get_active_dust_count(void);
+int scene_get_active_ground_crush_count(void);
+
 // Title helpers
 void scene_begin_title_transition(void);
 
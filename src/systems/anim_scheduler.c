@@ -0,0 +1,220 @@
+#include "anim_scheduler.h"
+
+#include <libdragon.h>
+#include <math.h>
+#include <string.h>
+
+#include "globals.h"
+#include "cpu_timers.h"
+#include "collision_system.h"
+
+// Screen radius (pixels) a rig needs for each rate
+#define ANIM_FULL_RATE_PX     64.0f
+#define ANIM_HALF_RATE_PX     24.0f
+#define ANIM_OCCLUSION_STEPS  4     // line of sight is re-cast every this many steps
+#define ANIM_SCHED_HISTORY    32    // frames kept in the rolling ring buffer
+
+static const char *RATE_NAMES[ANIM_RATE_COUNT] = {
+    "full",
+    "half",
+    "quarter",
+    "skip",
+};
+
+static const uint8_t RATE_PERIOD[ANIM_RATE_COUNT] = { 1, 2, 4, 0 };
+
+static const T3DViewport *view = NULL;
+static uint8_t nextPhase = 0;
+
+// Counters for the frame in progress
+static uint32_t curUpdateTicks = 0;
+static uint32_t curSavedTicks = 0;
+static uint16_t curUpdates = 0;
+static uint16_t curSkips = 0;
+
+// Rolling history, one row per finished frame.
+static uint32_t ringUpdateTicks[ANIM_SCHED_HISTORY];
+static uint32_t ringSavedTicks[ANIM_SCHED_HISTORY];
+static uint16_t ringUpdates[ANIM_SCHED_HISTORY];
+static uint16_t ringSkips[ANIM_SCHED_HISTORY];
+static int ringHead = 0;
+static int ringFilled = 0;
+
+void anim_rig_init(AnimRig *rig, const char *name, AnimPriority priority)
+{
+    memset(rig, 0, sizeof(*rig));
+    rig->name = name;
+    rig->priority = priority;
+    rig->rate = ANIM_RATE_FULL;
+    rig->phase = nextPhase++;
+}
+
+void anim_rig_fit_skeleton(AnimRig *rig, const T3DSkeleton *skeleton, float scale, const float offset[3], float pad)
+{
+    int count = skeleton->skeletonRef->boneCount;
+    if (count <= 0) return;
+
+    float mn[3] = { INFINITY, INFINITY, INFINITY };
+    float mx[3] = { -INFINITY, -INFINITY, -INFINITY };
+    for (int b = 0; b < count; b++) {
+        const float *p = skeleton->bones[b].matrix.m[3];
+        for (int k = 0; k < 3; k++) {
+            mn[k] = fminf(mn[k], p[k]);
+            mx[k] = fmaxf(mx[k], p[k]);
+        }
+    }
+
+    float r2 = 0.0f;
+    for (int k = 0; k < 3; k++) {
+        float h = (mx[k] - mn[k]) * 0.5f * scale;
+        rig->center[k] = (mn[k] + mx[k]) * 0.5f * scale + offset[k];
+        r2 += h * h;
+    }
+    rig->radius = sqrtf(r2) + pad;
+}
+
+void anim_rig_set_visible(AnimRig *rig, bool visible)
+{
+    rig->hidden = !visible;
+}
+
+void anim_sched_set_viewport(const T3DViewport *viewport)
+{
+    view = viewport;
+}
+
+// Camera position from the view matrix (inverse of its rigid transform)
+static void view_eye(float eye[3])
+{
+    const T3DMat4 *m = &view->matCamera;
+    for (int c = 0; c < 3; c++) {
+        eye[c] = -(m->m[c][0] * m->m[3][0] + m->m[c][1] * m->m[3][1] + m->m[c][2] * m->m[3][2]);
+    }
+}
+
+static AnimRate pick_rate(AnimRig *rig)
+{
+    if (rig->priority == ANIM_PRIORITY_GAMEPLAY) return ANIM_RATE_FULL;
+    if (rig->hidden) return ANIM_RATE_SKIP;
+    if (!view || rig->radius <= 0.0f) return ANIM_RATE_FULL;
+
+    const float *center = rig->center;
+    T3DVec4 clip;
+    t3d_mat4_mul_vec3(&clip, &view->matCamProj, &(T3DVec3){{ center[0], center[1], center[2] }});
+    float w = clip.v[3];
+    float r = rig->radius;
+
+    // Camera inside (or right at) the bounds: always visible, always big
+    if (w <= r) return ANIM_RATE_FULL;
+
+    // Sphere fully outside a side plane of the frustum (clip-space, per axis)
+    float rx = r * fabsf(view->matProj.m[0][0]);
+    float ry = r * fabsf(view->matProj.m[1][1]);
+    if (clip.v[0] - rx > w || clip.v[0] + rx < -w || clip.v[1] - ry > w || clip.v[1] + ry < -w) {
+        return ANIM_RATE_SKIP;
+    }
+
+    // Hidden when the room blocks the line of sight well in front of the rig
+    if ((uint8_t)(rig->step + rig->phase) % ANIM_OCCLUSION_STEPS == 0) {
+        float eye[3], t, n[3];
+        view_eye(eye);
+        float dx = center[0] - eye[0], dy = center[1] - eye[1], dz = center[2] - eye[2];
+        float dist = sqrtf(dx * dx + dy * dy + dz * dz);
+        rig->occluded = collision_raycast_static(eye, center, &t, n) && t * dist < dist - r;
+    }
+    if (rig->occluded) return ANIM_RATE_SKIP;
+
+    float px = ry / w * (float)view->size[1] * 0.5f;
+    if (px >= ANIM_FULL_RATE_PX) return ANIM_RATE_FULL;
+    if (px >= ANIM_HALF_RATE_PX || rig->priority == ANIM_PRIORITY_CINEMATIC) return ANIM_RATE_HALF;
+    return ANIM_RATE_QUARTER;
+}
+
+bool anim_rig_begin(AnimRig *rig, float dt, float *dtOut)
+{
+    rig->rate = pick_rate(rig);
+    rig->pendingDt = fminf(rig->pendingDt + dt, ANIM_MAX_PENDING_S);
+
+    uint8_t period = RATE_PERIOD[rig->rate];
+    bool run = period != 0 && (uint8_t)(rig->step + rig->phase) % period == 0;
+    rig->step++;
+
+    if (!run) {
+        curSavedTicks += rig->costTicks;
+        curSkips++;
+        return false;
+    }
+
+    *dtOut = rig->pendingDt;
+    rig->pendingDt = 0.0f;
+    rig->startTicks = cpu_timer_begin();
+    return true;
+}
+
+void anim_rig_end(AnimRig *rig)
+{
+    curUpdates++;
+    if (!DEV_MODE) return;
+
+    uint32_t ticks = C0_COUNT() - rig->startTicks;
+    rig->costTicks = rig->costTicks ? (rig->costTicks * 3 + ticks) / 4 : ticks;
+    curUpdateTicks += ticks;
+}
+
+void anim_rig_reset_time(AnimRig *rig)
+{
+    rig->pendingDt = 0.0f;
+}
+
+void anim_sched_frame_end(void)
+{
+    ringUpdateTicks[ringHead] = curUpdateTicks;
+    ringSavedTicks[ringHead] = curSavedTicks;
+    ringUpdates[ringHead] = curUpdates;
+    ringSkips[ringHead] = curSkips;
+    ringHead = (ringHead + 1) % ANIM_SCHED_HISTORY;
+    if (ringFilled < ANIM_SCHED_HISTORY) ringFilled++;
+
+    curUpdateTicks = 0;
+    curSavedTicks = 0;
+    curUpdates = 0;
+    curSkips = 0;
+}
+
+void anim_sched_get_stats(AnimSchedStats *out)
+{
+    memset(out, 0, sizeof(*out));
+    out->frameCount = ringFilled;
+    if (ringFilled == 0) return;
+
+    uint64_t updateTicks = 0, savedTicks = 0;
+    uint32_t updates = 0, skips = 0;
+    for (int f = 0; f < ringFilled; f++) {
+        updateTicks += ringUpdateTicks[f];
+        savedTicks += ringSavedTicks[f];
+        updates += ringUpdates[f];
+        skips += ringSkips[f];
+    }
+    out->updateAvgUs = (float)TICKS_TO_US(updateTicks) / (float)ringFilled;
+    out->savedAvgUs = (float)TICKS_TO_US(savedTicks) / (float)ringFilled;
+    out->updatesAvg = (float)updates / (float)ringFilled;
+    out->skipsAvg = (float)skips / (float)ringFilled;
+}
+
+void anim_sched_get_last_frame(AnimSchedStats *out)
+{
+    memset(out, 0, sizeof(*out));
+    if (ringFilled == 0) return;
+
+    int f = (ringHead + ANIM_SCHED_HISTORY - 1) % ANIM_SCHED_HISTORY;
+    out->frameCount = 1;
+    out->updateAvgUs = (float)TICKS_TO_US(ringUpdateTicks[f]);
+    out->savedAvgUs = (float)TICKS_TO_US(ringSavedTicks[f]);
+    out->updatesAvg = (float)ringUpdates[f];
+    out->skipsAvg = (float)ringSkips[f];
+}
+
+const char *anim_rate_name(AnimRate rate)
+{
+    return (rate < ANIM_RATE_COUNT) ? RATE_NAMES[rate] : "?";
+}
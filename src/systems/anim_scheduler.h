@@ -0,0 +1,96 @@
+#ifndef ANIM_SCHEDULER_H
+#define ANIM_SCHEDULER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <t3d/t3d.h>
+#include <t3d/t3dskeleton.h>
+
+// Animation level of detail. Every animated skeleton owns an AnimRig and asks
+// the scheduler each step whether to pose it:
+//   float animDt;
+//   if (anim_rig_begin(&rig, deltaTime, &animDt)) {
+//       t3d_anim_update(anim, animDt);
+//       t3d_skeleton_update(skeleton);
+//       anim_rig_fit_skeleton(&rig, skeleton, MODEL_SCALE, offset, pad);
+//       anim_rig_end(&rig);
+//   }
+// Gameplay rigs (their bones feed hit detection) always run at full rate, so
+// the fixed-step simulation is the same whatever the camera sees. Cosmetic
+// rigs run at full, half or quarter rate by their size on screen and are
+// skipped while off screen, hidden behind the room or not drawn by the scene;
+// the time they miss (up to ANIM_MAX_PENDING_S) is handed to their next
+// update so they stay in sync.
+
+typedef enum {
+    ANIM_PRIORITY_GAMEPLAY,  // knight, boss: never reduced
+    ANIM_PRIORITY_CINEMATIC, // cutscene props: full rate unless tiny, off screen or hidden
+    ANIM_PRIORITY_AMBIENT,   // set dressing: full, half or quarter by screen size
+} AnimPriority;
+
+typedef enum {
+    ANIM_RATE_FULL,
+    ANIM_RATE_HALF,
+    ANIM_RATE_QUARTER,
+    ANIM_RATE_SKIP,          // off screen or occluded
+    ANIM_RATE_COUNT
+} AnimRate;
+
+#define ANIM_MAX_PENDING_S    0.5f  // most skipped time one update catches up
+
+typedef struct {
+    const char *name;
+    AnimPriority priority;
+    float center[3];         // world bounding sphere of the last pose (radius 0: not fitted yet)
+    float radius;
+    AnimRate rate;           // picked on the last step
+    uint8_t step;            // steps since init, for the reduced-rate cadence
+    uint8_t phase;           // staggers reduced-rate rigs across steps
+    bool occluded;           // last line-of-sight result, refreshed every few steps
+    bool hidden;             // the scene is not drawing it (see anim_rig_set_visible)
+    float pendingDt;         // time owed by skipped steps
+    uint32_t costTicks;      // smoothed cost of one update (DEV_MODE only)
+    uint32_t startTicks;
+} AnimRig;
+
+typedef struct {
+    float updateAvgUs;       // measured skeleton-update time per frame
+    float savedAvgUs;        // estimated time not spent on skipped updates
+    float updatesAvg;        // rig updates per frame
+    float skipsAvg;          // rig updates skipped per frame
+    int frameCount;          // valid frames in the window
+} AnimSchedStats;
+
+void anim_rig_init(AnimRig *rig, const char *name, AnimPriority priority);
+
+// Bounds from the posed bone origins, placed like the model (bone space * scale
+// + offset) and grown by pad for the mesh around the bones.
+void anim_rig_fit_skeleton(AnimRig *rig, const T3DSkeleton *skeleton, float scale, const float offset[3], float pad);
+
+// Tells the scheduler whether the scene draws this rig at all. A hidden
+// cosmetic rig is skipped; gameplay rigs ignore it.
+void anim_rig_set_visible(AnimRig *rig, bool visible);
+
+// The viewport the camera renders with; rigs are judged against its last
+// look-at. Without one every rig runs at full rate.
+void anim_sched_set_viewport(const T3DViewport *viewport);
+
+// True when the rig should be posed this step; *dtOut is then this step's dt
+// plus the time of every step skipped since its last update, capped at
+// ANIM_MAX_PENDING_S so a rig that was hidden for long does not jump ahead.
+bool anim_rig_begin(AnimRig *rig, float dt, float *dtOut);
+// Closes an update started by anim_rig_begin (measures its cost)
+void anim_rig_end(AnimRig *rig);
+// Drops the time owed by skipped steps. Call it when the rig's clip is
+// switched or restarted, so the new clip starts at its own time instead of
+// being advanced by steps the old one missed. (Gameplay rigs never skip, so
+// they never owe any.)
+void anim_rig_reset_time(AnimRig *rig);
+
+void anim_sched_frame_end(void);
+void anim_sched_get_stats(AnimSchedStats *out);
+// Just the last finished frame (frameCount 1), for callers keeping their own totals
+void anim_sched_get_last_frame(AnimSchedStats *out);
+const char *anim_rate_name(AnimRate rate);
+
+#endif
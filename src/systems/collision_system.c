@@ -6,8 +6,11 @@
 #include "game/bosses/boss.h"
 
 #include "simple_collision_utility.h"
+#include "collision_world.h"
+#include "collision_mesh.h"
 #include "debug_draw.h"
 #include "dev.h"
+#include "collision_stats.h"
 
 // ------------------------------------------------------------
 // State (debug + collision endpoints)
@@ -32,6 +35,24 @@ T3DVec3 charWeaponCapB;
 float   charWeaponRadius = 2.0f;
 bool    charWeaponCollision = false;
 
+// Weapon segments from the previous update, so hit tests sweep the blade
+// across the whole step instead of sampling its pose once
+static T3DVec3 bossWeaponPrevA, bossWeaponPrevB;
+static bool    bossWeaponPrevValid = false;
+static T3DVec3 charWeaponPrevA, charWeaponPrevB;
+static bool    charWeaponPrevValid = false;
+
+// World bodies for the colliders above
+static CollisionBodyId charBodyId = COLLISION_BODY_NONE;
+static CollisionBodyId bossBodyId = COLLISION_BODY_NONE;
+static CollisionBodyId bossWeaponId = COLLISION_BODY_NONE;
+static CollisionBodyId charWeaponId = COLLISION_BODY_NONE;
+
+#define COLLISION_LAYERS_ACTORS (COLLISION_LAYER_CHAR_BODY | COLLISION_LAYER_BOSS_BODY | \
+                                 COLLISION_LAYER_CHAR_WEAPON | COLLISION_LAYER_BOSS_WEAPON)
+#define COLLISION_MAX_PAIRS 8
+#define COLLISION_RAY_MAX_BOXES SCU_STATIC_OBB_MAX // every room box
+
 // ------------------------------------------------------------
 // Helpers
 // ------------------------------------------------------------
@@ -114,6 +135,12 @@ static inline bool update_boss_capsule_world(Boss **outBoss)
 
 void collision_init(void)
 {
+    collision_world_reset();
+    charBodyId   = collision_world_add(COLLISION_SHAPE_CAPSULE, COLLISION_LAYER_CHAR_BODY, COLLISION_LAYER_BOSS_BODY, 0);
+    bossBodyId   = collision_world_add(COLLISION_SHAPE_CAPSULE, COLLISION_LAYER_BOSS_BODY, 0, 0);
+    bossWeaponId = collision_world_add(COLLISION_SHAPE_CAPSULE, COLLISION_LAYER_BOSS_WEAPON, COLLISION_LAYER_CHAR_BODY, 0);
+    charWeaponId = collision_world_add(COLLISION_SHAPE_CAPSULE, COLLISION_LAYER_CHAR_WEAPON, COLLISION_LAYER_BOSS_BODY, 0);
+
     bodyHitboxCollision = false;
     bossWeaponCollision = false;
     charWeaponCollision = false;
@@ -127,153 +154,214 @@ void collision_init(void)
 
     // Ensure weapon radius is sane even before first update
     charWeaponRadius = 2.0f;
+
+    bossWeaponPrevValid = false;
+    charWeaponPrevValid = false;
+}
+
+// Body vs body: push the character out in XZ (stable + cheap)
+static void resolve_body_pair(void)
+{
+    // midpoints as centers (works even if caps aren't centered on pos)
+    float charX = 0.5f * (charCapA.v[0] + charCapB.v[0]);
+    float charZ = 0.5f * (charCapA.v[2] + charCapB.v[2]);
+
+    float bossX = 0.5f * (bossCapA.v[0] + bossCapB.v[0]);
+    float bossZ = 0.5f * (bossCapA.v[2] + bossCapB.v[2]);
+
+    float push[3], n[3];
+    collision_stat_add(COLLISION_STAT_CAPSULE_CAPSULE, 1);
+    bodyHitboxCollision = circle_vs_circle_push_xz(
+        charX, charZ, charRadius,
+        bossX, bossZ, bossRadius,
+        push, n
+    );
+
+    if (!bodyHitboxCollision) return;
+
+    // push character out
+    character.pos[0] += push[0];
+    character.pos[2] += push[2];
+
+    // keep our debug capsule in sync this frame
+    charCapA.v[0] += push[0]; charCapA.v[2] += push[2];
+    charCapB.v[0] += push[0]; charCapB.v[2] += push[2];
+    collision_world_set_capsule(charBodyId, charCapA.v, charCapB.v, charRadius);
+
+    // slide: remove inward velocity component along the normal
+    float vx, vz;
+    character_get_velocity(&vx, &vz);
+
+    float vn = vx * n[0] + vz * n[2];
+    if (vn < 0.0f) {
+        vx -= vn * n[0];
+        vz -= vn * n[2];
+        character_set_velocity_xz(vx, vz);
+    }
+}
+
+// Registers the blade for this step, swept from its previous pose when there is one
+static void weapon_body_update(CollisionBodyId id, const T3DVec3 *a, const T3DVec3 *b, float r,
+    T3DVec3 *prevA, T3DVec3 *prevB, bool *prevValid)
+{
+    if (!*prevValid) {
+        *prevA = *a;
+        *prevB = *b;
+        *prevValid = true;
+    }
+    collision_world_set_swept_capsule(id, prevA->v, prevB->v, a->v, b->v, r);
 }
 
 void collision_update(void) // Disable viewport after development
 {
     update_character_capsule_world();
+    collision_world_set_capsule(charBodyId, charCapA.v, charCapB.v, charRadius);
+
+    bodyHitboxCollision = false;
+    bossWeaponCollision = false;
+    charWeaponCollision = false;
 
     Boss* boss = NULL;
     if (!update_boss_capsule_world(&boss)) {
-        bodyHitboxCollision = false;
-        bossWeaponCollision = false;
-        charWeaponCollision = false;
+        bossWeaponPrevValid = false;
+        charWeaponPrevValid = false;
+        collision_world_set_enabled(bossBodyId, false);
+        collision_world_set_enabled(bossWeaponId, false);
+        collision_world_set_enabled(charWeaponId, false);
         return;
     }
+    collision_world_set_capsule(bossBodyId, bossCapA.v, bossCapB.v, bossRadius);
 
     // ------------------------------------------------------------
-    // BODY vs BODY: resolve in XZ (stable + cheap)
+    // BODY vs BODY first: the push moves the character before the weapon tests
     // ------------------------------------------------------------
-    {
-        // midpoints as centers (works even if caps aren't centered on pos)
-        float charX = 0.5f * (charCapA.v[0] + charCapB.v[0]);
-        float charZ = 0.5f * (charCapA.v[2] + charCapB.v[2]);
-
-        float bossX = 0.5f * (bossCapA.v[0] + bossCapB.v[0]);
-        float bossZ = 0.5f * (bossCapA.v[2] + bossCapB.v[2]);
-
-        float push[3], n[3];
-        bodyHitboxCollision = circle_vs_circle_push_xz(
-            charX, charZ, charRadius,
-            bossX, bossZ, bossRadius,
-            push, n
-        );
-
-        if (bodyHitboxCollision) {
-            // push character out
-            character.pos[0] += push[0];
-            character.pos[2] += push[2];
-
-            // keep our debug capsule in sync this frame
-            charCapA.v[0] += push[0]; charCapA.v[2] += push[2];
-            charCapB.v[0] += push[0]; charCapB.v[2] += push[2];
-
-            // slide: remove inward velocity component along the normal
-            float vx, vz;
-            character_get_velocity(&vx, &vz);
-
-            float vn = vx * n[0] + vz * n[2];
-            if (vn < 0.0f) {
-                vx -= vn * n[0];
-                vz -= vn * n[2];
-                character_set_velocity_xz(vx, vz);
-            }
-        }
+    CollisionPair pairs[COLLISION_MAX_PAIRS];
+    int pairCount = collision_world_find_pairs(COLLISION_LAYER_CHAR_BODY | COLLISION_LAYER_BOSS_BODY,
+        pairs, COLLISION_MAX_PAIRS);
+    if (pairCount > 0) {
+        resolve_body_pair();
     }
 
     // ------------------------------------------------------------
     // BOSS HAND WEAPON collider (debug + hit test)
     // (DO NOT early-return, or we skip character weapon debug)
     // ------------------------------------------------------------
-    bossWeaponCollision = false;
-
+    // Capsule segment length in bone-local space
     if (boss->handAttackColliderActive &&
-        boss->skeleton && boss->modelMat &&
-        boss->handRightBoneIndex >= 0)
+        bone_cache_world_segment(&boss->boneCache, boss->skeleton, boss->modelMat, boss->handRightBoneIndex,
+            640.0f, bossWeaponCapA.v, bossWeaponCapB.v))
     {
-        T3DSkeleton *sk = (T3DSkeleton*)boss->skeleton;
-
-        const T3DMat4FP *B = &sk->boneMatricesFP[boss->handRightBoneIndex]; // bone in MODEL space
-        const T3DMat4FP *M = (const T3DMat4FP*)boss->modelMat;             // model in WORLD space
-
-        // Bone-local points
-        const float p0_local[3] = { 0.0f, 0.0f, 0.0f };
-
-        // Capsule segment length in bone-local space
-        const float len = 640.0f;
-        const float p1_local[3] = { -len, 0.0f, 0.0f };
-
-        // 1) bone-local -> MODEL space (apply B)
-        float p0_model[3], p1_model[3];
-        mat4fp_mul_point_f32_row3_colbasis(B, p0_local, p0_model);
-        mat4fp_mul_point_f32_row3_colbasis(B, p1_local, p1_model);
-
-        // 2) MODEL -> WORLD space (apply M)
-        float p0_world[3], p1_world[3];
-        mat4fp_mul_point_f32_row3_colbasis(M, p0_model, p0_world);
-        mat4fp_mul_point_f32_row3_colbasis(M, p1_model, p1_world);
-
-        // 3) Store endpoints (WORLD space) for testing + debug draw
-        bossWeaponCapA = (T3DVec3){{ p0_world[0], p0_world[1], p0_world[2] }};
-        bossWeaponCapB = (T3DVec3){{ p1_world[0], p1_world[1], p1_world[2] }};
-
-        bossWeaponCollision = scu_capsule_vs_capsule_f(
-            bossWeaponCapA.v, bossWeaponCapB.v, bossWeaponRadius,
-            charCapA.v, charCapB.v, charRadius
-        );
+        weapon_body_update(bossWeaponId, &bossWeaponCapA, &bossWeaponCapB, bossWeaponRadius,
+            &bossWeaponPrevA, &bossWeaponPrevB, &bossWeaponPrevValid);
+    } else {
+        // A swing that starts later must not sweep from a stale pose
+        bossWeaponPrevValid = false;
+        collision_world_set_enabled(bossWeaponId, false);
     }
 
     // ------------------------------------------------------------
     // CHARACTER HAND WEAPON collider (debug + hit test)
     // ------------------------------------------------------------
-    charWeaponCollision = false;
-
     {
         // collision_system.c can't see character.c's static bone index,
         // so we find/cache it here.
         static int s_charSwordBoneIndex = -1;
 
-        if (character.skeleton && character.modelMat) {
-
-            if (s_charSwordBoneIndex < 0) {
-                s_charSwordBoneIndex = t3d_skeleton_find_bone((T3DSkeleton*)character.skeleton, "Hand-Right");
-                // If your bone name differs, change it here.
-            }
-
-            if (s_charSwordBoneIndex >= 0) {
-                T3DSkeleton *sk = (T3DSkeleton*)character.skeleton;
-
-                const T3DMat4FP *B = &sk->boneMatricesFP[s_charSwordBoneIndex]; // bone in MODEL space
-                const T3DMat4FP *M = (const T3DMat4FP*)character.modelMat;      // model in WORLD space
-
-                const float p0_local[3] = { 0.0f, 0.0f, 0.0f };
-
-                // Match your character.c sword values
-                const float len = 640.0f;
-                const float p1_local[3] = { -len, 0.0f, 0.0f };
+        if (character.skeleton && character.modelMat && s_charSwordBoneIndex < 0) {
+            s_charSwordBoneIndex = t3d_skeleton_find_bone((T3DSkeleton*)character.skeleton, "Hand-Right");
+            // If your bone name differs, change it here.
+        }
 
-                float p0_model[3], p1_model[3];
-                mat4fp_mul_point_f32_row3_colbasis(B, p0_local, p0_model);
-                mat4fp_mul_point_f32_row3_colbasis(B, p1_local, p1_model);
+        // Match your character.c sword values
+        if (bone_cache_world_segment(&character.boneCache, character.skeleton, character.modelMat, s_charSwordBoneIndex,
+                640.0f, charWeaponCapA.v, charWeaponCapB.v)) {
+            // Make sure radius is visible
+            charWeaponRadius = 2.0f;
+            weapon_body_update(charWeaponId, &charWeaponCapA, &charWeaponCapB, charWeaponRadius,
+                &charWeaponPrevA, &charWeaponPrevB, &charWeaponPrevValid);
+        } else {
+            charWeaponPrevValid = false;
+            collision_world_set_enabled(charWeaponId, false);
+        }
+    }
 
-                float p0_world[3], p1_world[3];
-                mat4fp_mul_point_f32_row3_colbasis(M, p0_model, p0_world);
-                mat4fp_mul_point_f32_row3_colbasis(M, p1_model, p1_world);
+    // ------------------------------------------------------------
+    // Weapon hit tests, only for pairs whose bounds overlap. The blade is
+    // swept from last step's pose to this one against the target's current
+    // capsule, so a fast swing can't pass through between two samples.
+    // ------------------------------------------------------------
+    pairCount = collision_world_find_pairs(COLLISION_LAYERS_ACTORS, pairs, COLLISION_MAX_PAIRS);
+    for (int i = 0; i < pairCount; i++) {
+        if (pairs[i].a == bossWeaponId && pairs[i].b == charBodyId) {
+            collision_stat_add(COLLISION_STAT_CAPSULE_CAPSULE, 1);
+            bossWeaponCollision = scu_swept_capsule_vs_capsule_f(
+                bossWeaponPrevA.v, bossWeaponPrevB.v,
+                bossWeaponCapA.v, bossWeaponCapB.v, bossWeaponRadius,
+                charCapA.v, charCapB.v, charRadius,
+                NULL
+            );
+        } else if (pairs[i].a == charWeaponId && pairs[i].b == bossBodyId) {
+            // Debug collision target: boss body capsule
+            collision_stat_add(COLLISION_STAT_CAPSULE_CAPSULE, 1);
+            charWeaponCollision = scu_swept_capsule_vs_capsule_f(
+                charWeaponPrevA.v, charWeaponPrevB.v,
+                charWeaponCapA.v, charWeaponCapB.v, charWeaponRadius,
+                bossCapA.v, bossCapB.v, bossRadius,
+                NULL
+            );
+        }
+        // The body pair was resolved above
+    }
 
-                charWeaponCapA = (T3DVec3){{ p0_world[0], p0_world[1], p0_world[2] }};
-                charWeaponCapB = (T3DVec3){{ p1_world[0], p1_world[1], p1_world[2] }};
+    if (bossWeaponPrevValid) {
+        bossWeaponPrevA = bossWeaponCapA;
+        bossWeaponPrevB = bossWeaponCapB;
+    }
+    if (charWeaponPrevValid) {
+        charWeaponPrevA = charWeaponCapA;
+        charWeaponPrevB = charWeaponCapB;
+    }
+}
 
-                // Make sure radius is visible
-                charWeaponRadius = 2.0f;
+bool collision_raycast_static(const float from[3], const float to[3], float *tOut, float nOut[3])
+{
+    float t = 1.0f;
+    bool hit = false;
+
+    // Room boxes: only the ones whose bounds touch the segment's bounds
+    float min[3], max[3];
+    for (int k = 0; k < 3; k++) {
+        min[k] = fminf(from[k], to[k]);
+        max[k] = fmaxf(from[k], to[k]);
+    }
+    CollisionBodyId ids[COLLISION_RAY_MAX_BOXES];
+    int count = collision_world_query_aabb(min, max, COLLISION_LAYER_STATIC, ids, COLLISION_RAY_MAX_BOXES);
+    if (count > COLLISION_RAY_MAX_BOXES) {
+        // Only room boxes live on the static layer, so this means a new static body type
+        debugf("collision_raycast_static: %d static bodies, only %d cast\n", count, COLLISION_RAY_MAX_BOXES);
+        count = COLLISION_RAY_MAX_BOXES;
+    }
+    collision_stat_add(COLLISION_STAT_RAY, (uint32_t)count);
+    for (int i = 0; i < count; i++) {
+        const CollisionBody *b = collision_world_get(ids[i]);
+        float bt, bn[3];
+        if (b->shape != COLLISION_SHAPE_OBB) continue;
+        if (!scu_segment_vs_obb_f(from, to, &b->obb, &bt, bn) || bt >= t) continue;
+        t = bt;
+        nOut[0] = bn[0]; nOut[1] = bn[1]; nOut[2] = bn[2];
+        hit = true;
+    }
 
-                // Debug collision target: boss body capsule
-                charWeaponCollision = scu_capsule_vs_capsule_f(
-                    charWeaponCapA.v, charWeaponCapB.v, charWeaponRadius,
-                    bossCapA.v, bossCapB.v, bossRadius
-                );
-            }
-        }
+    // Walls: the nearer of the two wins
+    float mt, mn[3];
+    if (collision_mesh_raycast(from, to, &mt, mn) && mt < t) {
+        t = mt;
+        nOut[0] = mn[0]; nOut[1] = mn[1]; nOut[2] = mn[2];
+        hit = true;
     }
+
+    if (hit) *tOut = t;
+    return hit;
 }
 
 void collision_draw(T3DViewport *viewport)
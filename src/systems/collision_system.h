@@ -11,6 +11,13 @@ void collision_init(void);
 void collision_update(void);
 void collision_draw(T3DViewport *viewport);
 
+// Segment from -> to against the static room geometry (room boxes and the
+// collision mesh walls): nearest hit as t in [0,1) and the surface normal
+// facing `from`. Boxes come from the world broadphase, walls from the mesh
+// grid walk, so the cost follows what the segment passes, not the room size.
+// With no collision mesh loaded (the current room) only the boxes can hit.
+bool collision_raycast_static(const float from[3], const float to[3], float *tOut, float nOut[3]);
+
 //void collision_get_character_capsule_world(float outA[3], float outB[3], float *outR);
 
 #endif
\ No newline at end of file
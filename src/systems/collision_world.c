@@ -0,0 +1,236 @@
+#include "collision_world.h"
+
+#include <libdragon.h>
+#include <math.h>
+#include <string.h>
+
+#include "collision_stats.h"
+
+static CollisionBody bodies[COLLISION_WORLD_MAX_BODIES];
+
+// Used body ids sorted by boundsMin[0]. Bodies move a little per step, so the
+// insertion sort that restores the order is close to linear.
+static CollisionBodyId order[COLLISION_WORLD_MAX_BODIES];
+static int orderCount = 0;
+static bool orderDirty = false;
+
+void collision_world_reset(void)
+{
+    memset(bodies, 0, sizeof(bodies));
+    orderCount = 0;
+    orderDirty = false;
+}
+
+static CollisionBody *body_get(CollisionBodyId id)
+{
+    if (id < 0 || id >= COLLISION_WORLD_MAX_BODIES || !bodies[id].used) return NULL;
+    return &bodies[id];
+}
+
+CollisionBodyId collision_world_add(CollisionShape shape, uint16_t layer, uint16_t mask, int tag)
+{
+    for (int i = 0; i < COLLISION_WORLD_MAX_BODIES; i++) {
+        CollisionBody *b = &bodies[i];
+        if (b->used) continue;
+
+        memset(b, 0, sizeof(*b));
+        b->shape = shape;
+        b->layer = layer;
+        b->mask = mask;
+        b->tag = tag;
+        b->used = true;
+        b->enabled = false;
+
+        order[orderCount++] = i;
+        orderDirty = true;
+        return i;
+    }
+    debugf("collision world: out of bodies (%d)\n", COLLISION_WORLD_MAX_BODIES);
+    return COLLISION_BODY_NONE;
+}
+
+void collision_world_remove(CollisionBodyId id)
+{
+    CollisionBody *b = body_get(id);
+    if (!b) return;
+    b->used = false;
+    b->enabled = false;
+
+    for (int i = 0; i < orderCount; i++) {
+        if (order[i] != id) continue;
+        memmove(&order[i], &order[i + 1], (size_t)(orderCount - i - 1) * sizeof(order[0]));
+        orderCount--;
+        break;
+    }
+}
+
+void collision_world_set_capsule(CollisionBodyId id, const float a[3], const float b[3], float radius)
+{
+    CollisionBody *body = body_get(id);
+    if (!body) return;
+
+    for (int k = 0; k < 3; k++) {
+        body->capsule.a[k] = a[k];
+        body->capsule.b[k] = b[k];
+        body->boundsMin[k] = fminf(a[k], b[k]) - radius;
+        body->boundsMax[k] = fmaxf(a[k], b[k]) + radius;
+    }
+    body->capsule.radius = radius;
+    body->enabled = true;
+    orderDirty = true;
+}
+
+void collision_world_set_swept_capsule(CollisionBodyId id, const float prevA[3], const float prevB[3],
+    const float a[3], const float b[3], float radius)
+{
+    CollisionBody *body = body_get(id);
+    if (!body) return;
+
+    collision_world_set_capsule(id, a, b, radius);
+    for (int k = 0; k < 3; k++) {
+        body->boundsMin[k] = fminf(body->boundsMin[k], fminf(prevA[k], prevB[k]) - radius);
+        body->boundsMax[k] = fmaxf(body->boundsMax[k], fmaxf(prevA[k], prevB[k]) + radius);
+    }
+}
+
+void collision_world_set_aabb(CollisionBodyId id, const float min[3], const float max[3])
+{
+    CollisionBody *body = body_get(id);
+    if (!body) return;
+
+    for (int k = 0; k < 3; k++) {
+        body->aabb.min[k] = body->boundsMin[k] = min[k];
+        body->aabb.max[k] = body->boundsMax[k] = max[k];
+    }
+    body->enabled = true;
+    orderDirty = true;
+}
+
+void collision_world_set_obb(CollisionBodyId id, const SCU_OBB *obb)
+{
+    CollisionBody *body = body_get(id);
+    if (!body) return;
+
+    body->obb = *obb;
+
+    // Yaw-only box: the XZ extent of the rotated half extents
+    float c = fabsf(cosf(obb->yaw));
+    float s = fabsf(sinf(obb->yaw));
+    float ex = c * obb->half[0] + s * obb->half[2];
+    float ez = s * obb->half[0] + c * obb->half[2];
+    body->boundsMin[0] = obb->center[0] - ex;
+    body->boundsMax[0] = obb->center[0] + ex;
+    body->boundsMin[1] = obb->center[1] - obb->half[1];
+    body->boundsMax[1] = obb->center[1] + obb->half[1];
+    body->boundsMin[2] = obb->center[2] - ez;
+    body->boundsMax[2] = obb->center[2] + ez;
+    body->enabled = true;
+    orderDirty = true;
+}
+
+void collision_world_set_enabled(CollisionBodyId id, bool enabled)
+{
+    CollisionBody *body = body_get(id);
+    if (body) body->enabled = enabled;
+}
+
+const CollisionBody *collision_world_get(CollisionBodyId id)
+{
+    return body_get(id);
+}
+
+static void sort_order(void)
+{
+    if (!orderDirty) return;
+    orderDirty = false;
+
+    for (int i = 1; i < orderCount; i++) {
+        CollisionBodyId id = order[i];
+        float key = bodies[id].boundsMin[0];
+        int j = i - 1;
+        while (j >= 0 && bodies[order[j]].boundsMin[0] > key) {
+            order[j + 1] = order[j];
+            j--;
+        }
+        order[j + 1] = id;
+    }
+}
+
+static inline bool bounds_overlap_yz(const CollisionBody *a, const float min[3], const float max[3])
+{
+    return a->boundsMin[1] <= max[1] && a->boundsMax[1] >= min[1] &&
+           a->boundsMin[2] <= max[2] && a->boundsMax[2] >= min[2];
+}
+
+int collision_world_query_aabb(const float min[3], const float max[3], uint16_t layers,
+    CollisionBodyId *out, int maxOut)
+{
+    sort_order();
+
+    int count = 0;
+    uint32_t tests = 0;
+    for (int i = 0; i < orderCount; i++) {
+        const CollisionBody *b = &bodies[order[i]];
+        if (b->boundsMin[0] > max[0]) break; // sorted: nothing further can overlap
+        if (!b->enabled || !(b->layer & layers)) continue;
+        tests++;
+        if (b->boundsMax[0] < min[0]) continue;
+        if (!bounds_overlap_yz(b, min, max)) continue;
+        if (count < maxOut) out[count] = order[i];
+        count++;
+    }
+    int kept = count < maxOut ? count : maxOut;
+    collision_stat_add(COLLISION_STAT_BROAD_TESTS, tests);
+    collision_stat_add(COLLISION_STAT_BROAD_HITS, (uint32_t)kept);
+    collision_stat_add(COLLISION_STAT_BROAD_DROPPED, (uint32_t)(count - kept));
+    return count;
+}
+
+int collision_world_query_capsule(const float a[3], const float b[3], float radius, uint16_t layers,
+    CollisionBodyId *out, int maxOut)
+{
+    float min[3], max[3];
+    for (int k = 0; k < 3; k++) {
+        min[k] = fminf(a[k], b[k]) - radius;
+        max[k] = fmaxf(a[k], b[k]) + radius;
+    }
+    return collision_world_query_aabb(min, max, layers, out, maxOut);
+}
+
+int collision_world_find_pairs(uint16_t layers, CollisionPair *out, int maxOut)
+{
+    sort_order();
+
+    // Sort and sweep: each body only meets the bodies that start before it ends on X
+    int count = 0, dropped = 0;
+    uint32_t tests = 0;
+    for (int i = 0; i < orderCount; i++) {
+        const CollisionBody *a = &bodies[order[i]];
+        if (!a->enabled || !(a->layer & layers)) continue;
+
+        for (int j = i + 1; j < orderCount; j++) {
+            const CollisionBody *b = &bodies[order[j]];
+            if (b->boundsMin[0] > a->boundsMax[0]) break;
+            if (!b->enabled || !(b->layer & layers)) continue;
+            tests++;
+
+            bool aWants = (a->mask & b->layer) != 0;
+            bool bWants = (b->mask & a->layer) != 0;
+            if (!aWants && !bWants) continue;
+            if (!bounds_overlap_yz(b, a->boundsMin, a->boundsMax)) continue;
+
+            if (count >= maxOut) {
+                dropped++;
+                continue;
+            }
+            out[count].a = aWants ? order[i] : order[j];
+            out[count].b = aWants ? order[j] : order[i];
+            count++;
+        }
+    }
+    if (dropped) debugf("collision_world: %d pairs over the limit of %d dropped\n", dropped, maxOut);
+    collision_stat_add(COLLISION_STAT_BROAD_DROPPED, (uint32_t)dropped);
+    collision_stat_add(COLLISION_STAT_BROAD_TESTS, tests);
+    collision_stat_add(COLLISION_STAT_BROAD_HITS, (uint32_t)count);
+    return count;
+}
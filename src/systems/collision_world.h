@@ -0,0 +1,92 @@
+#ifndef COLLISION_WORLD_H
+#define COLLISION_WORLD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "simple_collision_utility.h"
+
+// One registry for everything that collides: character/boss bodies and
+// weapons, multi-sword blades and ribbon walls, and the room's static boxes.
+// Each body has a layer (what it is) and a mask (which layers it wants to be
+// paired with). Owners keep their bodies up to date; the broadphase (sort and
+// sweep along X over the body bounds) hands back candidate pairs or query hits,
+// and the owner runs the exact narrowphase only on those.
+//
+// collision_init() resets the world and registers the character and boss;
+// systems that own other colliders register theirs after it.
+
+typedef enum {
+    COLLISION_LAYER_STATIC      = 1 << 0, // room walls and pillars
+    COLLISION_LAYER_CHAR_BODY   = 1 << 1,
+    COLLISION_LAYER_BOSS_BODY   = 1 << 2,
+    COLLISION_LAYER_CHAR_WEAPON = 1 << 3,
+    COLLISION_LAYER_BOSS_WEAPON = 1 << 4,
+    COLLISION_LAYER_SWORD       = 1 << 5, // multi-sword attack blades
+    COLLISION_LAYER_RIBBON_WALL = 1 << 6, // multi-sword attack ribbon walls (one per ribbon)
+} CollisionLayer;
+
+typedef enum {
+    COLLISION_SHAPE_CAPSULE,
+    COLLISION_SHAPE_AABB,
+    COLLISION_SHAPE_OBB,
+} CollisionShape;
+
+typedef int CollisionBodyId;
+#define COLLISION_BODY_NONE (-1)
+
+#define COLLISION_WORLD_MAX_BODIES 80 // exported room boxes (up to 32) + 4 actor bodies + 2 per multi-sword blade
+
+typedef struct {
+    CollisionShape shape;
+    uint16_t layer;
+    uint16_t mask;
+    bool used;
+    bool enabled;
+    int tag;                   // owner-defined, e.g. the sword index
+    union {
+        struct { float a[3], b[3], radius; } capsule;
+        struct { float min[3], max[3]; } aabb;
+        SCU_OBB obb;
+    };
+    float boundsMin[3];        // broadphase bounds, kept in sync by the setters
+    float boundsMax[3];
+} CollisionBody;
+
+typedef struct {
+    CollisionBodyId a, b;      // a is the body whose mask asked for b's layer
+} CollisionPair;
+
+void collision_world_reset(void);
+
+// Registers a body (disabled until its shape is set). Returns COLLISION_BODY_NONE when full.
+CollisionBodyId collision_world_add(CollisionShape shape, uint16_t layer, uint16_t mask, int tag);
+void collision_world_remove(CollisionBodyId id);
+
+// Setting the shape also enables the body
+void collision_world_set_capsule(CollisionBodyId id, const float a[3], const float b[3], float radius);
+// Capsule at (a, b) whose bounds also cover where it was at (prevA, prevB), so
+// a swept narrowphase still gets the pair
+void collision_world_set_swept_capsule(CollisionBodyId id, const float prevA[3], const float prevB[3],
+    const float a[3], const float b[3], float radius);
+void collision_world_set_aabb(CollisionBodyId id, const float min[3], const float max[3]);
+void collision_world_set_obb(CollisionBodyId id, const SCU_OBB *obb);
+void collision_world_set_enabled(CollisionBodyId id, bool enabled);
+
+const CollisionBody *collision_world_get(CollisionBodyId id);
+
+// Enabled bodies on `layers` whose bounds overlap the box. Writes at most
+// maxOut ids but returns how many matched, so a result above maxOut means
+// bodies were left out (they are also counted under COLLISION_STAT_BROAD_DROPPED).
+int collision_world_query_aabb(const float min[3], const float max[3], uint16_t layers,
+    CollisionBodyId *out, int maxOut);
+// Same (including the return value), for the bounds of a capsule
+int collision_world_query_capsule(const float a[3], const float b[3], float radius, uint16_t layers,
+    CollisionBodyId *out, int maxOut);
+
+// Overlapping pairs among enabled bodies on `layers` where one body's mask
+// includes the other's layer. Pairs past maxOut are dropped, logged and
+// counted under COLLISION_STAT_BROAD_DROPPED.
+int collision_world_find_pairs(uint16_t layers, CollisionPair *out, int maxOut);
+
+#endif
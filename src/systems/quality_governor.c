@@ -0,0 +1,119 @@
+#include "quality_governor.h"
+
+#include <libdragon.h>
+
+#include "globals.h"
+
+// Frame budget is one fixed step (30fps). The two thresholds and hold times
+// give the hysteresis: drop quickly when frames run long, recover slowly.
+#define QG_BUDGET_MS        FIXED_TIMESTEP_MS
+#define QG_DEGRADE_MS       (QG_BUDGET_MS * 1.08f)
+#define QG_RECOVER_MS       (QG_BUDGET_MS * 0.85f)
+#define QG_DEGRADE_HOLD_S   0.25f
+#define QG_RECOVER_HOLD_S   3.0f
+#define QG_SETTLE_S         0.5f   // no further change right after switching
+#define QG_SMOOTHING        0.15f  // EMA weight of the newest frame
+#define QG_SAMPLE_MAX_MS    100.0f // loads / video hand-off shouldn't count as load
+
+static const char *LEVEL_NAMES[QUALITY_LEVEL_COUNT] = {
+    "full",
+    "reduced",
+    "low",
+    "minimum",
+};
+
+static const QualityBudgets LEVEL_BUDGETS[QUALITY_LEVEL_COUNT] = {
+    //                 subdiv  points  dust  crack  glows
+    [QUALITY_FULL]    = { 2,     23,    64,    64,    16 },
+    [QUALITY_REDUCED] = { 1,     12,    40,    64,    16 },
+    [QUALITY_LOW]     = { 1,      8,    24,     8,     8 },
+    [QUALITY_MINIMUM] = { 1,      6,    12,     0,     0 },
+};
+
+static QualityLevel level = QUALITY_FULL;
+static float smoothedMs = QG_BUDGET_MS;
+static bool smoothedValid = false;
+static float overTimer = 0.0f;
+static float underTimer = 0.0f;
+static float settleTimer = 0.0f;
+
+static void set_level(QualityLevel next)
+{
+    if (next == level) return;
+    if (DEV_MODE) {
+        debugf("[QUALITY] %s -> %s (%.1f ms avg)\n", LEVEL_NAMES[level], LEVEL_NAMES[next], smoothedMs);
+    }
+    level = next;
+    overTimer = 0.0f;
+    underTimer = 0.0f;
+    settleTimer = QG_SETTLE_S;
+}
+
+void quality_governor_reset(void)
+{
+    level = QUALITY_FULL;
+    smoothedMs = QG_BUDGET_MS;
+    smoothedValid = false;
+    overTimer = 0.0f;
+    underTimer = 0.0f;
+    settleTimer = 0.0f;
+}
+
+void quality_governor_frame_update(float frameSeconds)
+{
+    // The benchmark measures the effects at full cost
+    if (!QUALITY_GOVERNOR || BENCH_MODE) return;
+    if (frameSeconds <= 0.0f) return;
+
+    float ms = frameSeconds * 1000.0f;
+    if (ms > QG_SAMPLE_MAX_MS) return;
+
+    if (!smoothedValid) {
+        smoothedMs = ms;
+        smoothedValid = true;
+    } else {
+        smoothedMs += (ms - smoothedMs) * QG_SMOOTHING;
+    }
+
+    if (settleTimer > 0.0f) {
+        settleTimer -= frameSeconds;
+        return;
+    }
+
+    if (smoothedMs > QG_DEGRADE_MS) {
+        overTimer += frameSeconds;
+        underTimer = 0.0f;
+    } else if (smoothedMs < QG_RECOVER_MS) {
+        underTimer += frameSeconds;
+        overTimer = 0.0f;
+    } else {
+        overTimer = 0.0f;
+        underTimer = 0.0f;
+    }
+
+    if (overTimer >= QG_DEGRADE_HOLD_S && level < QUALITY_MINIMUM) {
+        set_level((QualityLevel)(level + 1));
+    } else if (underTimer >= QG_RECOVER_HOLD_S && level > QUALITY_FULL) {
+        set_level((QualityLevel)(level - 1));
+    }
+}
+
+QualityLevel quality_governor_get_level(void)
+{
+    return level;
+}
+
+float quality_governor_get_smoothed_ms(void)
+{
+    return smoothedMs;
+}
+
+const char *quality_level_name(QualityLevel l)
+{
+    return (l < QUALITY_LEVEL_COUNT) ? LEVEL_NAMES[l] : "?";
+}
+
+const QualityBudgets *quality_budgets(void)
+{
+    return &LEVEL_BUDGETS[level];
+}
@@ -0,0 +1,39 @@
+#ifndef QUALITY_GOVERNOR_H
+#define QUALITY_GOVERNOR_H
+
+#include <stdbool.h>
+
+// Adaptive effect budgets driven by measured frame time.
+// Once per frame the governor folds the frame time into a smoothed average,
+// steps the quality level down when it stays over budget and back up once it
+// has been comfortably under budget for a while. Only draw-side budgets
+// change, so the fixed-step simulation (and input replays) are identical at
+// every level.
+
+typedef enum {
+    QUALITY_FULL,
+    QUALITY_REDUCED,
+    QUALITY_LOW,
+    QUALITY_MINIMUM,
+    QUALITY_LEVEL_COUNT
+} QualityLevel;
+
+typedef struct {
+    int trailSubdivMax;     // sword_trail: Catmull-Rom subdivisions per segment
+    int trailPointsMax;     // sword_trail: ribbon points per trail, newest kept (12 samples, 23 points at most)
+    int dustDrawMax;        // scene: dust puffs drawn per frame
+    int ribbonCrackPoints;  // path_ribbon: floor crack points (decimated), 0 = no crack
+    int msaGlowMax;         // multi_sword_attacks: floor glows drawn
+} QualityBudgets;
+
+void quality_governor_reset(void);
+void quality_governor_frame_update(float frameSeconds);
+
+QualityLevel quality_governor_get_level(void);
+float quality_governor_get_smoothed_ms(void);
+const char *quality_level_name(QualityLevel level);
+
+// Budgets for the current level
+const QualityBudgets *quality_budgets(void);
+
+#endif
@@ -0,0 +1,69 @@
+#include "bone_cache.h"
+
+#include "game_math.h"
+
+void bone_cache_reset(BoneCache *cache)
+{
+    for (int i = 0; i < BONE_CACHE_SLOTS; i++) {
+        cache->bone[i] = -1;
+        cache->valid[i] = false;
+    }
+    cache->nextEvict = 0;
+}
+
+static int bone_cache_slot(BoneCache *cache, int bone)
+{
+    int freeSlot = -1;
+    for (int i = 0; i < BONE_CACHE_SLOTS; i++) {
+        if (cache->bone[i] == bone) return i;
+        if (freeSlot < 0 && cache->bone[i] < 0) freeSlot = i;
+    }
+    if (freeSlot >= 0) return freeSlot;
+
+    // More bones in use than slots: recycle round-robin
+    int slot = cache->nextEvict;
+    cache->nextEvict = (uint8_t)((cache->nextEvict + 1) % BONE_CACHE_SLOTS);
+    return slot;
+}
+
+const float (*bone_cache_world(BoneCache *cache, const T3DSkeleton *skeleton, const T3DMat4FP *modelMat, int bone))[3]
+{
+    if (!cache || !skeleton || !modelMat || bone < 0) return NULL;
+
+    int slot = bone_cache_slot(cache, bone);
+    if (cache->bone[slot] == bone && cache->valid[slot]) return cache->world[slot];
+
+    // world = bone (bone-local -> model) then model (model -> world)
+    float B[4][3], M[4][3];
+    mat4fp_to_f32_row3(&skeleton->boneMatricesFP[bone], B);
+    mat4fp_to_f32_row3(modelMat, M);
+
+    mat43_mul_f32(B, M, cache->world[slot]);
+
+    cache->bone[slot] = (int16_t)bone;
+    cache->valid[slot] = true;
+    return cache->world[slot];
+}
+
+bool bone_cache_world_point(BoneCache *cache, const T3DSkeleton *skeleton, const T3DMat4FP *modelMat,
+    int bone, const float local[3], float out[3])
+{
+    const float (*W)[3] = bone_cache_world(cache, skeleton, modelMat, bone);
+    if (!W) return false;
+
+    mat43_mul_points_f32(W, (const float (*)[3])local, (float (*)[3])out, 1);
+    return true;
+}
+
+bool bone_cache_world_segment(BoneCache *cache, const T3DSkeleton *skeleton, const T3DMat4FP *modelMat,
+    int bone, float len, float outBase[3], float outTip[3])
+{
+    const float (*W)[3] = bone_cache_world(cache, skeleton, modelMat, bone);
+    if (!W) return false;
+
+    for (int c = 0; c < 3; c++) {
+        outBase[c] = W[3][c];
+        outTip[c] = W[3][c] - len * W[0][c];
+    }
+    return true;
+}
@@ -0,0 +1,45 @@
+#ifndef BONE_CACHE_H
+#define BONE_CACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <t3d/t3d.h>
+#include <t3d/t3dskeleton.h>
+
+// Float world transforms (bone x model) for the few bones gameplay reads back:
+// weapon hands, lock-on targets, attachment points. A bone is decoded from
+// fixed point and multiplied at most once between invalidations, however many
+// systems ask for it.
+//
+// Owners call bone_cache_invalidate() whenever the skeleton pose
+// (t3d_skeleton_update) or the model matrix changes.
+
+#define BONE_CACHE_SLOTS 6
+
+typedef struct {
+    int16_t bone[BONE_CACHE_SLOTS];      // -1 = free slot
+    bool    valid[BONE_CACHE_SLOTS];
+    float   world[BONE_CACHE_SLOTS][4][3]; // rows 0..2 basis, row 3 translation (same layout as T3DMat4FP)
+    uint8_t nextEvict;
+} BoneCache;
+
+void bone_cache_reset(BoneCache *cache);
+
+static inline void bone_cache_invalidate(BoneCache *cache)
+{
+    for (int i = 0; i < BONE_CACHE_SLOTS; i++) cache->valid[i] = false;
+}
+
+// World transform of `bone`, computed on first use after an invalidation.
+// NULL if the skeleton, model matrix or bone index is missing.
+const float (*bone_cache_world(BoneCache *cache, const T3DSkeleton *skeleton, const T3DMat4FP *modelMat, int bone))[3];
+
+// Bone-local point -> world
+bool bone_cache_world_point(BoneCache *cache, const T3DSkeleton *skeleton, const T3DMat4FP *modelMat,
+    int bone, const float local[3], float out[3]);
+
+// Blade from the bone origin to -len along its local X (sword colliders and trails)
+bool bone_cache_world_segment(BoneCache *cache, const T3DSkeleton *skeleton, const T3DMat4FP *modelMat,
+    int bone, float len, float outBase[3], float outTip[3]);
+
+#endif
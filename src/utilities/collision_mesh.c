@@ -4,22 +4,136 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdint.h>
+#include <stddef.h>
 
 #include "collision_mesh.h"
+#include "simple_collision_utility.h"
 #include "character.h"
 #include "dev.h"
 #include "dev/debug_draw.h"
+#include "collision_stats.h"
 
 // Collision mesh data
 // Exported bossroom collision can easily exceed the old tiny limits.
 // Current bossroom.collision is ~300 verts / ~500 tris.
+// Text and manually built meshes allocate arrays sized for these limits on
+// first use. A binary mesh (.col) instead points everything into its blob.
 #define MAX_COLLISION_VERTICES 1024
 #define MAX_COLLISION_POLYS 2048
-static CollisionVertex collisionVertices[MAX_COLLISION_VERTICES];
-static ColliderPoly collisionPolys[MAX_COLLISION_POLYS];
+static CollisionVertex *collisionVertices = NULL;
+static ColliderPoly *collisionPolys = NULL;
 static int collisionVertexCount = 0;
 static int collisionPolyCount = 0;
 
+static void *buildStorage = NULL;  // text/manual path arrays
+static void *collisionBlob = NULL; // binary mesh, loaded with a single read
+
+// Binary meshes keep vertices quantized (debug draw only): v = q * scale + offset
+static const int16_t *quantVertices = NULL;
+static float quantScale = 1.0f;
+static float quantOffset[3];
+
+// Wall-only index list, so queries never walk floor/ceiling polys
+static uint16_t *wallPolys = NULL;
+static int wallPolyCount = 0;
+
+// Uniform XZ grid over the mesh bounds. Each cell lists the walls whose plane
+// can be violated by a point inside the cell (max signed distance over the cell
+// box > 0). Walls that can't be violated there are culled, so interior cells are
+// empty and a capsule only tests the few walls near its endpoints. Cells well
+// outside the room face most of the walls; those are flagged full instead and
+// fall back to the wall list (nothing should stand there anyway).
+#define COLLISION_GRID_DIM 16
+#define COLLISION_GRID_CELLS (COLLISION_GRID_DIM * COLLISION_GRID_DIM)
+#define COLLISION_GRID_MAX_REFS 8192
+#define COLLISION_GRID_CELL_MAX_REFS 48
+#define COLLISION_GRID_MARGIN 32.0f // grid extends past the mesh so near-wall points stay on it
+#define COLLISION_GRID_EPS 0.01f    // keep planes that touch a cell within float rounding
+
+typedef struct {
+    bool valid;
+    float minX, minY, minZ;
+    float maxX, maxY, maxZ;
+    float cellX, cellZ;
+    float invCellX, invCellZ;
+    int refCount;
+    int maxCellRefs;
+    int fullCells;
+} CollisionGrid;
+
+static CollisionGrid grid;
+static uint16_t *gridCellStart = NULL; // COLLISION_GRID_CELLS + 1 entries
+static uint16_t *gridRefs = NULL;
+static uint8_t *gridCellFull = NULL;
+
+// Floor height grid: FLOOR polys baked into heights and normals at the nodes of
+// a regular XZ grid over the floor bounds, so a height query is one bilinear
+// lookup instead of a triangle scan. Each node keeps up to FLOOR_GRID_LAYERS
+// stacked floors, highest first (a ledge over the ground keeps both), and a
+// query takes the highest one at or below its Y; nodes with no floor stay empty.
+#define FLOOR_GRID_DIM 32
+#define FLOOR_GRID_NODES ((FLOOR_GRID_DIM + 1) * (FLOOR_GRID_DIM + 1))
+#define FLOOR_GRID_LAYERS 2
+#define FLOOR_GRID_LAYER_GAP 4.0f // floors closer than this are one floor; a query this far under one still stands on it
+#define FLOOR_GRID_EMPTY (-INFINITY)
+#define FLOOR_GRID_EDGE_EPS 1e-4f // barycentric slack so nodes on shared edges aren't lost
+
+typedef struct {
+    bool valid;
+    float minX, minZ;
+    float invCellX, invCellZ;
+    float height[FLOOR_GRID_NODES][FLOOR_GRID_LAYERS]; // highest first, FLOOR_GRID_EMPTY after the last
+    int8_t normalX[FLOOR_GRID_NODES][FLOOR_GRID_LAYERS]; // unit normal * 127; y is recovered from x and z
+    int8_t normalZ[FLOOR_GRID_NODES][FLOOR_GRID_LAYERS];
+} FloorGrid;
+
+static FloorGrid floorGrid;
+
+// Binary collision mesh (.col), written big-endian by tools/export_collision.py
+// and put in native order as it loads.
+// All offsets are from the start of the file; sections are 8-byte aligned.
+#define COLLISION_BLOB_MAGIC "PCOL"
+#define COLLISION_BLOB_VERSION 1
+#define COLLISION_BLOB_HAS_GRID 0x0001
+
+typedef struct {
+    char magic[4];
+    uint16_t version;
+    uint16_t flags;
+    uint16_t vertexCount;
+    uint16_t polyCount;
+    uint16_t wallCount;
+    uint16_t gridDim;
+    uint32_t refCount;
+    float quantScale;
+    float quantOffset[3];
+    float gridMin[3];        // mesh space, margin included
+    float gridMax[3];
+    uint32_t vertexOffset;   // int16_t[vertexCount][3]
+    uint32_t polyOffset;     // ColliderPoly[polyCount], planes oriented inward
+    uint32_t wallOffset;     // uint16_t[wallCount]
+    uint32_t cellStartOffset; // uint16_t[gridDim * gridDim + 1]
+    uint32_t cellFullOffset; // uint8_t[gridDim * gridDim]
+    uint32_t refOffset;      // uint16_t[refCount]
+} CollisionBlobHeader;
+
+_Static_assert(sizeof(CollisionBlobHeader) == 84, "collision blob header layout");
+_Static_assert(sizeof(ColliderPoly) == 32, "collision blob poly layout");
+
+// Room box table (.obb), the COLLISION node fitted with oriented boxes by
+// tools/export_collision.py. Big-endian, header followed by SCU_OBB entries.
+#define ROOM_OBB_MAGIC "POBB"
+#define ROOM_OBB_VERSION 1
+
+typedef struct {
+    char magic[4];
+    uint16_t version;
+    uint16_t count;
+} RoomObbTableHeader;
+
+_Static_assert(sizeof(RoomObbTableHeader) == 8, "room obb header layout");
+_Static_assert(sizeof(SCU_OBB) == 28, "room obb entry layout");
+
 // Collision vertex transform (to match how the map is rendered)
 static float collisionScale = 1.0f;
 static float collisionTx = 0.0f;
@@ -28,6 +142,70 @@ static float collisionTz = 0.0f;
 
 // Forward decl
 static void compute_plane_equation(ColliderPoly* poly, const CollisionVertex* vertices);
+static void build_floor_grid(void);
+
+static void release_storage(void)
+{
+    free(buildStorage);
+    free(collisionBlob);
+    buildStorage = NULL;
+    collisionBlob = NULL;
+
+    collisionVertices = NULL;
+    collisionPolys = NULL;
+    quantVertices = NULL;
+    wallPolys = NULL;
+    gridCellStart = NULL;
+    gridRefs = NULL;
+    gridCellFull = NULL;
+
+    collisionVertexCount = 0;
+    collisionPolyCount = 0;
+    wallPolyCount = 0;
+    grid.valid = false;
+    floorGrid.valid = false;
+}
+
+static bool ensure_build_storage(void)
+{
+    if (buildStorage) return true;
+    release_storage(); // building replaces a loaded binary mesh
+
+    size_t polyBytes = sizeof(ColliderPoly) * MAX_COLLISION_POLYS;
+    size_t vertBytes = sizeof(CollisionVertex) * MAX_COLLISION_VERTICES;
+    size_t wallBytes = sizeof(uint16_t) * MAX_COLLISION_POLYS;
+    size_t cellBytes = sizeof(uint16_t) * (COLLISION_GRID_CELLS + 1);
+    size_t refBytes = sizeof(uint16_t) * COLLISION_GRID_MAX_REFS;
+    uint8_t *mem = malloc(polyBytes + vertBytes + wallBytes + cellBytes + refBytes + COLLISION_GRID_CELLS);
+    if (!mem) {
+        debugf("collision: malloc failed for mesh build storage\n");
+        return false;
+    }
+
+    buildStorage = mem;
+    collisionPolys = (ColliderPoly *)mem;            mem += polyBytes;
+    collisionVertices = (CollisionVertex *)mem;      mem += vertBytes;
+    wallPolys = (uint16_t *)mem;                     mem += wallBytes;
+    gridCellStart = (uint16_t *)mem;                 mem += cellBytes;
+    gridRefs = (uint16_t *)mem;                      mem += refBytes;
+    gridCellFull = mem;
+    return true;
+}
+
+static void get_vertex(int i, T3DVec3 *out)
+{
+    if (quantVertices) {
+        const int16_t *q = &quantVertices[i * 3];
+        *out = (T3DVec3){{
+            q[0] * quantScale + quantOffset[0],
+            q[1] * quantScale + quantOffset[1],
+            q[2] * quantScale + quantOffset[2],
+        }};
+    } else {
+        const CollisionVertex *v = &collisionVertices[i];
+        *out = (T3DVec3){{ v->x, v->y, v->z }};
+    }
+}
 
 static void finalize_collision_planes(void)
 {
@@ -98,6 +276,9 @@ static void compute_plane_equation(ColliderPoly* poly, const CollisionVertex* ve
 // Helper function to add a vertex to the collision mesh
 int collision_mesh_add_vertex(float x, float y, float z)
 {
+    if (!ensure_build_storage()) {
+        return -1;
+    }
     if (collisionVertexCount >= MAX_COLLISION_VERTICES) {
         return -1;  // Out of space
     }
@@ -111,6 +292,9 @@ int collision_mesh_add_vertex(float x, float y, float z)
 // Helper function to add a polygon to the collision mesh
 bool collision_mesh_add_poly(int v0, int v1, int v2, ColliderType type)
 {
+    if (!buildStorage) {
+        return false;  // No vertices added yet
+    }
     if (collisionPolyCount >= MAX_COLLISION_POLYS) {
         return false;  // Out of space
     }
@@ -127,7 +311,12 @@ bool collision_mesh_add_poly(int v0, int v1, int v2, ColliderType type)
     
     // Compute plane equation
     compute_plane_equation(&collisionPolys[collisionPolyCount], collisionVertices);
-    
+
+    if (type == COLLIDER_WALL) {
+        wallPolys[wallPolyCount++] = (uint16_t)collisionPolyCount;
+    }
+    grid.valid = false; // rebuilt by collision_mesh_build_grid()
+
     collisionPolyCount++;
     return true;
 }
@@ -136,7 +325,7 @@ bool collision_mesh_add_poly(int v0, int v1, int v2, ColliderType type)
 // Format: 
 //   v x y z        (vertex)
 //   f v0 v1 v2 type (face: vertex indices and type: FLOOR=0, WALL=1, CEILING=2)
-static bool parse_collision_text(const char* filename)
+static const char *collision_dfs_path(const char *filename)
 {
     // dfs_* APIs expect DFS paths like "bossroom.collision".
     // Accept common asset-style prefixes too (e.g. "rom:/bossroom.collision") for convenience.
@@ -147,6 +336,253 @@ static bool parse_collision_text(const char* filename)
         dfs_path += 4;
         if (*dfs_path == '/') dfs_path++;
     }
+    return dfs_path;
+}
+
+// Big-endian reads for the exported files, so they load the same on the host
+static uint16_t be_u16(const uint8_t *p)
+{
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static uint32_t be_u32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static float be_f32(const uint8_t *p)
+{
+    uint32_t u = be_u32(p);
+    float f;
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+// Rewrite count big-endian 16/32-bit words at p in native order, in place.
+// The console is big-endian already, so only the host build does any work.
+static void blob_native16(uint8_t *p, uint32_t count)
+{
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    for (uint32_t i = 0; i < count; i++, p += 2) {
+        uint16_t v = be_u16(p);
+        memcpy(p, &v, sizeof(v));
+    }
+#else
+    (void)p; (void)count;
+#endif
+}
+
+static void blob_native32(uint8_t *p, uint32_t count)
+{
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    for (uint32_t i = 0; i < count; i++, p += 4) {
+        uint32_t v = be_u32(p);
+        memcpy(p, &v, sizeof(v));
+    }
+#else
+    (void)p; (void)count;
+#endif
+}
+
+static bool blob_section_ok(uint32_t offset, uint32_t bytes, int fileSize)
+{
+    return (offset & 7) == 0 && offset <= (uint32_t)fileSize && bytes <= (uint32_t)fileSize - offset;
+}
+
+// Every index in the blob must land inside the section it points into; the
+// queries trust them. Sections are already known to be in bounds.
+static const char *blob_indices_error(const uint8_t *blob, const CollisionBlobHeader *h, bool hasGrid)
+{
+    const ColliderPoly *polys = (const ColliderPoly *)(blob + h->polyOffset);
+    for (int i = 0; i < h->polyCount; i++) {
+        const ColliderPoly *p = &polys[i];
+        if ((unsigned)p->v0 >= h->vertexCount || (unsigned)p->v1 >= h->vertexCount ||
+            (unsigned)p->v2 >= h->vertexCount) {
+            return "poly vertex index out of range";
+        }
+        if ((unsigned)p->type > COLLIDER_CEILING) return "bad poly type";
+    }
+
+    const uint16_t *walls = (const uint16_t *)(blob + h->wallOffset);
+    for (int i = 0; i < h->wallCount; i++) {
+        if (walls[i] >= h->polyCount) return "wall index out of range";
+    }
+
+    if (!hasGrid) return NULL;
+    const uint16_t *cellStart = (const uint16_t *)(blob + h->cellStartOffset);
+    const int cells = h->gridDim * h->gridDim;
+    for (int c = 0; c < cells; c++) {
+        if (cellStart[c] > cellStart[c + 1]) return "grid cell starts not sorted";
+    }
+    if (cellStart[cells] > h->refCount) return "grid cells past the ref list";
+    const uint16_t *refs = (const uint16_t *)(blob + h->refOffset);
+    for (uint32_t i = 0; i < h->refCount; i++) {
+        if (refs[i] >= h->polyCount) return "grid ref out of range";
+    }
+    return NULL;
+}
+
+// Load a binary collision mesh: one read into a single allocation (plus, on a
+// little-endian host, one pass putting its words in native order), then turn
+// the section offsets into pointers. Planes and the grid are prebuilt by the
+// exporter; only the map transform (collision_mesh_set_transform) is applied here.
+bool collision_mesh_load_binary(const char *filename)
+{
+    const char *dfs_path = collision_dfs_path(filename);
+    int fd = dfs_open(dfs_path);
+    if (fd < 0) {
+        debugf("collision: dfs_open failed for %s (dfs_path=%s fd=%d)\n", filename, dfs_path, fd);
+        return false;
+    }
+
+    int fileSize = dfs_size(fd);
+    if (fileSize < (int)sizeof(CollisionBlobHeader) || fileSize > (512 * 1024)) {
+        debugf("collision: %s has no binary mesh (size=%d)\n", filename, fileSize);
+        dfs_close(fd);
+        return false;
+    }
+
+    uint8_t *blob = malloc(fileSize);
+    if (!blob) {
+        debugf("collision: malloc failed for %s (%d bytes)\n", filename, fileSize);
+        dfs_close(fd);
+        return false;
+    }
+
+    int bytesRead = dfs_read(blob, 1, fileSize, fd);
+    dfs_close(fd);
+
+    // Magic, then the u16 counts, then 32-bit words (ref count, floats, offsets)
+    CollisionBlobHeader header;
+    memcpy(&header, blob, sizeof(header));
+    blob_native16((uint8_t *)&header + offsetof(CollisionBlobHeader, version),
+        (offsetof(CollisionBlobHeader, refCount) - offsetof(CollisionBlobHeader, version)) / 2);
+    blob_native32((uint8_t *)&header + offsetof(CollisionBlobHeader, refCount),
+        (sizeof(header) - offsetof(CollisionBlobHeader, refCount)) / 4);
+
+    const CollisionBlobHeader *h = &header;
+    const int cells = h->gridDim * h->gridDim;
+    bool hasGrid = (h->flags & COLLISION_BLOB_HAS_GRID) != 0;
+    const char *error = NULL;
+    if (bytesRead != fileSize) {
+        error = "short read";
+    } else if (memcmp(h->magic, COLLISION_BLOB_MAGIC, 4) != 0 || h->version != COLLISION_BLOB_VERSION) {
+        error = "bad magic/version (re-export)";
+    } else if (hasGrid && h->gridDim != COLLISION_GRID_DIM) {
+        error = "grid size mismatch (re-export)";
+    } else if (collisionScale <= 0.0f) {
+        error = "transform scale must be positive";
+    } else if (!blob_section_ok(h->vertexOffset, h->vertexCount * 3 * sizeof(int16_t), fileSize) ||
+               !blob_section_ok(h->polyOffset, h->polyCount * sizeof(ColliderPoly), fileSize) ||
+               !blob_section_ok(h->wallOffset, h->wallCount * sizeof(uint16_t), fileSize) ||
+               (hasGrid && (!blob_section_ok(h->cellStartOffset, (cells + 1) * sizeof(uint16_t), fileSize) ||
+                            !blob_section_ok(h->cellFullOffset, cells, fileSize) ||
+                            !blob_section_ok(h->refOffset, h->refCount * sizeof(uint16_t), fileSize)))) {
+        error = "section out of bounds";
+    } else {
+        blob_native16(blob + h->vertexOffset, h->vertexCount * 3u);
+        blob_native32(blob + h->polyOffset, h->polyCount * (uint32_t)(sizeof(ColliderPoly) / 4));
+        blob_native16(blob + h->wallOffset, h->wallCount);
+        if (hasGrid) {
+            blob_native16(blob + h->cellStartOffset, cells + 1u);
+            blob_native16(blob + h->refOffset, h->refCount);
+        }
+        error = blob_indices_error(blob, h, hasGrid);
+    }
+    if (error) {
+        debugf("collision: rejecting %s: %s\n", filename, error);
+        free(blob);
+        return false;
+    }
+
+    release_storage();
+    collisionBlob = blob;
+    collisionVertexCount = h->vertexCount;
+    collisionPolyCount = h->polyCount;
+    wallPolyCount = h->wallCount;
+    quantVertices = (const int16_t *)(blob + h->vertexOffset);
+    collisionPolys = (ColliderPoly *)(blob + h->polyOffset);
+    wallPolys = (uint16_t *)(blob + h->wallOffset);
+
+    // Mesh space -> world: x' = x * s + t. Normals are unchanged for s > 0 and
+    // n.x' + (d * s - n.t) = 0 keeps the inward orientation.
+    const float s = collisionScale;
+    const float t[3] = { collisionTx, collisionTy, collisionTz };
+    quantScale = h->quantScale * s;
+    for (int k = 0; k < 3; k++) quantOffset[k] = h->quantOffset[k] * s + t[k];
+    for (int i = 0; i < collisionPolyCount; i++) {
+        ColliderPoly *p = &collisionPolys[i];
+        p->planeD = p->planeD * s - (p->planeA * t[0] + p->planeB * t[1] + p->planeC * t[2]);
+    }
+
+    if (hasGrid) {
+        gridCellStart = (uint16_t *)(blob + h->cellStartOffset);
+        gridCellFull = blob + h->cellFullOffset;
+        gridRefs = (uint16_t *)(blob + h->refOffset);
+        grid.minX = h->gridMin[0] * s + t[0]; grid.maxX = h->gridMax[0] * s + t[0];
+        grid.minY = h->gridMin[1] * s + t[1]; grid.maxY = h->gridMax[1] * s + t[1];
+        grid.minZ = h->gridMin[2] * s + t[2]; grid.maxZ = h->gridMax[2] * s + t[2];
+        grid.cellX = (grid.maxX - grid.minX) / COLLISION_GRID_DIM;
+        grid.cellZ = (grid.maxZ - grid.minZ) / COLLISION_GRID_DIM;
+        grid.invCellX = 1.0f / grid.cellX;
+        grid.invCellZ = 1.0f / grid.cellZ;
+        grid.refCount = (int)h->refCount;
+        grid.valid = true;
+    }
+
+    build_floor_grid();
+    return collisionPolyCount > 0;
+}
+
+int collision_mesh_load_room_obbs(const char *filename, SCU_OBB *out, int maxOut)
+{
+    const char *dfs_path = collision_dfs_path(filename);
+    int fd = dfs_open(dfs_path);
+    if (fd < 0) return 0;
+
+    // At most 32 boxes: decoded field by field from one small read, so the
+    // table reads the same on the host as on the console
+    enum { ENTRY_BYTES = 7 * 4 };
+    uint8_t buf[sizeof(RoomObbTableHeader) + SCU_STATIC_OBB_MAX * ENTRY_BYTES];
+    int fileSize = dfs_size(fd);
+    int bytesRead = (fileSize > 0 && fileSize <= (int)sizeof(buf)) ? dfs_read(buf, 1, fileSize, fd) : -1;
+    dfs_close(fd);
+
+    int count = bytesRead >= (int)sizeof(RoomObbTableHeader) ? be_u16(buf + 6) : 0;
+    const char *error = NULL;
+    if (bytesRead != fileSize || fileSize < (int)sizeof(RoomObbTableHeader)) {
+        error = "missing, oversized or short read";
+    } else if (memcmp(buf, ROOM_OBB_MAGIC, 4) != 0 || be_u16(buf + 4) != ROOM_OBB_VERSION) {
+        error = "bad magic/version (re-export)";
+    } else if (count == 0 || count > maxOut) {
+        error = "box count out of range";
+    } else if (fileSize != (int)sizeof(RoomObbTableHeader) + count * ENTRY_BYTES) {
+        error = "size doesn't match the box count";
+    } else if (collisionScale <= 0.0f) {
+        error = "transform scale must be positive";
+    }
+    if (error) {
+        debugf("collision: rejecting %s: %s\n", filename, error);
+        return 0;
+    }
+
+    // Same mesh space -> world transform as the collision mesh
+    const float s = collisionScale;
+    const float t[3] = { collisionTx, collisionTy, collisionTz };
+    const uint8_t *e = buf + sizeof(RoomObbTableHeader);
+    for (int i = 0; i < count; i++, e += ENTRY_BYTES) {
+        for (int k = 0; k < 3; k++) {
+            out[i].center[k] = be_f32(e + k * 4) * s + t[k];
+            out[i].half[k] = be_f32(e + 12 + k * 4) * s;
+        }
+        out[i].yaw = be_f32(e + 24);
+    }
+    return count;
+}
+
+static bool parse_collision_text(const char* filename)
+{
+    const char *dfs_path = collision_dfs_path(filename);
 
     int fd = dfs_open(dfs_path);
     if (fd < 0) {
@@ -217,6 +653,7 @@ static bool parse_collision_text(const char* filename)
     
     free(buffer);
     finalize_collision_planes();
+    collision_mesh_build_grid();
     return collisionPolyCount > 0;
 }
 
@@ -224,12 +661,17 @@ static bool parse_collision_text(const char* filename)
 void collision_mesh_init(void)
 {
     // Reset counts
-    collisionVertexCount = 0;
-    collisionPolyCount = 0;
+    release_storage();
     
     // Try multiple extraction methods:
+
+    // 1. Binary mesh from the asset pipeline (no parsing, planes/grid prebuilt)
+    if (collision_mesh_load_binary("rom:/bossroom/bossroom.col")) {
+        debugf("Loaded collision mesh from bossroom.col (%d polys, %d walls)\n", collisionPolyCount, wallPolyCount);
+        return;
+    }
     
-    // 1. Try parsing a simple text collision file (recommended workflow)
+    // 2. Text collision file (older exports / hand-edited meshes)
     // Single-file workflow: assets/bossroom.glb contains Object named "COLLISION"
     // Build step exports filesystem/bossroom.collision, which we load here.
     if (parse_collision_text("rom:/bossroom/bossroom.collision")) {
@@ -253,6 +695,279 @@ void collision_mesh_init(void)
     }
 }
 
+static float plane_max_over_box(const ColliderPoly *p,
+    float minX, float minY, float minZ, float maxX, float maxY, float maxZ)
+{
+    return p->planeA * (p->planeA > 0.0f ? maxX : minX) +
+           p->planeB * (p->planeB > 0.0f ? maxY : minY) +
+           p->planeC * (p->planeC > 0.0f ? maxZ : minZ) +
+           p->planeD;
+}
+
+// Adds a floor height to a node's layers, merging it into a layer within
+// FLOOR_GRID_LAYER_GAP (the higher one wins). With every layer taken the
+// lowest floor is dropped.
+static void floor_node_insert(int node, float y, const float n[3])
+{
+    float *h = floorGrid.height[node];
+    int8_t *nx = floorGrid.normalX[node];
+    int8_t *nz = floorGrid.normalZ[node];
+
+    int at = 0;
+    for (int l = 0; l < FLOOR_GRID_LAYERS; l++) {
+        if (fabsf(h[l] - y) <= FLOOR_GRID_LAYER_GAP) {
+            if (y <= h[l]) return;
+            at = l;
+            break;
+        }
+        if (h[l] < y) {
+            at = l;
+            for (int k = FLOOR_GRID_LAYERS - 1; k > l; k--) {
+                h[k] = h[k - 1];
+                nx[k] = nx[k - 1];
+                nz[k] = nz[k - 1];
+            }
+            break;
+        }
+        at = l + 1;
+    }
+    if (at >= FLOOR_GRID_LAYERS) return;
+
+    h[at] = y;
+    nx[at] = (int8_t)lroundf(n[0] * 127.0f);
+    nz[at] = (int8_t)lroundf(n[2] * 127.0f);
+}
+
+// Highest layer of a node at or below y (within FLOOR_GRID_LAYER_GAP), or -1
+static inline int floor_node_layer(int node, float y)
+{
+    for (int l = 0; l < FLOOR_GRID_LAYERS; l++) {
+        if (floorGrid.height[node][l] <= y + FLOOR_GRID_LAYER_GAP) {
+            return floorGrid.height[node][l] == FLOOR_GRID_EMPTY ? -1 : l;
+        }
+    }
+    return -1;
+}
+
+static void build_floor_grid(void)
+{
+    floorGrid.valid = false;
+
+    float minX = INFINITY, maxX = -INFINITY;
+    float minZ = INFINITY, maxZ = -INFINITY;
+    for (int i = 0; i < collisionPolyCount; i++) {
+        const ColliderPoly *p = &collisionPolys[i];
+        if (p->type != COLLIDER_FLOOR) continue;
+        const int idx[3] = { p->v0, p->v1, p->v2 };
+        for (int k = 0; k < 3; k++) {
+            T3DVec3 v;
+            get_vertex(idx[k], &v);
+            minX = fminf(minX, v.v[0]); maxX = fmaxf(maxX, v.v[0]);
+            minZ = fminf(minZ, v.v[2]); maxZ = fmaxf(maxZ, v.v[2]);
+        }
+    }
+    if (!(maxX > minX && maxZ > minZ)) return;
+
+    const float cellX = (maxX - minX) / FLOOR_GRID_DIM;
+    const float cellZ = (maxZ - minZ) / FLOOR_GRID_DIM;
+    floorGrid.minX = minX;
+    floorGrid.minZ = minZ;
+    floorGrid.invCellX = 1.0f / cellX;
+    floorGrid.invCellZ = 1.0f / cellZ;
+    for (int n = 0; n < FLOOR_GRID_NODES; n++) {
+        for (int l = 0; l < FLOOR_GRID_LAYERS; l++) {
+            floorGrid.height[n][l] = FLOOR_GRID_EMPTY;
+            floorGrid.normalX[n][l] = 0;
+            floorGrid.normalZ[n][l] = 0;
+        }
+    }
+
+    // Rasterize every floor triangle over the nodes inside its XZ bounds
+    for (int i = 0; i < collisionPolyCount; i++) {
+        const ColliderPoly *p = &collisionPolys[i];
+        if (p->type != COLLIDER_FLOOR) continue;
+
+        T3DVec3 a, b, c;
+        get_vertex(p->v0, &a);
+        get_vertex(p->v1, &b);
+        get_vertex(p->v2, &c);
+
+        float e1[3] = { b.v[0] - a.v[0], b.v[1] - a.v[1], b.v[2] - a.v[2] };
+        float e2[3] = { c.v[0] - a.v[0], c.v[1] - a.v[1], c.v[2] - a.v[2] };
+        float n[3] = {
+            e1[1] * e2[2] - e1[2] * e2[1],
+            e1[2] * e2[0] - e1[0] * e2[2],
+            e1[0] * e2[1] - e1[1] * e2[0],
+        };
+        if (n[1] < 0.0f) { n[0] = -n[0]; n[1] = -n[1]; n[2] = -n[2]; }
+        float len = sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        if (n[1] < 1e-4f * len) continue; // vertical in XZ, no height to give
+        n[0] /= len; n[1] /= len; n[2] /= len;
+
+        // XZ barycentrics: p = a + u * e1 + v * e2
+        float det = e1[0] * e2[2] - e1[2] * e2[0];
+        if (fabsf(det) < 1e-9f) continue;
+        float invDet = 1.0f / det;
+
+        int cx0 = (int)ceilf((fminf(a.v[0], fminf(b.v[0], c.v[0])) - minX) * floorGrid.invCellX - FLOOR_GRID_EDGE_EPS);
+        int cx1 = (int)floorf((fmaxf(a.v[0], fmaxf(b.v[0], c.v[0])) - minX) * floorGrid.invCellX + FLOOR_GRID_EDGE_EPS);
+        int cz0 = (int)ceilf((fminf(a.v[2], fminf(b.v[2], c.v[2])) - minZ) * floorGrid.invCellZ - FLOOR_GRID_EDGE_EPS);
+        int cz1 = (int)floorf((fmaxf(a.v[2], fmaxf(b.v[2], c.v[2])) - minZ) * floorGrid.invCellZ + FLOOR_GRID_EDGE_EPS);
+        if (cx0 < 0) cx0 = 0;
+        if (cz0 < 0) cz0 = 0;
+        if (cx1 > FLOOR_GRID_DIM) cx1 = FLOOR_GRID_DIM;
+        if (cz1 > FLOOR_GRID_DIM) cz1 = FLOOR_GRID_DIM;
+
+        for (int cz = cz0; cz <= cz1; cz++) {
+            for (int cx = cx0; cx <= cx1; cx++) {
+                float dx = minX + cx * cellX - a.v[0];
+                float dz = minZ + cz * cellZ - a.v[2];
+                float u = (dx * e2[2] - dz * e2[0]) * invDet;
+                float v = (e1[0] * dz - e1[2] * dx) * invDet;
+                if (u < -FLOOR_GRID_EDGE_EPS || v < -FLOOR_GRID_EDGE_EPS || u + v > 1.0f + FLOOR_GRID_EDGE_EPS) continue;
+
+                int node = cz * (FLOOR_GRID_DIM + 1) + cx;
+                floor_node_insert(node, a.v[1] + u * e1[1] + v * e2[1], n);
+            }
+        }
+    }
+
+    int filled = 0, stacked = 0;
+    for (int n = 0; n < FLOOR_GRID_NODES; n++) {
+        if (floorGrid.height[n][0] != FLOOR_GRID_EMPTY) filled++;
+        if (floorGrid.height[n][1] != FLOOR_GRID_EMPTY) stacked++;
+    }
+    floorGrid.valid = filled > 0;
+    debugf("collision: floor grid %dx%d, %d of %d nodes on a floor, %d stacked\n",
+        FLOOR_GRID_DIM, FLOOR_GRID_DIM, filled, FLOOR_GRID_NODES, stacked);
+}
+
+bool collision_mesh_floor_at(float x, float y, float z, float *heightOut, float nOut[3])
+{
+    if (!floorGrid.valid) return false;
+
+    float fx = (x - floorGrid.minX) * floorGrid.invCellX;
+    float fz = (z - floorGrid.minZ) * floorGrid.invCellZ;
+    if (!(fx >= 0.0f && fz >= 0.0f && fx <= FLOOR_GRID_DIM && fz <= FLOOR_GRID_DIM)) return false;
+
+    int cx = (int)fx;
+    int cz = (int)fz;
+    if (cx >= FLOOR_GRID_DIM) cx = FLOOR_GRID_DIM - 1;
+    if (cz >= FLOOR_GRID_DIM) cz = FLOOR_GRID_DIM - 1;
+    float tx = fx - cx;
+    float tz = fz - cz;
+
+    const int n00 = cz * (FLOOR_GRID_DIM + 1) + cx;
+    const int nodes[4] = { n00, n00 + 1, n00 + FLOOR_GRID_DIM + 1, n00 + FLOOR_GRID_DIM + 2 };
+    const float w[4] = { (1.0f - tx) * (1.0f - tz), tx * (1.0f - tz), (1.0f - tx) * tz, tx * tz };
+
+    // The floor ends half a cell past its last node; on a border cell the
+    // corners with no floor under y drop out and the rest are renormalized.
+    int nearest = nodes[(tx >= 0.5f ? 1 : 0) + (tz >= 0.5f ? 2 : 0)];
+    if (floor_node_layer(nearest, y) < 0) return false;
+
+    float wSum = 0.0f, h = 0.0f, nx = 0.0f, nz = 0.0f;
+    for (int k = 0; k < 4; k++) {
+        int l = floor_node_layer(nodes[k], y);
+        if (l < 0) continue;
+        wSum += w[k];
+        h += w[k] * floorGrid.height[nodes[k]][l];
+        nx += w[k] * floorGrid.normalX[nodes[k]][l];
+        nz += w[k] * floorGrid.normalZ[nodes[k]][l];
+    }
+    *heightOut = h / wSum; // the nearest corner alone weighs at least 1/4
+
+    if (nOut) {
+        float s = 1.0f / (127.0f * wSum);
+        nOut[0] = nx * s;
+        nOut[2] = nz * s;
+        nOut[1] = sqrtf(fmaxf(1.0f - nOut[0] * nOut[0] - nOut[2] * nOut[2], 0.0f));
+    }
+    return true;
+}
+
+void collision_mesh_build_grid(void)
+{
+    grid.valid = false;
+    grid.refCount = 0;
+    grid.maxCellRefs = 0;
+    grid.fullCells = 0;
+
+    if (buildStorage) build_floor_grid();
+
+    // Binary meshes ship their grid prebuilt (and have no float vertices)
+    if (!buildStorage || wallPolyCount == 0 || collisionVertexCount == 0) return;
+
+    float minX = collisionVertices[0].x, maxX = minX;
+    float minY = collisionVertices[0].y, maxY = minY;
+    float minZ = collisionVertices[0].z, maxZ = minZ;
+    for (int i = 1; i < collisionVertexCount; i++) {
+        const CollisionVertex *v = &collisionVertices[i];
+        minX = fminf(minX, v->x); maxX = fmaxf(maxX, v->x);
+        minY = fminf(minY, v->y); maxY = fmaxf(maxY, v->y);
+        minZ = fminf(minZ, v->z); maxZ = fmaxf(maxZ, v->z);
+    }
+    grid.minX = minX - COLLISION_GRID_MARGIN; grid.maxX = maxX + COLLISION_GRID_MARGIN;
+    grid.minY = minY - COLLISION_GRID_MARGIN; grid.maxY = maxY + COLLISION_GRID_MARGIN;
+    grid.minZ = minZ - COLLISION_GRID_MARGIN; grid.maxZ = maxZ + COLLISION_GRID_MARGIN;
+    grid.cellX = (grid.maxX - grid.minX) / COLLISION_GRID_DIM;
+    grid.cellZ = (grid.maxZ - grid.minZ) / COLLISION_GRID_DIM;
+    grid.invCellX = 1.0f / grid.cellX;
+    grid.invCellZ = 1.0f / grid.cellZ;
+
+    int refCount = 0;
+    for (int cz = 0; cz < COLLISION_GRID_DIM; cz++) {
+        for (int cx = 0; cx < COLLISION_GRID_DIM; cx++) {
+            int cell = cz * COLLISION_GRID_DIM + cx;
+            float x0 = grid.minX + cx * grid.cellX;
+            float z0 = grid.minZ + cz * grid.cellZ;
+            gridCellStart[cell] = (uint16_t)refCount;
+            gridCellFull[cell] = 0;
+
+            for (int w = 0; w < wallPolyCount; w++) {
+                const ColliderPoly *p = &collisionPolys[wallPolys[w]];
+                float d = plane_max_over_box(p, x0, grid.minY, z0, x0 + grid.cellX, grid.maxY, z0 + grid.cellZ);
+                if (d <= -COLLISION_GRID_EPS) continue;
+                if (refCount - gridCellStart[cell] >= COLLISION_GRID_CELL_MAX_REFS) {
+                    refCount = gridCellStart[cell];
+                    gridCellFull[cell] = 1;
+                    grid.fullCells++;
+                    break;
+                }
+                if (refCount >= COLLISION_GRID_MAX_REFS) {
+                    debugf("collision: grid out of refs (%d), using the linear wall list\n", refCount);
+                    return;
+                }
+                gridRefs[refCount++] = wallPolys[w];
+            }
+
+            int cellRefs = refCount - gridCellStart[cell];
+            if (cellRefs > grid.maxCellRefs) grid.maxCellRefs = cellRefs;
+        }
+    }
+    gridCellStart[COLLISION_GRID_CELLS] = (uint16_t)refCount;
+    grid.refCount = refCount;
+    grid.valid = true;
+
+    debugf("collision: grid %dx%d, %d walls, %d refs (max %d per cell, %d cells full)\n",
+        COLLISION_GRID_DIM, COLLISION_GRID_DIM, wallPolyCount, refCount, grid.maxCellRefs, grid.fullCells);
+}
+
+// Cell containing a world point, or -1 when it lies outside the grid volume.
+static int grid_cell_index(float x, float y, float z)
+{
+    if (x < grid.minX || x > grid.maxX ||
+        y < grid.minY || y > grid.maxY ||
+        z < grid.minZ || z > grid.maxZ) {
+        return -1;
+    }
+    int cx = (int)((x - grid.minX) * grid.invCellX);
+    int cz = (int)((z - grid.minZ) * grid.invCellZ);
+    if (cx >= COLLISION_GRID_DIM) cx = COLLISION_GRID_DIM - 1;
+    if (cz >= COLLISION_GRID_DIM) cz = COLLISION_GRID_DIM - 1;
+    return cz * COLLISION_GRID_DIM + cx;
+}
+
 void collision_mesh_set_transform(float scale, float tx, float ty, float tz)
 {
     collisionScale = scale;
@@ -261,6 +976,15 @@ void collision_mesh_set_transform(float scale, float tx, float ty, float tz)
     collisionTz = tz;
 }
 
+static void draw_poly_wire(T3DViewport *vp, const ColliderPoly *poly, uint16_t color)
+{
+    T3DVec3 p0, p1, p2;
+    get_vertex(poly->v0, &p0);
+    get_vertex(poly->v1, &p1);
+    get_vertex(poly->v2, &p2);
+    debug_draw_tri_wire(vp, &p0, &p1, &p2, color);
+}
+
 void collision_mesh_debug_draw(T3DViewport *vp)
 {
     if (!vp || collisionPolyCount <= 0) return;
@@ -270,50 +994,81 @@ void collision_mesh_debug_draw(T3DViewport *vp)
     for (int i = 0; i < collisionPolyCount; i++) {
         const ColliderPoly *poly = &collisionPolys[i];
 
-        const CollisionVertex *a = &collisionVertices[poly->v0];
-        const CollisionVertex *b = &collisionVertices[poly->v1];
-        const CollisionVertex *c = &collisionVertices[poly->v2];
-
-        T3DVec3 p0 = {{ a->x, a->y, a->z }};
-        T3DVec3 p1 = {{ b->x, b->y, b->z }};
-        T3DVec3 p2 = {{ c->x, c->y, c->z }};
-
         uint16_t color = DEBUG_COLORS[0]; // default red
         if (poly->type == COLLIDER_FLOOR) color = DEBUG_COLORS[1];   // green
         else if (poly->type == COLLIDER_CEILING) color = DEBUG_COLORS[4]; // magenta
 
-        debug_draw_tri_wire(vp, &p0, &p1, &p2, color);
+        draw_poly_wire(vp, poly, color);
+    }
+}
+
+static void grid_cell_bounds(int cell, T3DVec3 *mn, T3DVec3 *mx)
+{
+    int cx = cell % COLLISION_GRID_DIM;
+    int cz = cell / COLLISION_GRID_DIM;
+    float floorY = grid.minY + COLLISION_GRID_MARGIN;
+    *mn = (T3DVec3){{ grid.minX + cx * grid.cellX, floorY, grid.minZ + cz * grid.cellZ }};
+    *mx = (T3DVec3){{ mn->v[0] + grid.cellX, floorY, mn->v[2] + grid.cellZ }};
+}
+
+void collision_mesh_debug_draw_grid(T3DViewport *vp)
+{
+    if (!vp || !grid.valid) return;
+
+    // Only cells that carry walls; empty interior cells would just be noise.
+    // Blue for a single wall, yellow where several walls meet, orange when full.
+    for (int cell = 0; cell < COLLISION_GRID_CELLS; cell++) {
+        int refs = gridCellStart[cell + 1] - gridCellStart[cell];
+        if (refs == 0 && !gridCellFull[cell]) continue;
+
+        uint16_t color = refs > 1 ? DEBUG_COLORS[3] : DEBUG_COLORS[2];
+        if (gridCellFull[cell]) color = DEBUG_COLORS[5];
+
+        T3DVec3 mn, mx;
+        grid_cell_bounds(cell, &mn, &mx);
+        debug_draw_aabb(vp, &mn, &mx, color);
+    }
+}
+
+void collision_mesh_debug_draw_grid_query(T3DViewport *vp, const float capA[3], const float capB[3])
+{
+    if (!vp || !grid.valid) return;
+
+    int cells[2] = {
+        grid_cell_index(capA[0], capA[1], capA[2]),
+        grid_cell_index(capB[0], capB[1], capB[2]),
+    };
+    for (int k = 0; k < 2; k++) {
+        int cell = cells[k];
+        if (cell < 0 || (k == 1 && cell == cells[0])) continue;
+
+        T3DVec3 mn, mx;
+        grid_cell_bounds(cell, &mn, &mx);
+        debug_draw_aabb(vp, &mn, &mx, DEBUG_COLORS[0]);
+
+        for (int r = gridCellStart[cell]; r < gridCellStart[cell + 1]; r++) {
+            draw_poly_wire(vp, &collisionPolys[gridRefs[r]], DEBUG_COLORS[0]);
+        }
     }
 }
 
 // Cleanup collision mesh system
 void collision_mesh_cleanup(void)
 {
-    collisionVertexCount = 0;
-    collisionPolyCount = 0;
+    release_storage();
 }
 
-// Check if a point is on the "inside" side of a plane (for walls, inside means negative distance)
-// Check if a capsule violates a collider plane.
+// Check if a capsule (world-space endpoints) violates a collider plane.
 // Planes are oriented so interior is dist <= 0.
 static bool capsule_violates_plane(
-    float posX, float posY, float posZ,
     const ColliderPoly* poly,
-    float localAx, float localAy, float localAz,
-    float localBx, float localBy, float localBz,
-    float radius,
-    float scale
+    float ax, float ay, float az,
+    float bx, float by, float bz,
+    float radius
 )
 {
-    // Get capsule endpoints in world space
-    float ax = posX + localAx * scale;
-    float ay = posY + localAy * scale;
-    float az = posZ + localAz * scale;
+    collision_stat_add(COLLISION_STAT_CAPSULE_MESH, 1);
 
-    float bx = posX + localBx * scale;
-    float by = posY + localBy * scale;
-    float bz = posZ + localBz * scale;
-    
     // Compute distance from capsule endpoints to plane
     float distA = poly->planeA * ax + poly->planeB * ay + poly->planeC * az + poly->planeD;
     float distB = poly->planeA * bx + poly->planeB * by + poly->planeC * bz + poly->planeD;
@@ -321,7 +1076,18 @@ static bool capsule_violates_plane(
     // Distance along the plane normal varies linearly along the capsule segment,
     // so the segment's maximum signed distance is max(distA, distB).
     // If that max exceeds the capsule radius, the capsule is outside the allowed half-space.
-    return fmaxf(distA, distB) > (radius * scale);
+    return fmaxf(distA, distB) > radius;
+}
+
+static bool capsule_violates_cell(int cell,
+    float ax, float ay, float az, float bx, float by, float bz, float radius)
+{
+    for (int r = gridCellStart[cell]; r < gridCellStart[cell + 1]; r++) {
+        if (capsule_violates_plane(&collisionPolys[gridRefs[r]], ax, ay, az, bx, by, bz, radius)) {
+            return true;
+        }
+    }
+    return false;
 }
 
 bool collision_mesh_check_bounds_capsule(
@@ -334,20 +1100,255 @@ bool collision_mesh_check_bounds_capsule(
 {
     if (collisionPolyCount == 0) return false;
 
-    for (int i = 0; i < collisionPolyCount; i++) {
-        if (collisionPolys[i].type != COLLIDER_WALL) continue;
-        if (capsule_violates_plane(
-                posX, posY, posZ, &collisionPolys[i],
-                localAx, localAy, localAz,
-                localBx, localBy, localBz,
-                radius, scale
-            )) {
+    // Capsule endpoints in world space
+    float ax = posX + localAx * scale;
+    float ay = posY + localAy * scale;
+    float az = posZ + localAz * scale;
+
+    float bx = posX + localBx * scale;
+    float by = posY + localBy * scale;
+    float bz = posZ + localBz * scale;
+
+    float r = radius * scale;
+
+    // A violation needs max(distA, distB) > r >= 0, so at least one endpoint is
+    // strictly outside the plane; only walls listed in the endpoint cells qualify.
+    if (grid.valid && r >= 0.0f) {
+        int cellA = grid_cell_index(ax, ay, az);
+        int cellB = grid_cell_index(bx, by, bz);
+        if (cellA >= 0 && cellB >= 0 && !gridCellFull[cellA] && !gridCellFull[cellB]) {
+            if (capsule_violates_cell(cellA, ax, ay, az, bx, by, bz, r)) return true;
+            return cellB != cellA && capsule_violates_cell(cellB, ax, ay, az, bx, by, bz, r);
+        }
+    }
+
+    // Off the grid, in a full cell, or no grid built for manually added polys: every wall
+    for (int i = 0; i < wallPolyCount; i++) {
+        if (capsule_violates_plane(&collisionPolys[wallPolys[i]], ax, ay, az, bx, by, bz, r)) {
             return true;
         }
     }
     return false;
 }
 
+// Earliest time of impact of a plane for a capsule moving by (moveX, 0, moveZ).
+// Both endpoints move together, so max(distA, distB) changes linearly with t.
+static void sweep_capsule_plane(const ColliderPoly *poly,
+    const float capA[3], const float capB[3], float radius,
+    float moveX, float moveZ, float *bestToi, const ColliderPoly **bestPoly)
+{
+    collision_stat_add(COLLISION_STAT_CAPSULE_MESH, 1);
+
+    float distA = poly->planeA * capA[0] + poly->planeB * capA[1] + poly->planeC * capA[2] + poly->planeD;
+    float distB = poly->planeA * capB[0] + poly->planeB * capB[1] + poly->planeC * capB[2] + poly->planeD;
+    float d0 = fmaxf(distA, distB);
+    float rate = poly->planeA * moveX + poly->planeC * moveZ;
+    if (rate <= 0.0f) return; // parallel or moving back inside
+
+    float t = (d0 > radius) ? 0.0f : (radius - d0) / rate;
+    if (t < *bestToi) {
+        *bestToi = t;
+        *bestPoly = poly;
+    }
+}
+
+bool collision_mesh_sweep_capsule(
+    const float capA[3], const float capB[3], float radius,
+    float moveX, float moveZ,
+    float *toiOut, float nOut[3]
+)
+{
+    if (collisionPolyCount == 0) return false;
+
+    float bestToi = 1.0f;
+    const ColliderPoly *bestPoly = NULL;
+
+    // A plane is first violated at some point on the swept path, which lies in
+    // one of the cells under the swept bounds of the endpoints, so scanning
+    // those cells is as exact as the static query.
+    float minX = fminf(capA[0], capB[0]) + fminf(moveX, 0.0f);
+    float maxX = fmaxf(capA[0], capB[0]) + fmaxf(moveX, 0.0f);
+    float minZ = fminf(capA[2], capB[2]) + fminf(moveZ, 0.0f);
+    float maxZ = fmaxf(capA[2], capB[2]) + fmaxf(moveZ, 0.0f);
+    int c0 = grid.valid && radius >= 0.0f ? grid_cell_index(minX, capA[1], minZ) : -1;
+    int c1 = c0 >= 0 ? grid_cell_index(maxX, capB[1], maxZ) : -1;
+    bool useGrid = c0 >= 0 && c1 >= 0;
+    if (useGrid) {
+        for (int cz = c0 / COLLISION_GRID_DIM; cz <= c1 / COLLISION_GRID_DIM && useGrid; cz++) {
+            for (int cx = c0 % COLLISION_GRID_DIM; cx <= c1 % COLLISION_GRID_DIM; cx++) {
+                if (gridCellFull[cz * COLLISION_GRID_DIM + cx]) {
+                    useGrid = false;
+                    break;
+                }
+            }
+        }
+    }
+
+    if (useGrid) {
+        for (int cz = c0 / COLLISION_GRID_DIM; cz <= c1 / COLLISION_GRID_DIM; cz++) {
+            for (int cx = c0 % COLLISION_GRID_DIM; cx <= c1 % COLLISION_GRID_DIM; cx++) {
+                int cell = cz * COLLISION_GRID_DIM + cx;
+                for (int r = gridCellStart[cell]; r < gridCellStart[cell + 1]; r++) {
+                    sweep_capsule_plane(&collisionPolys[gridRefs[r]], capA, capB, radius, moveX, moveZ, &bestToi, &bestPoly);
+                }
+            }
+        }
+    } else {
+        for (int i = 0; i < wallPolyCount; i++) {
+            sweep_capsule_plane(&collisionPolys[wallPolys[i]], capA, capB, radius, moveX, moveZ, &bestToi, &bestPoly);
+        }
+    }
+
+    if (!bestPoly) return false;
+
+    // Contact normal points back into the room, flattened to XZ
+    float nx = -bestPoly->planeA;
+    float nz = -bestPoly->planeC;
+    float len = sqrtf(nx * nx + nz * nz);
+    if (len < 1e-6f) return false;
+    *toiOut = bestToi;
+    nOut[0] = nx / len;
+    nOut[1] = 0.0f;
+    nOut[2] = nz / len;
+    return true;
+}
+
+// Segment from + t * d (t in [0, *bestT)) vs one wall triangle, either side
+// (Moller-Trumbore). Keeps the nearest hit.
+static void raycast_poly(const ColliderPoly *poly, const float from[3], const float d[3],
+    float *bestT, const ColliderPoly **bestPoly)
+{
+    collision_stat_add(COLLISION_STAT_RAY, 1);
+
+    T3DVec3 v0, v1, v2;
+    get_vertex(poly->v0, &v0);
+    get_vertex(poly->v1, &v1);
+    get_vertex(poly->v2, &v2);
+
+    float e1[3] = { v1.v[0] - v0.v[0], v1.v[1] - v0.v[1], v1.v[2] - v0.v[2] };
+    float e2[3] = { v2.v[0] - v0.v[0], v2.v[1] - v0.v[1], v2.v[2] - v0.v[2] };
+    float p[3] = {
+        d[1] * e2[2] - d[2] * e2[1],
+        d[2] * e2[0] - d[0] * e2[2],
+        d[0] * e2[1] - d[1] * e2[0],
+    };
+    float det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+    if (det == 0.0f) return; // segment parallel to the triangle
+    float invDet = 1.0f / det;
+
+    float s[3] = { from[0] - v0.v[0], from[1] - v0.v[1], from[2] - v0.v[2] };
+    float u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * invDet;
+    if (u < 0.0f || u > 1.0f) return;
+
+    float q[3] = {
+        s[1] * e1[2] - s[2] * e1[1],
+        s[2] * e1[0] - s[0] * e1[2],
+        s[0] * e1[1] - s[1] * e1[0],
+    };
+    float v = (d[0] * q[0] + d[1] * q[1] + d[2] * q[2]) * invDet;
+    if (v < 0.0f || u + v > 1.0f) return;
+
+    float t = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) * invDet;
+    if (t < 0.0f || t >= *bestT) return;
+    *bestT = t;
+    *bestPoly = poly;
+}
+
+bool collision_mesh_raycast(const float from[3], const float to[3], float *tOut, float nOut[3])
+{
+    if (collisionPolyCount == 0 || wallPolyCount == 0) return false;
+
+    float d[3] = { to[0] - from[0], to[1] - from[1], to[2] - from[2] };
+    float bestT = 1.0f;
+    const ColliderPoly *bestPoly = NULL;
+
+    // Walk the grid cells under the segment in order (a 2D DDA in XZ). A wall
+    // hit at some point is listed in the cell holding that point (its plane
+    // reaches 0 there), so the first cell that yields a hit ending inside it
+    // ends the walk. The grid covers every wall, so the segment is clipped to it.
+    bool useGrid = grid.valid;
+    if (useGrid) {
+        float t0 = 0.0f, t1 = 1.0f;
+        const float lo[2] = { grid.minX, grid.minZ };
+        const float hi[2] = { grid.maxX, grid.maxZ };
+        const float o[2] = { from[0], from[2] };
+        const float m[2] = { d[0], d[2] };
+        for (int k = 0; k < 2; k++) {
+            if (fabsf(m[k]) < 1e-6f) {
+                if (o[k] < lo[k] || o[k] > hi[k]) return false;
+                continue;
+            }
+            float inv = 1.0f / m[k];
+            float ta = (lo[k] - o[k]) * inv;
+            float tb = (hi[k] - o[k]) * inv;
+            if (ta > tb) { float tmp = ta; ta = tb; tb = tmp; }
+            if (ta > t0) t0 = ta;
+            if (tb < t1) t1 = tb;
+        }
+        if (t0 > t1) return false;
+
+        float sx = (from[0] + d[0] * t0 - grid.minX) * grid.invCellX;
+        float sz = (from[2] + d[2] * t0 - grid.minZ) * grid.invCellZ;
+        int cx = (int)sx, cz = (int)sz;
+        if (cx < 0) cx = 0; else if (cx >= COLLISION_GRID_DIM) cx = COLLISION_GRID_DIM - 1;
+        if (cz < 0) cz = 0; else if (cz >= COLLISION_GRID_DIM) cz = COLLISION_GRID_DIM - 1;
+
+        int stepX = d[0] > 0.0f ? 1 : -1;
+        int stepZ = d[2] > 0.0f ? 1 : -1;
+        float tDeltaX = fabsf(d[0]) > 1e-6f ? grid.cellX / fabsf(d[0]) : INFINITY;
+        float tDeltaZ = fabsf(d[2]) > 1e-6f ? grid.cellZ / fabsf(d[2]) : INFINITY;
+        float tMaxX = fabsf(d[0]) > 1e-6f
+            ? (grid.minX + (cx + (stepX > 0)) * grid.cellX - from[0]) / d[0] : INFINITY;
+        float tMaxZ = fabsf(d[2]) > 1e-6f
+            ? (grid.minZ + (cz + (stepZ > 0)) * grid.cellZ - from[2]) / d[2] : INFINITY;
+
+        for (;;) {
+            int cell = cz * COLLISION_GRID_DIM + cx;
+            if (gridCellFull[cell]) {
+                useGrid = false;
+                break;
+            }
+            for (int r = gridCellStart[cell]; r < gridCellStart[cell + 1]; r++) {
+                raycast_poly(&collisionPolys[gridRefs[r]], from, d, &bestT, &bestPoly);
+            }
+
+            float tExit = fminf(fminf(tMaxX, tMaxZ), t1);
+            if (bestPoly && bestT <= tExit) break;
+            if (tExit >= t1) break;
+            if (tMaxX < tMaxZ) {
+                cx += stepX;
+                tMaxX += tDeltaX;
+            } else {
+                cz += stepZ;
+                tMaxZ += tDeltaZ;
+            }
+            if (cx < 0 || cx >= COLLISION_GRID_DIM || cz < 0 || cz >= COLLISION_GRID_DIM) break;
+        }
+    }
+
+    // Full cell on the way, or no grid built for manually added polys: every wall
+    if (!useGrid) {
+        bestT = 1.0f;
+        bestPoly = NULL;
+        for (int i = 0; i < wallPolyCount; i++) {
+            raycast_poly(&collisionPolys[wallPolys[i]], from, d, &bestT, &bestPoly);
+        }
+    }
+
+    if (!bestPoly) return false;
+
+    // Face normal on the side the segment came from
+    float nx = bestPoly->planeA, ny = bestPoly->planeB, nz = bestPoly->planeC;
+    if (nx * d[0] + ny * d[1] + nz * d[2] > 0.0f) {
+        nx = -nx; ny = -ny; nz = -nz;
+    }
+    *tOut = bestT;
+    nOut[0] = nx;
+    nOut[1] = ny;
+    nOut[2] = nz;
+    return true;
+}
+
 // Check if character would collide with room boundaries at the given position
 // Returns true if character would be outside room bounds (collision detected)
 bool collision_mesh_check_bounds(float posX, float posY, float posZ)
@@ -380,3 +1381,24 @@ int collision_mesh_get_poly_count(void)
     return collisionPolyCount;
 }
 
+
+void collision_mesh_get_vertex(int index, float out[3])
+{
+    T3DVec3 v;
+    get_vertex(index, &v);
+    out[0] = v.v[0];
+    out[1] = v.v[1];
+    out[2] = v.v[2];
+}
+
+const ColliderPoly *collision_mesh_get_poly(int index)
+{
+    return &collisionPolys[index];
+}
+
+int collision_mesh_get_grid_cell(int cell, const uint16_t **refsOut)
+{
+    if (!grid.valid || gridCellFull[cell]) return -1;
+    *refsOut = &gridRefs[gridCellStart[cell]];
+    return gridCellStart[cell + 1] - gridCellStart[cell];
+}
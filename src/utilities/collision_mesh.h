@@ -2,7 +2,9 @@
 #define COLLISION_MESH_H
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <t3d/t3d.h>
+#include "simple_collision_utility.h"
 
 // Collision mesh structures
 typedef struct {
@@ -22,9 +24,19 @@ typedef struct {
     float planeA, planeB, planeC, planeD;
 } ColliderPoly;
 
-// Initialize collision mesh system
+// Initialize collision mesh system, trying the binary mesh and then the older
+// text exports. The game loads bossroom.col directly instead.
 void collision_mesh_init(void);
 
+// Replace the mesh with a binary one exported by tools/export_collision.py
+// (rom:/.../*.col), moved by the collision mesh transform. Returns false, and
+// keeps the current mesh, when the file is missing or fails validation. The
+// scene loads rom:/bossroom/bossroom.col; until room.glb has a COLLISION node
+// that file isn't built, the mesh stays empty and the queries below find no
+// walls or floor (the host kernels exercise them, and the loader through
+// collision_mesh_col_fixture).
+bool collision_mesh_load_binary(const char *filename);
+
 // Cleanup collision mesh system
 void collision_mesh_cleanup(void);
 
@@ -42,9 +54,42 @@ bool collision_mesh_check_bounds_capsule(
     float scale
 );
 
+// Swept capsule (world-space endpoints) moving by (moveX, 0, moveZ): earliest
+// time of impact in [0,1] against the walls and the XZ normal pointing back
+// into the room. A capsule already outside a wall reports toi 0 only when it
+// keeps moving out.
+bool collision_mesh_sweep_capsule(
+    const float capA[3], const float capB[3], float radius,
+    float moveX, float moveZ,
+    float *toiOut, float nOut[3]
+);
+
+// Segment from -> to against the walls: nearest hit as t in [0,1) along the
+// segment and the wall normal facing back toward `from`. Walks only the wall
+// grid cells the segment crosses, nearest first, and stops at the first hit.
+bool collision_mesh_raycast(const float from[3], const float to[3], float *tOut, float nOut[3]);
+
+// Floor under (x, y, z) from the baked floor height grid: the highest floor at
+// (or just above) y or below it, as a bilinear height and, when nOut isn't
+// NULL, the up-facing normal. Returns false off the floor (or with no FLOOR
+// polys loaded). O(1), no triangle scan.
+bool collision_mesh_floor_at(float x, float y, float z, float *heightOut, float nOut[3]);
+
+// Floor height under (x, y, z), or fallbackY where the grid has no floor
+static inline float collision_mesh_floor_height(float x, float y, float z, float fallbackY)
+{
+    float h;
+    return collision_mesh_floor_at(x, y, z, &h, NULL) ? h : fallbackY;
+}
+
 // Debug rendering: draw collision mesh wireframe on screen
 void collision_mesh_debug_draw(T3DViewport *vp);
 
+// Debug rendering for the wall grid: every cell that carries walls, or just the
+// cells (and their walls) a capsule query with these endpoints would test.
+void collision_mesh_debug_draw_grid(T3DViewport *vp);
+void collision_mesh_debug_draw_grid_query(T3DViewport *vp, const float capA[3], const float capB[3]);
+
 // Apply a transform to collision vertices as they are loaded.
 // Use this to match the world transform you render the level with (e.g. mapMatrix scale/translate).
 void collision_mesh_set_transform(float scale, float tx, float ty, float tz);
@@ -52,10 +97,26 @@ void collision_mesh_set_transform(float scale, float tx, float ty, float tz);
 // Manual population helpers (for defining collision geometry programmatically)
 int collision_mesh_add_vertex(float x, float y, float z);
 bool collision_mesh_add_poly(int v0, int v1, int v2, ColliderType type);
+// Build the wall grid used by the capsule queries. The file loader calls this;
+// call it after populating manually (queries fall back to the wall list until then).
+void collision_mesh_build_grid(void);
+
+// Load the room's oriented boxes fitted by the exporter (rom:/.../*.obb) into
+// out, moved by the collision mesh transform. Returns the box count, or 0 when
+// the table is missing, empty or doesn't fit (callers keep their own boxes).
+int collision_mesh_load_room_obbs(const char *filename, SCU_OBB *out, int maxOut);
 
 // Get collision mesh statistics
 int collision_mesh_get_vertex_count(void);
 int collision_mesh_get_poly_count(void);
 
+// Read back the loaded mesh (index < the counts above): a vertex in world
+// space, a poly with its plane (room interior on the negative side), and the
+// walls a wall grid cell lists (cell = z * dim + x). The cell count is -1 with
+// no grid, or for a cell flagged full (its queries test every wall).
+void collision_mesh_get_vertex(int index, float out[3]);
+const ColliderPoly *collision_mesh_get_poly(int index);
+int collision_mesh_get_grid_cell(int cell, const uint16_t **refsOut);
+
 #endif
 
@@ -1,4 +1,5 @@
 #include <t3d/t3d.h>
+#include <string.h>
 #include "game_math.h"
 #include "globals.h"
 
@@ -147,6 +148,76 @@ void mat4fp_get_translation_row3_f32(const T3DMat4FP *m, float out[3]) {
     out[2] = fp16_16_to_f32(m->m[3].i[2], m->m[3].f[2]);
 }
 
+void mat4fp_to_f32_row3(const T3DMat4FP *m, float out[4][3]) {
+    for (int r = 0; r < 4; r++) {
+        out[r][0] = fp16_16_to_f32(m->m[r].i[0], m->m[r].f[0]);
+        out[r][1] = fp16_16_to_f32(m->m[r].i[1], m->m[r].f[1]);
+        out[r][2] = fp16_16_to_f32(m->m[r].i[2], m->m[r].f[2]);
+    }
+}
+
+void mat4fp_to_fixed_row3(const T3DMat4FP *m, int32_t out[4][3]) {
+    for (int r = 0; r < 4; r++) {
+        for (int c = 0; c < 3; c++) {
+            out[r][c] = (int32_t)(((uint32_t)(uint16_t)m->m[r].i[c] << 16) | m->m[r].f[c]);
+        }
+    }
+}
+
+void mat43_mul_f32(const float a[4][3], const float b[4][3], float out[4][3]) {
+    float t[4][3];
+    for (int r = 0; r < 4; r++) {
+        for (int c = 0; c < 3; c++) {
+            t[r][c] = a[r][0]*b[0][c] + a[r][1]*b[1][c] + a[r][2]*b[2][c];
+        }
+    }
+    for (int c = 0; c < 3; c++) t[3][c] += b[3][c];
+    memcpy(out, t, sizeof(t));
+}
+
+void mat43_mul_points_f32(const float m[4][3], const float (*in)[3], float (*out)[3], int count) {
+    const float m00 = m[0][0], m01 = m[0][1], m02 = m[0][2];
+    const float m10 = m[1][0], m11 = m[1][1], m12 = m[1][2];
+    const float m20 = m[2][0], m21 = m[2][1], m22 = m[2][2];
+    const float tx = m[3][0], ty = m[3][1], tz = m[3][2];
+
+    for (int i = 0; i < count; i++) {
+        const float x = in[i][0], y = in[i][1], z = in[i][2];
+        out[i][0] = m00*x + m10*y + m20*z + tx;
+        out[i][1] = m01*x + m11*y + m21*z + ty;
+        out[i][2] = m02*x + m12*y + m22*z + tz;
+    }
+}
+
+void mat43_mul_dirs_f32(const float m[4][3], const float (*in)[3], float (*out)[3], int count) {
+    const float m00 = m[0][0], m01 = m[0][1], m02 = m[0][2];
+    const float m10 = m[1][0], m11 = m[1][1], m12 = m[1][2];
+    const float m20 = m[2][0], m21 = m[2][1], m22 = m[2][2];
+
+    for (int i = 0; i < count; i++) {
+        const float x = in[i][0], y = in[i][1], z = in[i][2];
+        out[i][0] = m00*x + m10*y + m20*z;
+        out[i][1] = m01*x + m11*y + m21*z;
+        out[i][2] = m02*x + m12*y + m22*z;
+    }
+}
+
+void mat43_mul_points_fixed(const int32_t m[4][3], const FixedVec3 *in, FixedVec3 *out, int count) {
+    for (int i = 0; i < count; i++) {
+        const int64_t x = in[i].v[0], y = in[i].v[1], z = in[i].v[2];
+        for (int c = 0; c < 3; c++) {
+            int64_t acc = (int64_t)m[0][c]*x + (int64_t)m[1][c]*y + (int64_t)m[2][c]*z;
+            out[i].v[c] = (int32_t)(acc >> FIXED_SHIFT) + m[3][c];
+        }
+    }
+}
+
+void mat4fp_mul_points_f32_row3_colbasis(const T3DMat4FP *m, const float (*in)[3], float (*out)[3], int count) {
+    float d[4][3];
+    mat4fp_to_f32_row3(m, d);
+    mat43_mul_points_f32(d, in, out, count);
+}
+
 void mat4fp_mul_point_f32_row3_colbasis(const T3DMat4FP *m, const float in[3], float out[3]) {
     const float x = in[0], y = in[1], z = in[2];
 
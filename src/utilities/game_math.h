@@ -44,6 +44,19 @@ void vec3_mad_fixed(FixedVec3* out, const FixedVec3* a, const FixedVec3* b, int3
 
 void mat4fp_get_translation_row3_f32(const T3DMat4FP *m, float out[3]);
 
+// Whole matrix as floats: rows 0..2 basis, row 3 translation
+void mat4fp_to_f32_row3(const T3DMat4FP *m, float out[4][3]);
+// Same, as Q16.16 (the 16.16 halves joined)
+void mat4fp_to_fixed_row3(const T3DMat4FP *m, int32_t out[4][3]);
+
+// Kernels on a decoded matrix: decode once, then transform any number of
+// points/dirs (same colbasis convention as the single-point functions below).
+// `in` and `out` may alias.
+void mat43_mul_f32(const float a[4][3], const float b[4][3], float out[4][3]); // a, then b
+void mat43_mul_points_f32(const float m[4][3], const float (*in)[3], float (*out)[3], int count);
+void mat43_mul_dirs_f32(const float m[4][3], const float (*in)[3], float (*out)[3], int count);
+void mat43_mul_points_fixed(const int32_t m[4][3], const FixedVec3 *in, FixedVec3 *out, int count); // Q16.16 points
+void mat4fp_mul_points_f32_row3_colbasis(const T3DMat4FP *m, const float (*in)[3], float (*out)[3], int count);
 void mat4fp_mul_point_f32_row3_colbasis(const T3DMat4FP *m, const float in[3], float out[3]);
 void mat4fp_get_axis_colbasis_f32(const T3DMat4FP *m, int axisCol, float out[3]);
 void mat4fp_mul_dir_f32_colbasis(const T3DMat4FP *m, const float in[3], float out[3]);
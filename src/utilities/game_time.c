@@ -1,13 +1,24 @@
 #include <libdragon.h>
 
 #include "game_time.h"
+#include "globals.h"
+#include "input_replay.h"
 
 static float TIME_SPEED = 1.0f;
 
+// Fixed-step simulation. Longer stalls (loading, video playback) are dropped
+// instead of replayed so a hitch can't turn into a burst of catch-up steps.
+static const float FIXED_DT = FIXED_TIMESTEP_MS / 1000.0f;
+static const int   FIXED_MAX_STEPS_PER_FRAME = 4;
+
 double nowS = 0.0;
 float gameTime = 0.0f;
 float lastTime = 0.0f;
 float deltaTime = 0.0f;
+float frameDeltaTime = 0.0f;
+float renderAlpha = 0.0f;
+
+static float fixedAccumulator = 0.0f;
 
 static float get_time_s() 
 {
@@ -17,6 +28,8 @@ static float get_time_s()
 void game_time_init(void) 
 {
     lastTime = get_time_s() - (1.0f / 60.0f);
+    fixedAccumulator = 0.0f;
+    renderAlpha = 0.0f;
 }
   
 void game_time_update(void)
@@ -26,6 +39,9 @@ void game_time_update(void)
 
     // Calculate the time difference between this frame and the last frame
     deltaTime = nowS - lastTime;
+    // Replays substitute the recorded delta so fixed steps line up exactly
+    deltaTime = input_replay_filter_delta(deltaTime);
+    frameDeltaTime = deltaTime;
 
     // Update game time with the adjusted deltaTime
     gameTime += deltaTime;
@@ -34,9 +50,41 @@ void game_time_update(void)
     lastTime = nowS;
 }
 
+int game_time_fixed_begin(void)
+{
+    float dt = frameDeltaTime * TIME_SPEED;
+    if (dt < 0.0f) dt = 0.0f;
+
+    fixedAccumulator += dt;
+
+    int steps = (int)(fixedAccumulator / FIXED_DT);
+    if (steps > FIXED_MAX_STEPS_PER_FRAME) {
+        steps = FIXED_MAX_STEPS_PER_FRAME;
+        fixedAccumulator = FIXED_DT * (float)steps;
+    }
+    fixedAccumulator -= FIXED_DT * (float)steps;
+
+    // Everything stepped inside the loop integrates the fixed dt
+    deltaTime = FIXED_DT;
+    return steps;
+}
+
+void game_time_fixed_end(void)
+{
+    renderAlpha = fixedAccumulator / FIXED_DT;
+    if (renderAlpha < 0.0f) renderAlpha = 0.0f;
+    if (renderAlpha > 1.0f) renderAlpha = 1.0f;
+
+    // Per-frame systems (camera, menus, draw) go back to wall-clock time
+    deltaTime = frameDeltaTime;
+}
+
 void game_time_reset(void)
 {
     gameTime = 0.0f;
-    lastTime = 0.0;
+    lastTime = get_time_s();
     deltaTime = 0.0f;
+    frameDeltaTime = 0.0f;
+    fixedAccumulator = 0.0f;
+    renderAlpha = 0.0f;
 }
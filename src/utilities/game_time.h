@@ -3,10 +3,17 @@
 
 extern float gameTime;
 extern float deltaTime;
+extern float frameDeltaTime;  // wall-clock frame time, unaffected by fixed stepping
+extern float renderAlpha;     // 0..1 fraction of a fixed step left over for interpolation
 extern double nowS;
 
 void game_time_init(void);
 void game_time_reset(void);
 void game_time_update(void);
 
+// Fixed-step simulation: returns how many FIXED_TIMESTEP_MS steps to run this
+// frame and switches deltaTime to the fixed step. Call fixed_end afterwards.
+int  game_time_fixed_begin(void);
+void game_time_fixed_end(void);
+
 #endif
\ No newline at end of file
@@ -17,6 +17,12 @@ void rng_seed(uint32_t a, uint32_t b)
     rng_s[1] = b ? b : 2;
 }
 
+void rng_get_state(uint32_t out[2])
+{
+    out[0] = rng_s[0];
+    out[1] = rng_s[1];
+}
+
 uint32_t rand_xorshift64(void)
 {
     uint32_t s1 = rng_s[0];
@@ -35,6 +41,16 @@ uint32_t rand_custom_u32(void)
 	return seed >> 16;
 }
 
+void rand_custom_set_seed(uint32_t s)
+{
+    seed = s;
+}
+
+uint32_t rand_custom_get_seed(void)
+{
+    return seed;
+}
+
 float rand_custom_float(void) 
 {
     return (rand_custom_u32() >> 8) * (1.0f / 16777216.0f);
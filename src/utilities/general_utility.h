@@ -47,7 +47,12 @@ void tile_double_scroll(void* user, rdpq_texparms_t *tp, rdpq_tile_t tile);
 bool scroll_filter_tag(void* userData, const T3DObject* obj);
 void tile_scroll_router(void* userData, rdpq_texparms_t* tileParams, rdpq_tile_t tile);
 
+void rng_seed(uint32_t a, uint32_t b);
+void rng_get_state(uint32_t out[2]);
+uint32_t rand_xorshift64(void);
 uint32_t rand_custom_u32(void);
+void rand_custom_set_seed(uint32_t s);
+uint32_t rand_custom_get_seed(void);
 float rand_custom_float(void);
 float rand_custom_float_signed(void);
 
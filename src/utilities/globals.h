@@ -15,6 +15,12 @@
 #define DEBUG_DRAW_ENVIRONMENTAL_HAZARDS false
 
 #define DEV_MODE true
+#define FRAME_TRACE false // stream main loop phases over debugf (needs DEV_MODE)
+#ifndef BENCH_MODE
+#define BENCH_MODE false // `make bench` builds with -DBENCH_MODE=1 (scripted boss fight benchmark)
+#endif
+#define QUALITY_GOVERNOR true // scale effect budgets with measured frame time (systems/quality_governor.c)
+#define DYNAMIC_RESOLUTION true // drop the gameplay 3D pass to 288x216 / 256x192 when the RDP runs long (render_scale_utility.c)
 #define SHOW_FPS true
 #define HARDWARE_MODE false
 #define PAL_MODE false
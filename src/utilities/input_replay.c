@@ -0,0 +1,272 @@
+#include "input_replay.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "general_utility.h"
+#include "game_time.h"
+#include "joypad_utility.h"
+
+#define REPLAY_MAGIC   0x50524C31 // "PRL1"
+#define REPLAY_DT_UNIT 10         // frame delta stored in 10us units
+
+typedef struct {
+    uint32_t magic;
+    uint32_t frameCount;
+    uint32_t seedLibc;
+    uint32_t seedCustom;
+    uint32_t seedXorshift[2];
+} ReplayHeader;
+
+// 16 bytes per frame
+typedef struct {
+    uint16_t held;
+    uint16_t pressed;
+    uint16_t released;
+    int8_t   stickX, stickY;
+    int8_t   cstickX, cstickY;
+    uint8_t  analogL, analogR;
+    uint16_t dt;
+    uint16_t rngCheck;
+} ReplayFrame;
+
+static ReplayHeader header;
+static ReplayFrame *frames = NULL;
+static bool haveRecording = false;
+
+static ReplayMode mode = REPLAY_OFF;
+static ReplayMode pendingMode = REPLAY_OFF;
+static int frameIndex = 0;
+static bool desynced = false;
+static bool held = false;
+
+// Real (wall-clock) frame time while a run is active, for run-to-run comparison
+static double runRealTimeS = 0.0;
+static float runPeakDt = 0.0f;
+
+static bool replay_alloc(void)
+{
+    if (!frames) {
+        frames = malloc(sizeof(ReplayFrame) * REPLAY_MAX_FRAMES);
+        if (!frames) {
+            debugf("[REPLAY] out of memory for %d frames\n", REPLAY_MAX_FRAMES);
+            return false;
+        }
+    }
+    return true;
+}
+
+static uint16_t replay_rng_check(void)
+{
+    uint32_t xs[2];
+    rng_get_state(xs);
+    uint32_t s = rand_custom_get_seed() ^ xs[0] ^ (xs[1] * 0x9E3779B9u);
+    return (uint16_t)(s ^ (s >> 16));
+}
+
+static void replay_apply_seeds(void)
+{
+    srand(header.seedLibc);
+    rand_custom_set_seed(header.seedCustom);
+    rng_seed(header.seedXorshift[0], header.seedXorshift[1]);
+}
+
+static void replay_begin_run(void)
+{
+    mode = pendingMode;
+    pendingMode = REPLAY_OFF;
+    frameIndex = 0;
+    desynced = false;
+    runRealTimeS = 0.0;
+    runPeakDt = 0.0f;
+    replay_apply_seeds();
+    // Leftover step time and unconsumed button edges would shift which frame
+    // each fixed step lands on, so both sides start with none
+    game_time_reset();
+    joypad_clear_pending();
+    debugf("[REPLAY] %s started\n", mode == REPLAY_RECORDING ? "recording" : "playback");
+}
+
+static void replay_end_run(void)
+{
+    if (mode == REPLAY_OFF) return;
+
+    int n = frameIndex;
+    debugf("[REPLAY] %s stopped after %d frames: avg %.3f ms, peak %.3f ms%s\n",
+        mode == REPLAY_RECORDING ? "recording" : "playback", n,
+        n > 0 ? (float)(runRealTimeS * 1000.0 / n) : 0.0f, runPeakDt * 1000.0f,
+        desynced ? " (DESYNCED)" : "");
+
+    if (mode == REPLAY_RECORDING) {
+        header.frameCount = (uint32_t)n;
+        haveRecording = n > 0;
+        if (haveRecording) input_replay_save(REPLAY_FILE_SD);
+    }
+    mode = REPLAY_OFF;
+}
+
+void input_replay_record_start(void)
+{
+    input_replay_stop();
+    if (!replay_alloc()) return;
+
+    uint32_t t = (uint32_t)get_ticks();
+    header = (ReplayHeader){
+        .magic = REPLAY_MAGIC,
+        .frameCount = 0,
+        .seedLibc = t,
+        .seedCustom = t * 1664525u + 1013904223u,
+        .seedXorshift = { t ^ 0x9E3779B9u, (t << 7) ^ 0x85EBCA6Bu },
+    };
+    haveRecording = false;
+    pendingMode = REPLAY_RECORDING;
+}
+
+bool input_replay_play_start(void)
+{
+    input_replay_stop();
+    if (!haveRecording) {
+        if (!input_replay_load(REPLAY_FILE_SD) && !input_replay_load(REPLAY_FILE_ROM)) {
+            debugf("[REPLAY] nothing to play\n");
+            return false;
+        }
+    }
+    pendingMode = REPLAY_PLAYING;
+    return true;
+}
+
+void input_replay_stop(void)
+{
+    pendingMode = REPLAY_OFF;
+    replay_end_run();
+}
+
+void input_replay_set_held(bool h)
+{
+    if (held && !h && mode != REPLAY_OFF) joypad_clear_pending();
+    held = h;
+}
+
+ReplayMode input_replay_get_mode(void)
+{
+    return mode;
+}
+
+int input_replay_get_frame(void)
+{
+    return frameIndex;
+}
+
+int input_replay_get_frame_count(void)
+{
+    return haveRecording ? (int)header.frameCount : 0;
+}
+
+bool input_replay_has_desynced(void)
+{
+    return desynced;
+}
+
+bool input_replay_save(const char *path)
+{
+    if (!haveRecording) return false;
+
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        debugf("[REPLAY] could not open %s for writing\n", path);
+        return false;
+    }
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1
+           && fwrite(frames, sizeof(ReplayFrame), header.frameCount, f) == header.frameCount;
+    fclose(f);
+    debugf("[REPLAY] %s %s (%lu frames)\n", ok ? "saved" : "failed to save", path, (unsigned long)header.frameCount);
+    return ok;
+}
+
+bool input_replay_load(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+
+    ReplayHeader h;
+    bool ok = fread(&h, sizeof(h), 1, f) == 1
+           && h.magic == REPLAY_MAGIC
+           && h.frameCount > 0 && h.frameCount <= REPLAY_MAX_FRAMES
+           && replay_alloc()
+           && fread(frames, sizeof(ReplayFrame), h.frameCount, f) == h.frameCount;
+    fclose(f);
+
+    if (!ok) {
+        debugf("[REPLAY] %s is not a valid replay\n", path);
+        return false;
+    }
+    header = h;
+    haveRecording = true;
+    debugf("[REPLAY] loaded %s (%lu frames)\n", path, (unsigned long)h.frameCount);
+    return true;
+}
+
+float input_replay_filter_delta(float dt)
+{
+    if (held) return dt;
+    if (pendingMode != REPLAY_OFF) replay_begin_run();
+    if (mode == REPLAY_OFF) return dt;
+
+    runRealTimeS += dt;
+    if (dt > runPeakDt) runPeakDt = dt;
+
+    if (mode == REPLAY_RECORDING) {
+        if (frameIndex >= REPLAY_MAX_FRAMES) {
+            replay_end_run();
+            return dt;
+        }
+        // Round through the stored unit so record and playback see the same value
+        float units = dt * (1000000.0f / REPLAY_DT_UNIT) + 0.5f;
+        if (units > 65535.0f) units = 65535.0f;
+        frames[frameIndex].dt = (uint16_t)units;
+        return (float)frames[frameIndex].dt * (REPLAY_DT_UNIT / 1000000.0f);
+    }
+
+    if (frameIndex >= (int)header.frameCount) {
+        replay_end_run();
+        return dt;
+    }
+    return (float)frames[frameIndex].dt * (REPLAY_DT_UNIT / 1000000.0f);
+}
+
+void input_replay_filter_inputs(joypad_inputs_t *inputs, joypad_buttons_t *pressed, joypad_buttons_t *released)
+{
+    if (mode == REPLAY_OFF || held) return;
+
+    ReplayFrame *fr = &frames[frameIndex];
+
+    if (mode == REPLAY_RECORDING) {
+        fr->held = inputs->btn.raw;
+        fr->pressed = pressed->raw;
+        fr->released = released->raw;
+        fr->stickX = inputs->stick_x;
+        fr->stickY = inputs->stick_y;
+        fr->cstickX = inputs->cstick_x;
+        fr->cstickY = inputs->cstick_y;
+        fr->analogL = inputs->analog_l;
+        fr->analogR = inputs->analog_r;
+        fr->rngCheck = replay_rng_check();
+    } else {
+        inputs->btn.raw = fr->held;
+        pressed->raw = fr->pressed;
+        released->raw = fr->released;
+        inputs->stick_x = fr->stickX;
+        inputs->stick_y = fr->stickY;
+        inputs->cstick_x = fr->cstickX;
+        inputs->cstick_y = fr->cstickY;
+        inputs->analog_l = fr->analogL;
+        inputs->analog_r = fr->analogR;
+
+        if (!desynced && fr->rngCheck != replay_rng_check()) {
+            desynced = true;
+            debugf("[REPLAY] RNG desync at frame %d\n", frameIndex);
+        }
+    }
+    frameIndex++;
+}
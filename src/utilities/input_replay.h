@@ -0,0 +1,52 @@
+#ifndef INPUT_REPLAY_H
+#define INPUT_REPLAY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <libdragon.h>
+
+// Deterministic input record / replay.
+// Recording logs per-frame joypad state, frame delta and an RNG checksum; the
+// RNGs (libc rand(), rand_custom_*, xorshift) are reseeded from the header when a
+// run starts so boss decisions repeat exactly. The checksum covers rand_custom_*
+// and the xorshift generator boss_ai draws from. Playback feeds the frames back
+// through joypad_update() / game_time_update().
+//
+// A run starts on the first frame after record/play is requested that isn't
+// held; callers restart the scene right before so both sides start from the
+// same state.
+
+#define REPLAY_MAX_FRAMES (30 * 60 * 6)          // 6 minutes at 30fps
+#define REPLAY_FILE_SD  "sd:/pandemonium.rpl"
+#define REPLAY_FILE_ROM "rom:/replay.rpl"
+
+typedef enum {
+    REPLAY_OFF,
+    REPLAY_RECORDING,
+    REPLAY_PLAYING,
+} ReplayMode;
+
+void input_replay_record_start(void);
+bool input_replay_play_start(void);    // false if there is nothing to play
+void input_replay_stop(void);
+
+// Frames that run no fixed steps (dev menu open) are held: they neither start a
+// run nor record or consume a frame, and button edges pressed while held don't
+// reach the first step after. Set before game_time_update() each frame.
+void input_replay_set_held(bool held);
+
+ReplayMode input_replay_get_mode(void);
+int input_replay_get_frame(void);
+int input_replay_get_frame_count(void);
+bool input_replay_has_desynced(void);
+
+// Recording is written to REPLAY_FILE_SD; playback falls back to the files
+// when nothing has been recorded this session.
+bool input_replay_save(const char *path);
+bool input_replay_load(const char *path);
+
+// Hooks (game_time_update / joypad_update)
+float input_replay_filter_delta(float dt);
+void input_replay_filter_inputs(joypad_inputs_t *inputs, joypad_buttons_t *pressed, joypad_buttons_t *released);
+
+#endif
@@ -2,11 +2,21 @@
 
 #include "joypad_utility.h"
 #include "game_time.h"
+#include "input_replay.h"
+#include "globals.h"
+#include "dev/bench.h"
 
 joypad_inputs_t joypad;
 joypad_buttons_t btn;
 joypad_buttons_t rel;
 
+// Button edges seen since the last fixed simulation step. Frames that run no
+// step keep their presses here so the next step still sees them exactly once.
+static uint16_t pendingPressed = 0;
+static uint16_t pendingReleased = 0;
+static joypad_buttons_t frameBtn;
+static joypad_buttons_t frameRel;
+
 static int rumbleFramesRemaining = 0;
 static double rumbleStopTimeS = 0.0;
 static bool rumbleEnabled = true;
@@ -17,6 +27,8 @@ void joypad_utility_init(void)
     joypad = joypad_get_inputs(JOYPAD_PORT_1);
     btn = joypad_get_buttons_pressed(JOYPAD_PORT_1);
     rel = joypad_get_buttons_released(JOYPAD_PORT_1);
+    pendingPressed = 0;
+    pendingReleased = 0;
     rumbleFramesRemaining = 0;
     rumbleStopTimeS = 0.0;
     rumbleEnabled = true;
@@ -35,6 +47,17 @@ void joypad_update(void)
     if(joypad.stick_x < 10 && joypad.stick_x > -10)joypad.stick_x = 0;
     if(joypad.stick_y < 10 && joypad.stick_y > -10)joypad.stick_y = 0;
 
+    // Record this frame, or replace it with the recorded one during playback
+    input_replay_filter_inputs(&joypad, &btn, &rel);
+
+    // Benchmark builds drive the knight with a bot instead of the pad
+    if (BENCH_MODE) bench_filter_inputs(&joypad, &btn, &rel);
+
+    frameBtn = btn;
+    frameRel = rel;
+    pendingPressed  |= btn.raw;
+    pendingReleased |= rel.raw;
+
     bool shouldRumble = (rumbleFramesRemaining > 0) && (nowS < rumbleStopTimeS) && rumbleEnabled;
 
     if (!shouldRumble) {
@@ -51,6 +74,26 @@ void joypad_update(void)
     }
 }
 
+void joypad_fixed_step_begin(void)
+{
+    btn.raw = pendingPressed;
+    rel.raw = pendingReleased;
+    pendingPressed = 0;
+    pendingReleased = 0;
+}
+
+void joypad_fixed_step_end(void)
+{
+    btn = frameBtn;
+    rel = frameRel;
+}
+
+void joypad_clear_pending(void)
+{
+    pendingPressed = 0;
+    pendingReleased = 0;
+}
+
 void joypad_rumble_pulse_seconds(float seconds)
 {
     if (seconds <= 0.0f) return;
@@ -11,6 +11,12 @@ extern joypad_buttons_t rel;
 // Function prototype for joypad update
 void joypad_utility_init(void);
 void joypad_update(void);
+// Bracket each fixed simulation step: begin hands the step the button edges
+// accumulated since the previous step, end restores this frame's edges.
+void joypad_fixed_step_begin(void);
+void joypad_fixed_step_end(void);
+// Drops edges no step has consumed yet (replay runs start from a clean slate)
+void joypad_clear_pending(void);
 void joypad_rumble_pulse_seconds(float seconds);
 void joypad_rumble_stop(void);
 void joypad_set_rumble_enabled(bool enabled);
@@ -14,6 +14,8 @@
 #include <sprite.h>
 #include <rspq.h>
 
+#include "quality_governor.h"
+
 // ============================================================
 // CONFIG
 // ============================================================
@@ -403,6 +405,17 @@ void path_ribbon_draw_crack(const PathRibbon* pr) {
     int points = pr_effective_point_count(pr);
     if (points < 2) return;
 
+    // The crack is pure decoration, so under load the quality governor thins
+    // it to every Nth point (ends kept). The wall always uses every point so
+    // it matches its collision.
+    const int budget = quality_budgets()->ribbonCrackPoints;
+    if (budget < 2) return;
+    const int stride = (points + budget - 1) / budget;
+    int src[PR_MAX_POINTS_DRAW];
+    int n = 0;
+    for (int i = 0; i < points; i += stride) src[n++] = i;
+    if (src[n - 1] != points - 1) src[n++] = points - 1;
+
     path_ribbon_ensure_draw_buffers();
     path_ribbon_ensure_id_mat();
     if (!s_pr_id_mat_fp) return;
@@ -435,16 +448,17 @@ void path_ribbon_draw_crack(const PathRibbon* pr) {
     const uint16_t norm = t3d_vert_pack_normal(&nUp);
 
     float totalLen = 0.0f;
-    for (int i = 1; i < points; i++) {
-        float dx = pr->pts[i][0] - pr->pts[i-1][0];
-        float dz = pr->pts[i][2] - pr->pts[i-1][2];
+    for (int j = 1; j < n; j++) {
+        float dx = pr->pts[src[j]][0] - pr->pts[src[j-1]][0];
+        float dz = pr->pts[src[j]][2] - pr->pts[src[j-1]][2];
         totalLen += sqrtf(dx*dx + dz*dz);
     }
     if (totalLen < 0.001f) totalLen = 0.001f;
 
     float accLen = 0.0f;
 
-    for (int i = 0; i < points; i++) {
+    for (int j = 0; j < n; j++) {
+        const int i = src[j];
         float t01 = pr_clampf(accLen / totalLen, 0.0f, 1.0f);
 
         float w = pr->crack_w_start + (pr->crack_w_end - pr->crack_w_start) * t01;
@@ -461,12 +475,12 @@ void path_ribbon_draw_crack(const PathRibbon* pr) {
         if (w < 0.0f) w = 0.0f;
 
         float tx, tz;
-        if (i < points - 1) {
-            tx = pr->pts[i+1][0] - pr->pts[i][0];
-            tz = pr->pts[i+1][2] - pr->pts[i][2];
+        if (j < n - 1) {
+            tx = pr->pts[src[j+1]][0] - pr->pts[i][0];
+            tz = pr->pts[src[j+1]][2] - pr->pts[i][2];
         } else {
-            tx = pr->pts[i][0] - pr->pts[i-1][0];
-            tz = pr->pts[i][2] - pr->pts[i-1][2];
+            tx = pr->pts[i][0] - pr->pts[src[j-1]][0];
+            tz = pr->pts[i][2] - pr->pts[src[j-1]][2];
         }
 
         float len = sqrtf(tx*tx + tz*tz);
@@ -489,23 +503,23 @@ void path_ribbon_draw_crack(const PathRibbon* pr) {
 
         PRColor c = pr_color_mul_alpha(pr->crack_color, a_mul);
 
-        int vL = i*2 + 0;
-        int vR = i*2 + 1;
+        int vL = j*2 + 0;
+        int vR = j*2 + 1;
 
         pr_write_vert(vb, vL, pr_f2s16(x0), pr_f2s16(y), pr_f2s16(z0), 0, 0, c, norm);
         pr_write_vert(vb, vR, pr_f2s16(x1), pr_f2s16(y), pr_f2s16(z1), (int16_t)(1*32), 0, c, norm);
 
-        if (i < points - 1) {
-            float dx = pr->pts[i+1][0] - pr->pts[i][0];
-            float dz = pr->pts[i+1][2] - pr->pts[i][2];
+        if (j < n - 1) {
+            float dx = pr->pts[src[j+1]][0] - pr->pts[i][0];
+            float dz = pr->pts[src[j+1]][2] - pr->pts[i][2];
             accLen += sqrtf(dx*dx + dz*dz);
         }
     }
 
-    const uint32_t vcount = (uint32_t)(points * 2);
+    const uint32_t vcount = (uint32_t)(n * 2);
     t3d_vert_load(vb, 0, vcount);
 
-    int segs = points - 1;
+    int segs = n - 1;
     for (int i = 0; i < segs; i++) {
         uint32_t l0 = (uint32_t)(i*2 + 0);
         uint32_t r0 = (uint32_t)(i*2 + 1);
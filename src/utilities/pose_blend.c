@@ -0,0 +1,233 @@
+#include "pose_blend.h"
+
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+// Weighted sums for the blend in progress
+static T3DSkeleton *blendOut = NULL;
+static int blendCount = 0;
+static float blendWeight = 0.0f;
+static float accPos[POSE_MAX_BONES][3];
+static float accRot[POSE_MAX_BONES][4];
+static float accScl[POSE_MAX_BONES][3];
+
+static inline int pose_bone_count(const T3DSkeleton *skeleton)
+{
+    int n = skeleton->skeletonRef->boneCount;
+    return n > POSE_MAX_BONES ? POSE_MAX_BONES : n;
+}
+
+#define POSE_UNIT_SCALE_EPS 1e-4f
+#define POSE_QUAT_RANGE 0.70710678f  // |smallest three| <= 1/sqrt(2)
+
+// Per-axis range of one vector per bone -> origin and 16-bit step
+static void pose_range(const T3DBone *bones, int count, size_t offset, float origin[3], float step[3])
+{
+    float mn[3] = { INFINITY, INFINITY, INFINITY };
+    float mx[3] = { -INFINITY, -INFINITY, -INFINITY };
+    for (int i = 0; i < count; i++) {
+        const float *v = ((const T3DVec3 *)((const char *)&bones[i] + offset))->v;
+        for (int k = 0; k < 3; k++) {
+            mn[k] = fminf(mn[k], v[k]);
+            mx[k] = fmaxf(mx[k], v[k]);
+        }
+    }
+    for (int k = 0; k < 3; k++) {
+        origin[k] = mn[k];
+        step[k] = (mx[k] - mn[k]) / 65535.0f;
+    }
+}
+
+// invStep is 1 / step, or 0 for a constant axis
+static inline void pose_quantize_vec3(uint16_t out[3], const T3DVec3 *v, const float origin[3], const float invStep[3])
+{
+    for (int k = 0; k < 3; k++) {
+        float q = (v->v[k] - origin[k]) * invStep[k] + 0.5f;
+        out[k] = (uint16_t)fminf(q, 65535.0f);
+    }
+}
+
+static inline void pose_inv_step(float invStep[3], const float step[3])
+{
+    for (int k = 0; k < 3; k++) invStep[k] = step[k] > 0.0f ? 1.0f / step[k] : 0.0f;
+}
+
+static inline void pose_dequantize_vec3(T3DVec3 *v, const uint16_t in[3], const float origin[3], const float step[3])
+{
+    for (int k = 0; k < 3; k++) v->v[k] = origin[k] + (float)in[k] * step[k];
+}
+
+static inline void pose_quantize_quat(int16_t out[3], const T3DQuat *q)
+{
+    int big = 0;
+    for (int k = 1; k < 4; k++) {
+        if (fabsf(q->v[k]) > fabsf(q->v[big])) big = k;
+    }
+    float sign = q->v[big] < 0.0f ? -1.0f : 1.0f;
+
+    int n = 0;
+    for (int k = 0; k < 4; k++) {
+        if (k == big) continue;
+        float c = q->v[k] * sign / POSE_QUAT_RANGE;
+        c = fminf(1.0f, fmaxf(-1.0f, c));
+        out[n++] = (int16_t)lrintf(c * 32767.0f);
+    }
+    out[0] = (int16_t)((out[0] & ~1) | (big & 1));
+    out[1] = (int16_t)((out[1] & ~1) | (big >> 1));
+}
+
+static inline void pose_dequantize_quat(T3DQuat *q, const int16_t in[3])
+{
+    int big = (in[0] & 1) | ((in[1] & 1) << 1);
+    float c[3] = {
+        (float)(in[0] & ~1) * (POSE_QUAT_RANGE / 32767.0f),
+        (float)(in[1] & ~1) * (POSE_QUAT_RANGE / 32767.0f),
+        (float)in[2] * (POSE_QUAT_RANGE / 32767.0f),
+    };
+
+    int n = 0;
+    for (int k = 0; k < 4; k++) {
+        if (k != big) q->v[k] = c[n++];
+    }
+    q->v[big] = sqrtf(fmaxf(0.0f, 1.0f - c[0] * c[0] - c[1] * c[1] - c[2] * c[2]));
+}
+
+static inline void pose_decode_bone(const AnimPose *pose, int i, T3DVec3 *p, T3DQuat *q, T3DVec3 *s)
+{
+    pose_dequantize_vec3(p, pose->pos[i], pose->posOrigin, pose->posStep);
+    pose_dequantize_quat(q, pose->rot[i]);
+    if (pose->flags & ANIM_POSE_UNIT_SCALE) {
+        *s = (T3DVec3){{ 1.0f, 1.0f, 1.0f }};
+    } else {
+        pose_dequantize_vec3(s, pose->scl[i], pose->sclOrigin, pose->sclStep);
+    }
+}
+
+void anim_pose_capture(AnimPose *pose, const T3DSkeleton *skeleton)
+{
+    if (!pose || !skeleton || !skeleton->bones || !skeleton->skeletonRef) return;
+
+    const T3DBone *bones = skeleton->bones;
+    int n = pose_bone_count(skeleton);
+    pose->count = (uint8_t)n;
+    pose->flags = ANIM_POSE_UNIT_SCALE;
+
+    pose_range(bones, n, offsetof(T3DBone, position), pose->posOrigin, pose->posStep);
+    for (int i = 0; i < n; i++) {
+        for (int k = 0; k < 3; k++) {
+            if (fabsf(bones[i].scale.v[k] - 1.0f) > POSE_UNIT_SCALE_EPS) pose->flags = 0;
+        }
+    }
+    if (pose->flags & ANIM_POSE_UNIT_SCALE) {
+        for (int k = 0; k < 3; k++) {
+            pose->sclOrigin[k] = 1.0f;
+            pose->sclStep[k] = 0.0f;
+        }
+    } else {
+        pose_range(bones, n, offsetof(T3DBone, scale), pose->sclOrigin, pose->sclStep);
+    }
+
+    float posInv[3], sclInv[3];
+    pose_inv_step(posInv, pose->posStep);
+    pose_inv_step(sclInv, pose->sclStep);
+    for (int i = 0; i < n; i++) {
+        pose_quantize_vec3(pose->pos[i], &bones[i].position, pose->posOrigin, posInv);
+        pose_quantize_quat(pose->rot[i], &bones[i].rotation);
+        if (!(pose->flags & ANIM_POSE_UNIT_SCALE)) {
+            pose_quantize_vec3(pose->scl[i], &bones[i].scale, pose->sclOrigin, sclInv);
+        }
+    }
+}
+
+void anim_pose_apply(const AnimPose *pose, T3DSkeleton *skeleton)
+{
+    if (!pose || !skeleton || !skeleton->bones || !skeleton->skeletonRef) return;
+
+    int n = pose_bone_count(skeleton);
+    if (n > pose->count) n = pose->count;
+    for (int i = 0; i < n; i++) {
+        T3DBone *b = &skeleton->bones[i];
+        pose_decode_bone(pose, i, &b->position, &b->rotation, &b->scale);
+        b->hasChanged = true;
+    }
+}
+
+// Quaternions are summed on the accumulator's hemisphere (q and -q are the
+// same rotation), so the normalized sum is the N-way nlerp.
+static inline void pose_accumulate(int i, const T3DVec3 *p, const T3DQuat *q, const T3DVec3 *s, float w)
+{
+    float *r = accRot[i];
+    float dot = r[0] * q->v[0] + r[1] * q->v[1] + r[2] * q->v[2] + r[3] * q->v[3];
+    float wq = dot < 0.0f ? -w : w;
+    for (int k = 0; k < 4; k++) r[k] += q->v[k] * wq;
+    for (int k = 0; k < 3; k++) {
+        accPos[i][k] += p->v[k] * w;
+        accScl[i][k] += s->v[k] * w;
+    }
+}
+
+void pose_blend_begin(T3DSkeleton *out)
+{
+    blendOut = (out && out->bones && out->skeletonRef) ? out : NULL;
+    blendCount = blendOut ? pose_bone_count(blendOut) : 0;
+    blendWeight = 0.0f;
+    memset(accPos, 0, sizeof(accPos[0]) * blendCount);
+    memset(accRot, 0, sizeof(accRot[0]) * blendCount);
+    memset(accScl, 0, sizeof(accScl[0]) * blendCount);
+}
+
+void pose_blend_clip(T3DAnim *anim, float dt, float weight)
+{
+    if (!anim) return;
+    t3d_anim_update(anim, dt);
+    if (!blendOut || weight <= 0.0f) return;
+
+    for (int i = 0; i < blendCount; i++) {
+        const T3DBone *b = &blendOut->bones[i];
+        pose_accumulate(i, &b->position, &b->rotation, &b->scale, weight);
+    }
+    blendWeight += weight;
+}
+
+void pose_blend_pose(const AnimPose *pose, float weight)
+{
+    if (!pose || !blendOut || weight <= 0.0f) return;
+
+    int n = blendCount < pose->count ? blendCount : pose->count;
+    for (int i = 0; i < n; i++) {
+        T3DVec3 p, s;
+        T3DQuat q;
+        pose_decode_bone(pose, i, &p, &q, &s);
+        pose_accumulate(i, &p, &q, &s, weight);
+    }
+    // Bones the snapshot doesn't cover take this weight from the skeleton
+    for (int i = n; i < blendCount; i++) {
+        const T3DBone *b = &blendOut->bones[i];
+        pose_accumulate(i, &b->position, &b->rotation, &b->scale, weight);
+    }
+    blendWeight += weight;
+}
+
+bool pose_blend_end(void)
+{
+    T3DSkeleton *out = blendOut;
+    blendOut = NULL;
+    if (!out || blendWeight <= 0.0f) return false;
+
+    for (int i = 0; i < blendCount; i++) {
+        T3DBone *b = &out->bones[i];
+        for (int k = 0; k < 3; k++) {
+            b->position.v[k] = accPos[i][k] / blendWeight;
+            b->scale.v[k] = accScl[i][k] / blendWeight;
+        }
+        const float *r = accRot[i];
+        float len2 = r[0] * r[0] + r[1] * r[1] + r[2] * r[2] + r[3] * r[3];
+        if (len2 > 1e-12f) {
+            float inv = 1.0f / sqrtf(len2);
+            for (int k = 0; k < 4; k++) b->rotation.v[k] = r[k] * inv;
+        }
+        b->hasChanged = true;
+    }
+    return true;
+}
@@ -0,0 +1,59 @@
+#ifndef POSE_BLEND_H
+#define POSE_BLEND_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <t3d/t3d.h>
+#include <t3d/t3dskeleton.h>
+#include <t3d/t3danim.h>
+
+// N-way pose blending into one output skeleton. Every input clip is attached
+// to the output skeleton itself and sampled there in turn; its bones are
+// folded into a shared weighted accumulator and the blended pose is written
+// back once at the end. No per-actor blend skeletons and no pose copies
+// between passes:
+//   pose_blend_begin(skeleton);
+//   pose_blend_clip(walk, dt, 1.0f - wRun);
+//   pose_blend_clip(run, 0.0f, wRun);
+//   pose_blend_pose(&fromPose, 1.0f - fade);   // crossfade snapshot
+//   pose_blend_end();
+// Bones a clip doesn't key keep the value the previous input left on the
+// skeleton, as if the clip had been primed from it. One blend at a time.
+
+#define POSE_MAX_BONES 64   // bones past this are left as the last clip sampled them
+
+#define ANIM_POSE_UNIT_SCALE 0x01  // every bone at scale 1: scl is neither written nor read
+
+// Bone-local pose detached from any skeleton (crossfade "from" snapshots),
+// quantized; capture and blend touch 12 bytes a bone (18 when the pose has
+// non-unit scale) instead of 40:
+//  - positions and scales: 16 bits per axis across the range the captured
+//    pose spans, so the step shrinks with the rig
+//  - rotations: smallest three, the largest component dropped and rebuilt
+//    (it is kept positive); its index sits in the low bits of rot[0] and rot[1]
+typedef struct {
+    float posOrigin[3];   // min corner of the captured positions
+    float posStep[3];     // one quantization step per axis (0: axis is constant)
+    float sclOrigin[3];
+    float sclStep[3];
+    uint8_t count;
+    uint8_t flags;
+    uint16_t pos[POSE_MAX_BONES][3];
+    int16_t rot[POSE_MAX_BONES][3];
+    uint16_t scl[POSE_MAX_BONES][3];
+} AnimPose;
+
+void anim_pose_capture(AnimPose *pose, const T3DSkeleton *skeleton);
+// Overwrites the skeleton's bones with the pose (and flags them changed)
+void anim_pose_apply(const AnimPose *pose, T3DSkeleton *skeleton);
+
+void pose_blend_begin(T3DSkeleton *out);
+// Advances anim (attached to the output skeleton) by dt and adds its pose.
+// Clips are always advanced, so a weight-0 clip stays in phase.
+void pose_blend_clip(T3DAnim *anim, float dt, float weight);
+void pose_blend_pose(const AnimPose *pose, float weight);
+// Normalized weighted result into the output skeleton. Returns false (and
+// leaves the skeleton as the last input left it) when no input had weight.
+bool pose_blend_end(void);
+
+#endif
@@ -0,0 +1,206 @@
+#include "render_scale_utility.h"
+
+#include <libdragon.h>
+
+#include "globals.h"
+#include "game_time.h"
+
+// RDP command/status registers. The clock and pipe-busy counters tick at the
+// RCP clock and are cleared by writing the matching bits to DPC_STATUS.
+#ifndef DPC_STATUS_REG
+#define DPC_STATUS_REG   ((volatile uint32_t *)0xA410000C)
+#define DPC_CLOCK_REG    ((volatile uint32_t *)0xA4100010)
+#define DPC_PIPEBUSY_REG ((volatile uint32_t *)0xA4100018)
+#endif
+#define DPC_CLR_PIPE_CTR  0x080
+#define DPC_CLR_CMD_CTR   0x100
+#define DPC_CLR_CLOCK_CTR 0x200
+#define DPC_COUNTER_MASK  0x00FFFFFF // 24-bit counters
+
+// Same shape as quality_governor.c: drop quickly, recover slowly. Recovery
+// predicts the busy time at the next larger size from the pixel ratio so it
+// doesn't bounce straight back down.
+#define RS_BUDGET_MS        FIXED_TIMESTEP_MS
+#define RS_DEGRADE_MS       (RS_BUDGET_MS * 0.90f)
+#define RS_RECOVER_MS       (RS_BUDGET_MS * 0.80f)
+#define RS_DEGRADE_HOLD_S   0.25f
+#define RS_RECOVER_HOLD_S   2.0f
+#define RS_SETTLE_S         0.5f
+#define RS_SMOOTHING        0.2f
+#define RS_SAMPLE_MAX_S     0.1f // longer frames can wrap the 24-bit counters
+
+static const int LEVEL_SIZE[RENDER_SCALE_COUNT][2] = {
+    [RENDER_SCALE_FULL] = { SCREEN_WIDTH, SCREEN_HEIGHT },
+    [RENDER_SCALE_HIGH] = { 288, 216 },
+    [RENDER_SCALE_LOW]  = { 256, 192 },
+};
+
+static RenderScaleLevel level = RENDER_SCALE_FULL;
+static float busyMs = 0.0f;
+static bool busyValid = false;
+static float overTimer = 0.0f;
+static float underTimer = 0.0f;
+static float settleTimer = 0.0f;
+
+// One color target sized for the largest scaled level. It is SCREEN_WIDTH wide
+// so its stride matches the display Z-buffer, which the scaled pass shares, and
+// it takes the display's color depth (the display can be re-inited at 16 or 32
+// bpp), so a scaled frame keeps the precision of a native one.
+static surface_t scaledTarget;
+static tex_format_t scaledFormat = FMT_NONE;
+static surface_t scaledColor;
+static surface_t scaledDepth;
+static bool attached = false;
+
+static float level_area(RenderScaleLevel l)
+{
+    return (float)(LEVEL_SIZE[l][0] * LEVEL_SIZE[l][1]);
+}
+
+static void set_level(RenderScaleLevel next)
+{
+    if (next == level) return;
+    if (DEV_MODE) {
+        debugf("[RENDER SCALE] %dx%d -> %dx%d (%.1f ms rdp)\n",
+            LEVEL_SIZE[level][0], LEVEL_SIZE[level][1],
+            LEVEL_SIZE[next][0], LEVEL_SIZE[next][1], busyMs);
+    }
+    level = next;
+    overTimer = 0.0f;
+    underTimer = 0.0f;
+    settleTimer = RS_SETTLE_S;
+}
+
+static void reset_counters(void)
+{
+    *DPC_STATUS_REG = DPC_CLR_PIPE_CTR | DPC_CLR_CMD_CTR | DPC_CLR_CLOCK_CTR;
+}
+
+void render_scale_reset(void)
+{
+    level = RENDER_SCALE_FULL;
+    busyMs = 0.0f;
+    busyValid = false;
+    overTimer = 0.0f;
+    underTimer = 0.0f;
+    settleTimer = 0.0f;
+    reset_counters();
+}
+
+void render_scale_update(void)
+{
+    // The benchmark measures the scene at native resolution
+    if (!DYNAMIC_RESOLUTION || BENCH_MODE) return;
+
+    uint32_t pipeTicks = *DPC_PIPEBUSY_REG & DPC_COUNTER_MASK;
+    reset_counters();
+
+    if (frameDeltaTime <= 0.0f || frameDeltaTime > RS_SAMPLE_MAX_S) return;
+
+    float ms = (float)pipeTicks * (1000.0f / (float)RCP_FREQUENCY);
+    if (!busyValid) {
+        busyMs = ms;
+        busyValid = true;
+    } else {
+        busyMs += (ms - busyMs) * RS_SMOOTHING;
+    }
+
+    if (settleTimer > 0.0f) {
+        settleTimer -= frameDeltaTime;
+        return;
+    }
+
+    float predictedMs = busyMs;
+    if (level > RENDER_SCALE_FULL) {
+        predictedMs = busyMs * level_area((RenderScaleLevel)(level - 1)) / level_area(level);
+    }
+
+    if (busyMs > RS_DEGRADE_MS) {
+        overTimer += frameDeltaTime;
+        underTimer = 0.0f;
+    } else if (predictedMs < RS_RECOVER_MS) {
+        underTimer += frameDeltaTime;
+        overTimer = 0.0f;
+    } else {
+        overTimer = 0.0f;
+        underTimer = 0.0f;
+    }
+
+    if (overTimer >= RS_DEGRADE_HOLD_S && level < RENDER_SCALE_LOW) {
+        set_level((RenderScaleLevel)(level + 1));
+    } else if (underTimer >= RS_RECOVER_HOLD_S && level > RENDER_SCALE_FULL) {
+        set_level((RenderScaleLevel)(level - 1));
+    }
+}
+
+bool render_scale_begin(T3DViewport *viewport)
+{
+    attached = false;
+    if (level == RENDER_SCALE_FULL || !viewport) return false;
+
+    tex_format_t format = display_get_bitdepth() == 4 ? FMT_RGBA32 : FMT_RGBA16;
+    if (scaledTarget.buffer && scaledFormat != format) {
+        rspq_wait(); // only after a display re-init; the last blit may still read it
+        surface_free(&scaledTarget);
+    }
+    if (!scaledTarget.buffer) {
+        scaledTarget = surface_alloc(format, SCREEN_WIDTH, LEVEL_SIZE[RENDER_SCALE_HIGH][1]);
+        if (!scaledTarget.buffer) return false;
+        scaledFormat = format;
+    }
+
+    const int w = LEVEL_SIZE[level][0];
+    const int h = LEVEL_SIZE[level][1];
+    scaledColor = surface_make_sub(&scaledTarget, 0, 0, w, h);
+    scaledDepth = surface_make_sub(display_get_zbuf(), 0, 0, w, h);
+
+    // Nested attach: rdpq_detach() in render_scale_end() returns to the frame target
+    rdpq_attach(&scaledColor, &scaledDepth);
+    t3d_viewport_set_area(viewport, 0, 0, w, h);
+    attached = true;
+    return true;
+}
+
+void render_scale_end(T3DViewport *viewport)
+{
+    if (!attached) return;
+    attached = false;
+
+    rdpq_detach();
+
+    const int w = LEVEL_SIZE[level][0];
+    const int h = LEVEL_SIZE[level][1];
+
+    rdpq_sync_pipe();
+    rdpq_set_mode_standard();
+    rdpq_mode_filter(FILTER_BILINEAR);
+    if (!DITHER_ENABLED) {
+        rdpq_mode_dithering(DITHER_NONE_BAYER);
+    }
+    rdpq_tex_blit(&scaledColor, 0, 0, &(rdpq_blitparms_t){
+        .scale_x = (float)SCREEN_WIDTH / (float)w,
+        .scale_y = (float)SCREEN_HEIGHT / (float)h,
+        .filtering = true,
+    });
+    rdpq_mode_filter(FILTER_POINT);
+
+    // Projection math for the 2D pass (prompts, debug shapes) is back in native pixels
+    t3d_viewport_set_area(viewport, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+    t3d_viewport_attach(viewport);
+}
+
+RenderScaleLevel render_scale_get_level(void)
+{
+    return level;
+}
+
+float render_scale_factor(void)
+{
+    if (!attached) return 1.0f;
+    return (float)LEVEL_SIZE[level][0] / (float)SCREEN_WIDTH;
+}
+
+float render_scale_get_rdp_busy_ms(void)
+{
+    return busyMs;
+}
@@ -0,0 +1,38 @@
+#ifndef RENDER_SCALE_UTILITY_H
+#define RENDER_SCALE_UTILITY_H
+
+#include <stdbool.h>
+#include <t3d/t3d.h>
+
+// Dynamic resolution for the gameplay 3D pass.
+// The 3D world renders into a smaller offscreen target when the RDP runs over
+// budget and is upscaled to the display before the 2D HUD, which always stays
+// at native resolution. Usage inside scene_draw:
+//   bool scaled = render_scale_begin(viewport);
+//   ... 3D + depth-tested screen-space effects ...
+//   if (scaled) render_scale_end(viewport);
+
+typedef enum {
+    RENDER_SCALE_FULL,   // 320x240, draws straight to the frame target
+    RENDER_SCALE_HIGH,   // 288x216
+    RENDER_SCALE_LOW,    // 256x192
+    RENDER_SCALE_COUNT
+} RenderScaleLevel;
+
+// Once per frame, before drawing: sample RDP busy time and pick the scale.
+void render_scale_update(void);
+void render_scale_reset(void);
+
+// Redirect rendering to the scaled target (no-op at full scale).
+// Returns true when render_scale_end() must be called.
+bool render_scale_begin(T3DViewport *viewport);
+// Upscale the 3D pass into the frame target and restore the viewport.
+void render_scale_end(T3DViewport *viewport);
+
+RenderScaleLevel render_scale_get_level(void);
+// Rendered width / native width while inside the scaled pass, else 1.0.
+// For screen-space effects sized in pixels.
+float render_scale_factor(void);
+float render_scale_get_rdp_busy_ms(void);
+
+#endif
@@ -1,4 +1,5 @@
 #include "simple_collision_utility.h"
+#include <assert.h>
 #include <math.h>
 
 /* ------------------------------------------------------------------
@@ -52,28 +53,24 @@ static inline float f_clamp(float x, float lo, float hi)
  * OBB
  * ------------------------------------------------------------------ */
 
-// Solve circle vs OBB in XZ, returning push + normal in *WORLD* space.
+// Solve circle vs box in XZ, returning push + normal in *WORLD* space.
+// The box is given by its XZ center, XZ half extents and the cos/sin of its
+// yaw, so callers with a baked rotation frame skip the trig.
 // Returns true if overlapping.
-static bool scu_circle_vs_obb_push_xz_f(
+static bool circle_vs_box_push_xz(
     float cx, float cz, float r,
-    const SCU_OBB *o,
+    float bx, float bz, float hx, float hz, float c, float s,
     float push_out[3],
     float n_out[3]
 )
 {
     // Rotate world -> OBB local (around Y): local = R(-yaw) * (p - center)
-    float dx = cx - o->center[0];
-    float dz = cz - o->center[2];
-
-    float c = cosf(o->yaw);
-    float s = sinf(o->yaw);
+    float dx = cx - bx;
+    float dz = cz - bz;
 
     float lx =  c * dx + s * dz;
     float lz = -s * dx + c * dz;
 
-    float hx = o->half[0];
-    float hz = o->half[2];
-
     // Closest point on local AABB to circle center
     float qx = f_clamp(lx, -hx, hx);
     float qz = f_clamp(lz, -hz, hz);
@@ -149,6 +146,17 @@ static bool scu_circle_vs_obb_push_xz_f(
     return true;
 }
 
+static bool scu_circle_vs_obb_push_xz_f(
+    float cx, float cz, float r,
+    const SCU_OBB *o,
+    float push_out[3],
+    float n_out[3]
+)
+{
+    return circle_vs_box_push_xz(cx, cz, r, o->center[0], o->center[2], o->half[0], o->half[2],
+        cosf(o->yaw), sinf(o->yaw), push_out, n_out);
+}
+
 // Capsule vs OBB (XZ): Y overlap check + circle-vs-OBB solve in XZ.
 // Assumption: your capsule is vertical (capA/capB share XZ), which matches your character collider.
 bool scu_capsule_vs_obb_push_xz_f(
@@ -179,6 +187,265 @@ bool scu_capsule_vs_obb_push_xz_f(
     return scu_circle_vs_obb_push_xz_f(cx, cz, cap_radius, obb, push_out, n_out);
 }
 
+// Swept circle vs OBB in XZ. The circle sweeps against the box grown by r
+// (Minkowski sum: a rounded rectangle), i.e. a ray test. The ray first hits
+// the grown box; if that entry point lies in a corner region, the rounded
+// corner (a circle of radius r around the box corner) decides instead.
+static bool circle_sweep_box_xz(
+    float cx, float cz, float r,
+    float move_x, float move_z,
+    float bx, float bz, float hx, float hz, float c, float s,
+    float *toi_out,
+    float n_out[3]
+)
+{
+    // Already touching: only block motion that goes further in.
+    float push[3], n[3];
+    if (circle_vs_box_push_xz(cx, cz, r, bx, bz, hx, hz, c, s, push, n)) {
+        if (move_x * n[0] + move_z * n[2] >= 0.0f) return false;
+        *toi_out = 0.0f;
+        n_out[0] = n[0]; n_out[1] = 0.0f; n_out[2] = n[2];
+        return true;
+    }
+
+    float dx = cx - bx;
+    float dz = cz - bz;
+
+    float l[2] = {  c * dx + s * dz, -s * dx + c * dz };
+    float m[2] = {  c * move_x + s * move_z, -s * move_x + c * move_z };
+    float h[2] = { hx, hz };
+
+    // Slab test against the box grown by r
+    float tmin = 0.0f, tmax = 1.0f;
+    int axis = -1;
+    for (int k = 0; k < 2; k++) {
+        float e = h[k] + r;
+        if (fabsf(m[k]) < 1e-6f) {
+            if (l[k] < -e || l[k] > e) return false;
+            continue;
+        }
+        float inv = 1.0f / m[k];
+        float t1 = (-e - l[k]) * inv;
+        float t2 = ( e - l[k]) * inv;
+        if (t1 > t2) { float tmp = t1; t1 = t2; t2 = tmp; }
+        if (t1 > tmin) { tmin = t1; axis = k; }
+        if (t2 < tmax) tmax = t2;
+        if (tmin > tmax) return false;
+    }
+
+    float px = l[0] + m[0] * tmin;
+    float pz = l[1] + m[1] * tmin;
+    float nlx = 0.0f, nlz = 0.0f;
+    float toi = tmin;
+
+    if (axis >= 0 && (fabsf(axis == 0 ? pz : px) <= h[axis == 0 ? 1 : 0])) {
+        // Entered through a flat face
+        if (axis == 0) nlx = (m[0] > 0.0f) ? -1.0f : 1.0f;
+        else           nlz = (m[1] > 0.0f) ? -1.0f : 1.0f;
+    } else {
+        // Corner region (or starting inside one): ray vs the corner circle
+        float kx = (px >= 0.0f) ? h[0] : -h[0];
+        float kz = (pz >= 0.0f) ? h[1] : -h[1];
+        float ox = l[0] - kx;
+        float oz = l[1] - kz;
+        float a = m[0] * m[0] + m[1] * m[1];
+        float b = ox * m[0] + oz * m[1];
+        float cc = ox * ox + oz * oz - r * r;
+        float disc = b * b - a * cc;
+        if (a <= 0.0f || disc < 0.0f) return false;
+        toi = (-b - sqrtf(disc)) / a;
+        if (toi < 0.0f || toi > 1.0f) return false;
+        nlx = (ox + m[0] * toi) / r;
+        nlz = (oz + m[1] * toi) / r;
+    }
+
+    *toi_out = toi;
+    n_out[0] = c * nlx - s * nlz;
+    n_out[1] = 0.0f;
+    n_out[2] = s * nlx + c * nlz;
+    return true;
+}
+
+static bool scu_circle_sweep_obb_xz_f(
+    float cx, float cz, float r,
+    float move_x, float move_z,
+    const SCU_OBB *o,
+    float *toi_out,
+    float n_out[3]
+)
+{
+    return circle_sweep_box_xz(cx, cz, r, move_x, move_z, o->center[0], o->center[2], o->half[0], o->half[2],
+        cosf(o->yaw), sinf(o->yaw), toi_out, n_out);
+}
+
+bool scu_capsule_sweep_obb_xz_f(
+    const float cap_a[3], const float cap_b[3], float cap_radius,
+    float move_x, float move_z,
+    const SCU_OBB *obb,
+    float *toi_out,
+    float n_out[3]
+)
+{
+    // Motion is XZ only, so the Y gate is the same as for the static test
+    float capMinY = fminf(cap_a[1], cap_b[1]) - cap_radius;
+    float capMaxY = fmaxf(cap_a[1], cap_b[1]) + cap_radius;
+
+    float obbMinY = obb->center[1] - obb->half[1];
+    float obbMaxY = obb->center[1] + obb->half[1];
+
+    if (capMaxY < obbMinY || capMinY > obbMaxY) return false;
+
+    float cx = 0.5f * (cap_a[0] + cap_b[0]);
+    float cz = 0.5f * (cap_a[2] + cap_b[2]);
+
+    return scu_circle_sweep_obb_xz_f(cx, cz, cap_radius, move_x, move_z, obb, toi_out, n_out);
+}
+
+// Segment vs OBB: slab test in box local space (yaw only, so Y is its own slab).
+bool scu_segment_vs_obb_f(
+    const float p0[3], const float p1[3],
+    const SCU_OBB *obb,
+    float *t_out,
+    float n_out[3]
+)
+{
+    float c = cosf(obb->yaw);
+    float s = sinf(obb->yaw);
+
+    float dx = p0[0] - obb->center[0];
+    float dz = p0[2] - obb->center[2];
+    float mx = p1[0] - p0[0];
+    float mz = p1[2] - p0[2];
+
+    float l[3] = {  c * dx + s * dz, p0[1] - obb->center[1], -s * dx + c * dz };
+    float m[3] = {  c * mx + s * mz, p1[1] - p0[1],          -s * mx + c * mz };
+
+    float tmin = 0.0f, tmax = 1.0f;
+    int axis = -1;
+    for (int k = 0; k < 3; k++) {
+        float e = obb->half[k];
+        if (fabsf(m[k]) < 1e-6f) {
+            if (l[k] < -e || l[k] > e) return false;
+            continue;
+        }
+        float inv = 1.0f / m[k];
+        float t1 = (-e - l[k]) * inv;
+        float t2 = ( e - l[k]) * inv;
+        if (t1 > t2) { float tmp = t1; t1 = t2; t2 = tmp; }
+        if (t1 > tmin) { tmin = t1; axis = k; }
+        if (t2 < tmax) tmax = t2;
+        if (tmin > tmax) return false;
+    }
+
+    // Starting inside: nothing to report, the segment only leaves the box
+    if (axis < 0) return false;
+
+    float nl[3] = { 0.0f, 0.0f, 0.0f };
+    nl[axis] = (m[axis] > 0.0f) ? -1.0f : 1.0f;
+
+    *t_out = tmin;
+    n_out[0] = c * nl[0] - s * nl[2];
+    n_out[1] = nl[1];
+    n_out[2] = s * nl[0] + c * nl[2];
+    return true;
+}
+
+/* ------------------------------------------------------------------
+ * Baked static OBB set
+ * ------------------------------------------------------------------ */
+
+void scu_static_obbs_bake(SCU_StaticOBBSet *set, const SCU_OBB *obbs, int count)
+{
+    assert(count <= SCU_STATIC_OBB_MAX);
+
+    set->count = count;
+    for (int i = 0; i < count; i++) {
+        const SCU_OBB *o = &obbs[i];
+        set->centerX[i] = o->center[0];
+        set->centerZ[i] = o->center[2];
+        set->halfX[i] = o->half[0];
+        set->halfZ[i] = o->half[2];
+        set->minY[i] = o->center[1] - o->half[1];
+        set->maxY[i] = o->center[1] + o->half[1];
+        set->axisC[i] = cosf(o->yaw);
+        set->axisS[i] = sinf(o->yaw);
+    }
+}
+
+int scu_capsule_vs_static_obbs_push_xz_f(
+    const SCU_StaticOBBSet *set,
+    const float cap_a[3], const float cap_b[3], float cap_radius,
+    SCU_Contact *out, int max_out)
+{
+    float capMinY = fminf(cap_a[1], cap_b[1]) - cap_radius;
+    float capMaxY = fmaxf(cap_a[1], cap_b[1]) + cap_radius;
+    float cx = 0.5f * (cap_a[0] + cap_b[0]);
+    float cz = 0.5f * (cap_a[2] + cap_b[2]);
+
+    int count = 0;
+    for (int i = 0; i < set->count && count < max_out; i++) {
+        if (capMaxY < set->minY[i] || capMinY > set->maxY[i]) continue;
+
+        SCU_Contact *ct = &out[count];
+        if (!circle_vs_box_push_xz(cx, cz, cap_radius,
+                set->centerX[i], set->centerZ[i], set->halfX[i], set->halfZ[i],
+                set->axisC[i], set->axisS[i], ct->push, ct->n)) continue;
+
+        ct->index = i;
+        ct->depth = sqrtf(ct->push[0] * ct->push[0] + ct->push[2] * ct->push[2]);
+        count++;
+    }
+    return count;
+}
+
+bool scu_capsule_vs_static_obbs_deepest_xz_f(
+    const SCU_StaticOBBSet *set,
+    const float cap_a[3], const float cap_b[3], float cap_radius,
+    SCU_Contact *out)
+{
+    SCU_Contact contacts[SCU_STATIC_OBB_MAX];
+    int count = scu_capsule_vs_static_obbs_push_xz_f(set, cap_a, cap_b, cap_radius, contacts, SCU_STATIC_OBB_MAX);
+    if (count == 0) return false;
+
+    int best = 0;
+    for (int i = 1; i < count; i++) {
+        if (contacts[i].depth > contacts[best].depth) best = i;
+    }
+    *out = contacts[best];
+    return true;
+}
+
+bool scu_capsule_sweep_static_obbs_xz_f(
+    const SCU_StaticOBBSet *set,
+    const float cap_a[3], const float cap_b[3], float cap_radius,
+    float move_x, float move_z,
+    float *toi_out,
+    float n_out[3]
+)
+{
+    float capMinY = fminf(cap_a[1], cap_b[1]) - cap_radius;
+    float capMaxY = fmaxf(cap_a[1], cap_b[1]) + cap_radius;
+    float cx = 0.5f * (cap_a[0] + cap_b[0]);
+    float cz = 0.5f * (cap_a[2] + cap_b[2]);
+
+    bool hit = false;
+    *toi_out = 1.0f;
+
+    for (int i = 0; i < set->count; i++) {
+        if (capMaxY < set->minY[i] || capMinY > set->maxY[i]) continue;
+
+        float t, n[3];
+        if (circle_sweep_box_xz(cx, cz, cap_radius, move_x, move_z,
+                set->centerX[i], set->centerZ[i], set->halfX[i], set->halfZ[i],
+                set->axisC[i], set->axisS[i], &t, n) && t < *toi_out) {
+            *toi_out = t;
+            n_out[0] = n[0]; n_out[1] = 0.0f; n_out[2] = n[2];
+            hit = true;
+        }
+    }
+    return hit;
+}
+
 /* ------------------------------------------------------------------
  * Closest point on segment AB to P (float)
  * ------------------------------------------------------------------ */
@@ -454,3 +721,130 @@ bool scu_capsule_vs_capsule_f(
 {
     return capsule_vs_capsule(a0, a1, radiusA, b0, b1, radiusB);
 }
+
+#define SCU_SWEEP_REFINE_STEPS 6
+
+static inline void v_lerp(const float a[3], const float b[3], float t, float out[3])
+{
+    out[0] = a[0] + (b[0] - a[0]) * t;
+    out[1] = a[1] + (b[1] - a[1]) * t;
+    out[2] = a[2] + (b[2] - a[2]) * t;
+}
+
+static float swept_capsule_dist2_at(
+    const float a0_start[3], const float a1_start[3],
+    const float a0_end[3], const float a1_end[3],
+    const float b0[3], const float b1[3],
+    float t)
+{
+    float a0[3], a1[3];
+    v_lerp(a0_start, a0_end, t, a0);
+    v_lerp(a1_start, a1_end, t, a1);
+    return segment_segment_dist2(a0, a1, b0, b1);
+}
+
+// Sweep state shared by the sample walk and the gap search
+typedef struct {
+    const float *a0_start, *a1_start, *a0_end, *a1_end;
+    const float *b0, *b1;
+    float rSum;
+    float travel;   // furthest any point of A moves over the whole step
+} SweptCapsule;
+
+static inline bool swept_overlap_at(const SweptCapsule *sw, float t)
+{
+    float d2 = swept_capsule_dist2_at(sw->a0_start, sw->a1_start, sw->a0_end, sw->a1_end, sw->b0, sw->b1, t);
+    return d2 <= sw->rSum * sw->rSum;
+}
+
+// Surface gap at t (negative when overlapping)
+static inline float swept_gap_at(const SweptCapsule *sw, float t)
+{
+    return sqrtf(swept_capsule_dist2_at(sw->a0_start, sw->a1_start, sw->a0_end, sw->a1_end, sw->b0, sw->b1, t)) - sw->rSum;
+}
+
+// Clear at lo, overlapping at hi: narrow down the first touch
+static float swept_refine(const SweptCapsule *sw, float lo, float hi)
+{
+    for (int i = 0; i < SCU_SWEEP_REFINE_STEPS; i++) {
+        float mid = 0.5f * (lo + hi);
+        if (swept_overlap_at(sw, mid)) hi = mid;
+        else lo = mid;
+    }
+    return hi;
+}
+
+// Both ends of [lo, hi] are clear by gapLo / gapHi. No point of A moves
+// faster than travel, so inside the interval the gap is at least
+// (gapLo + gapHi - travel * (hi - lo)) / 2; while that bound can't rule
+// out a touch the interval is halved. Past the depth limit the touch is
+// assumed (conservative) at lo.
+static bool swept_gap_search(const SweptCapsule *sw, float lo, float hi, float gapLo, float gapHi, int depth, float *toi)
+{
+    if (gapLo + gapHi > sw->travel * (hi - lo)) return false;
+    if (depth == 0) {
+        *toi = lo;
+        return true;
+    }
+
+    float mid = 0.5f * (lo + hi);
+    float gapMid = swept_gap_at(sw, mid);
+    if (gapMid <= 0.0f) {
+        *toi = swept_refine(sw, lo, mid);
+        return true;
+    }
+    return swept_gap_search(sw, lo, mid, gapLo, gapMid, depth - 1, toi) ||
+           swept_gap_search(sw, mid, hi, gapMid, gapHi, depth - 1, toi);
+}
+
+bool scu_swept_capsule_vs_capsule_f(
+    const float a0_start[3], const float a1_start[3],
+    const float a0_end[3], const float a1_end[3], float radiusA,
+    const float b0[3], const float b1[3], float radiusB,
+    float *toi_out)
+{
+    SweptCapsule sw = {
+        a0_start, a1_start, a0_end, a1_end, b0, b1,
+        radiusA + radiusB,
+        sqrtf(fmaxf(v_dist2(a0_start, a0_end), v_dist2(a1_start, a1_end))),
+    };
+
+    // Poses no further apart than the combined radius can't step over B.
+    // Past SCU_SWEEP_MAX_SAMPLES they can, so the gaps between samples are
+    // checked as well.
+    int samples = (sw.rSum > 0.0f) ? (int)ceilf(sw.travel / sw.rSum) : SCU_SWEEP_MAX_SAMPLES;
+    if (samples < 1) samples = 1;
+    bool capped = samples > SCU_SWEEP_MAX_SAMPLES;
+    if (capped) samples = SCU_SWEEP_MAX_SAMPLES;
+
+    const float dt = 1.0f / (float)samples;
+    float tPrev = 0.0f, gapPrev = 0.0f;
+    float toi = 0.0f;
+
+    for (int k = 0; k <= samples; k++) {
+        float t = (k == samples) ? 1.0f : (float)k * dt;
+        if (!capped) {
+            if (!swept_overlap_at(&sw, t)) {
+                tPrev = t;
+                continue;
+            }
+        } else {
+            float gap = swept_gap_at(&sw, t);
+            if (gap > 0.0f) {
+                if (k > 0 && swept_gap_search(&sw, tPrev, t, gapPrev, gap, SCU_SWEEP_REFINE_STEPS, &toi)) {
+                    if (toi_out) *toi_out = toi;
+                    return true;
+                }
+                tPrev = t;
+                gapPrev = gap;
+                continue;
+            }
+        }
+
+        // Overlapping at the start: contact at 0
+        toi = (k == 0) ? 0.0f : swept_refine(&sw, tPrev, t);
+        if (toi_out) *toi_out = toi;
+        return true;
+    }
+    return false;
+}
@@ -31,6 +31,74 @@ bool scu_capsule_vs_obb_push_xz_f(
     float n_out[3]     // XZ normal in world space
 );
 
+// swept capsule vs obb (XZ motion): earliest time of impact in [0,1] along
+// `move`, with the XZ contact normal. A capsule already overlapping reports
+// toi 0 only when the motion goes further in.
+bool scu_capsule_sweep_obb_xz_f(
+    const float capA[3], const float capB[3], float radius,
+    float move_x, float move_z,
+    const SCU_OBB *obb,
+    float *toi_out,
+    float n_out[3]
+);
+
+// segment p0 -> p1 vs obb: entry time in [0,1] and the world-space normal of
+// the face it enters through. A segment starting inside the box reports no hit.
+bool scu_segment_vs_obb_f(
+    const float p0[3], const float p1[3],
+    const SCU_OBB *obb,
+    float *t_out,
+    float n_out[3]
+);
+
+// Static boxes baked once into structure-of-arrays form, with each yaw's
+// rotation frame (cos/sin) precomputed so the batch queries below run one
+// capsule against every box in a single pass without any trig.
+#define SCU_STATIC_OBB_MAX 32
+
+typedef struct {
+    int count;
+    float centerX[SCU_STATIC_OBB_MAX];
+    float centerZ[SCU_STATIC_OBB_MAX];
+    float halfX[SCU_STATIC_OBB_MAX];
+    float halfZ[SCU_STATIC_OBB_MAX];
+    float minY[SCU_STATIC_OBB_MAX];
+    float maxY[SCU_STATIC_OBB_MAX];
+    float axisC[SCU_STATIC_OBB_MAX]; // local X axis in world XZ: (c, s); local Z is (-s, c)
+    float axisS[SCU_STATIC_OBB_MAX];
+} SCU_StaticOBBSet;
+
+typedef struct {
+    int index;       // box in the set
+    float depth;     // length of push
+    float push[3];
+    float n[3];      // XZ normal in world space
+} SCU_Contact;
+
+void scu_static_obbs_bake(SCU_StaticOBBSet *set, const SCU_OBB *obbs, int count);
+
+// capsule vs every box in the set: all contacts, in set order (same push and
+// normal as scu_capsule_vs_obb_push_xz_f per box). Returns the contact count.
+int scu_capsule_vs_static_obbs_push_xz_f(
+    const SCU_StaticOBBSet *set,
+    const float capA[3], const float capB[3], float radius,
+    SCU_Contact *out, int maxOut);
+
+// capsule vs every box in the set: only the deepest contact
+bool scu_capsule_vs_static_obbs_deepest_xz_f(
+    const SCU_StaticOBBSet *set,
+    const float capA[3], const float capB[3], float radius,
+    SCU_Contact *out);
+
+// swept capsule vs every box in the set: the earliest time of impact
+bool scu_capsule_sweep_static_obbs_xz_f(
+    const SCU_StaticOBBSet *set,
+    const float capA[3], const float capB[3], float radius,
+    float move_x, float move_z,
+    float *toi_out,
+    float n_out[3]
+);
+
 // sphere vs sphere (float space)
 bool scu_sphere_vs_sphere_f(
     const float c1[3], float r1,
@@ -61,4 +129,20 @@ bool scu_capsule_vs_capsule_f(
     const float a0[3], const float a1[3], float radiusA,
     const float b0[3], const float b1[3], float radiusB);
 
+// swept capsule vs capsule: capsule A's endpoints move linearly from
+// (a0_start, a1_start) to (a0_end, a1_end) over the step. A is tested at poses
+// spaced no further apart than radiusA + radiusB, and the first overlap is
+// refined by bisection. Sweeps that would need more than
+// SCU_SWEEP_MAX_SAMPLES poses are sampled at the cap, and every gap between
+// two clear poses is bounded by A's travel and split until it is ruled out
+// (if it can't be, the contact is assumed). Earliest contact time in [0,1]
+// goes to toi_out when it isn't NULL.
+#define SCU_SWEEP_MAX_SAMPLES 32
+
+bool scu_swept_capsule_vs_capsule_f(
+    const float a0_start[3], const float a1_start[3],
+    const float a0_end[3], const float a1_end[3], float radiusA,
+    const float b0[3], const float b1[3], float radiusB,
+    float *toi_out);
+
 #endif
\ No newline at end of file
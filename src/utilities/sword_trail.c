@@ -12,6 +12,7 @@
 #include <assert.h>
 
 #include "game_math.h" // clampf
+#include "quality_governor.h"
 
 // ============================================================
 // Defaults (copied into per-instance fields at init)
@@ -46,6 +47,7 @@ static SwordTrail s_boss;
 #endif
 
 // Force a low subdiv ceiling for N64 stability (can override per-instance, but we clamp).
+// Both caps are upper bounds; the quality governor lowers them further under load.
 #ifndef TRAIL_SUBDIV_MAX_N64
 #define TRAIL_SUBDIV_MAX_N64 2
 #endif
@@ -328,9 +330,18 @@ void sword_trail_instance_draw(SwordTrail *t, void *viewport) {
     const float a_scale = (float)t->max_alpha / 255.0f;
     const uint8_t r8 = t->color_r, g8 = t->color_g, b8 = t->color_b;
 
+    const QualityBudgets *budget = quality_budgets();
+    int points_max = budget->trailPointsMax;
+    if (points_max > POINTS_MAX_DRAW) points_max = POINTS_MAX_DRAW;
+    int subdiv_cap = budget->trailSubdivMax;
+    if (subdiv_cap > TRAIL_SUBDIV_MAX_N64) subdiv_cap = TRAIL_SUBDIV_MAX_N64;
+
     // We draw only the most recent N samples to keep geometry stable.
+    // Every sample is at least one point, so a tight points budget drops the
+    // oldest samples here rather than cutting off the newest end below.
     int draw_count = t->count;
     if (draw_count > TRAIL_MAX_SAMPLES_DRAW) draw_count = TRAIL_MAX_SAMPLES_DRAW;
+    if (draw_count > points_max) draw_count = points_max;
 
     // Build points (each point => 2 verts) into vb, hard-capped.
     int vcount = 0;
@@ -368,13 +379,13 @@ void sword_trail_instance_draw(SwordTrail *t, void *viewport) {
 
         // Clamp subdiv hard for N64 stability.
         int max_sub = t->subdiv_max;
-        if (max_sub > TRAIL_SUBDIV_MAX_N64) max_sub = TRAIL_SUBDIV_MAX_N64;
+        if (max_sub > subdiv_cap) max_sub = subdiv_cap;
         if (subdiv > max_sub) subdiv = max_sub;
 
         int ss_start = (vcount == 0) ? 0 : 1;
 
         for (int ss = ss_start; ss <= subdiv; ss++) {
-            if ((vcount / 2) >= POINTS_MAX_DRAW) break; // points cap
+            if ((vcount / 2) >= points_max) break; // points cap
             float tt = (float)ss / (float)subdiv;
 
             float base_w[3], tip_w[3];
@@ -402,7 +413,7 @@ void sword_trail_instance_draw(SwordTrail *t, void *viewport) {
             vcount += 2;
         }
 
-        if ((vcount / 2) >= POINTS_MAX_DRAW) break;
+        if ((vcount / 2) >= points_max) break;
     }
 
     if (vcount >= 4) {
@@ -1,22 +1,59 @@
 #!/usr/bin/env python3
 """
-Export collision geometry from a .glb into a simple text format:
+Export collision geometry from a .glb for src/utilities/collision_mesh.c.
+
+Binary (.col, default for that extension): a big-endian blob the game loads
+with one read plus pointer fixup (the host build also swaps it to native order)
+-- quantized vertices, plane equations already oriented into the room, poly
+types, the wall list and the wall grid. Layout is CollisionBlobHeader in
+collision_mesh.c.
+
+Text (anything else), the older format parsed line by line at load:
 
 v x y z
 f i0 i1 i2 type
 
+Room boxes (.obb, or --format obb): the same geometry fitted with oriented
+boxes for the fast OBB path in simple_collision_utility.c. Closed solids
+(pillars) become one minimum-area box each; the room shell becomes one thin
+box behind every contiguous run of coplanar wall faces. Layout is
+RoomObbTableHeader in collision_mesh.c.
+
 Only nodes (scene objects) whose name is exactly "COLLISION" are included.
-Faces are written as triangles.
+Faces are written as triangles. With no such node, or one without triangles,
+nothing is written and the exit code is non-zero, so the Makefile rule fails
+rather than shipping an empty .col/.obb (the loaders reject those as well).
 """
 
 import argparse
+import struct
 import sys
 
 import numpy as np
-import trimesh
 
 COLLISION_NODE_NAME = "COLLISION"
 
+# Binary format -- keep in sync with collision_mesh.c
+BLOB_MAGIC = b"PCOL"
+BLOB_VERSION = 1
+BLOB_HAS_GRID = 0x0001
+BLOB_HEADER = struct.Struct(">4sHHHHHHIf3f3f3f6I")
+BLOB_POLY = struct.Struct(">iiiiffff")
+GRID_DIM = 16
+GRID_CELL_MAX_REFS = 48
+GRID_MARGIN = 32.0
+GRID_EPS = 0.01
+
+# Room box table -- keep in sync with collision_mesh.c
+OBB_MAGIC = b"POBB"
+OBB_VERSION = 1
+OBB_MAX = 32  # SCU_STATIC_OBB_MAX
+OBB_HEADER = struct.Struct(">4sHH")
+OBB_ENTRY = struct.Struct(">7f")  # center xyz, half xyz, yaw
+OBB_PLANE_ANGLE_EPS = 1e-3  # radians; wall faces closer than this share a plane
+OBB_PLANE_DIST_EPS = 0.01   # model units
+OBB_RUN_GAP = 0.01          # model units; a larger gap along a wall starts a new box
+
 
 def write_collision(path_out: str, vertices: np.ndarray, faces: np.ndarray, face_types: np.ndarray) -> None:
     # vertices: (N, 3) float
@@ -34,6 +71,279 @@ def write_collision(path_out: str, vertices: np.ndarray, faces: np.ndarray, face
             f.write(f"f {int(tri[0])} {int(tri[1])} {int(tri[2])} {int(t)}\n")
 
 
+def compute_planes(vertices: np.ndarray, faces: np.ndarray) -> np.ndarray:
+    """
+    Plane (a, b, c, d) per face with the mesh centroid on the negative side,
+    matching finalize_collision_planes(). Degenerate faces get (0, 1, 0, 0).
+    """
+    v0 = vertices[faces[:, 0]]
+    n = np.cross(vertices[faces[:, 1]] - v0, vertices[faces[:, 2]] - v0)
+    lens = np.linalg.norm(n, axis=1)
+    planes = np.tile(np.array([0.0, 1.0, 0.0, 0.0]), (len(faces), 1))
+    ok = lens > 0.0001
+    planes[ok, :3] = n[ok] / lens[ok, None]
+    planes[ok, 3] = -np.einsum("ij,ij->i", planes[ok, :3], v0[ok])
+
+    centroid = vertices.mean(axis=0)
+    flip = planes[:, :3] @ centroid + planes[:, 3] > 0.0
+    planes[flip] = -planes[flip]
+    return planes.astype(np.float32)
+
+
+def build_grid(vertices: np.ndarray, planes: np.ndarray, walls: np.ndarray):
+    """
+    Same construction as collision_mesh_build_grid(): per XZ cell, the walls whose
+    plane can be violated somewhere in the cell box. Cells over the limit are
+    flagged full (the game falls back to the wall list there).
+    """
+    lo = (vertices.min(axis=0) - GRID_MARGIN).astype(np.float32)
+    hi = (vertices.max(axis=0) + GRID_MARGIN).astype(np.float32)
+    cell_x = np.float32((hi[0] - lo[0]) / GRID_DIM)
+    cell_z = np.float32((hi[2] - lo[2]) / GRID_DIM)
+    wall_planes = planes[walls].astype(np.float64)
+
+    cell_start, cell_full, refs = [], [], []
+    for cz in range(GRID_DIM):
+        for cx in range(GRID_DIM):
+            x0 = float(lo[0] + cx * cell_x)
+            z0 = float(lo[2] + cz * cell_z)
+            box_min = np.array([x0, lo[1], z0])
+            box_max = np.array([x0 + cell_x, hi[1], z0 + cell_z])
+            corner = np.where(wall_planes[:, :3] > 0.0, box_max, box_min)
+            d = np.einsum("ij,ij->i", wall_planes[:, :3], corner) + wall_planes[:, 3]
+            hits = walls[d > -GRID_EPS]
+
+            cell_start.append(len(refs))
+            if len(hits) > GRID_CELL_MAX_REFS:
+                cell_full.append(1)
+            else:
+                cell_full.append(0)
+                refs.extend(int(w) for w in hits)
+    cell_start.append(len(refs))
+    return lo, hi, cell_start, cell_full, refs
+
+
+def write_collision_binary(path_out: str, vertices: np.ndarray, faces: np.ndarray, face_types: np.ndarray) -> None:
+    if len(vertices) > 0xFFFF or len(faces) > 0xFFFF:
+        raise ValueError(f"too many vertices/faces for the binary format ({len(vertices)}/{len(faces)})")
+
+    planes = compute_planes(vertices, faces)
+    walls = np.nonzero(face_types == 1)[0]
+    lo, hi, cell_start, cell_full, refs = build_grid(vertices, planes, walls)
+    if len(refs) > 0xFFFF:
+        raise ValueError(f"wall grid too large ({len(refs)} refs)")
+
+    # int16 vertices around the bounds center
+    vmin, vmax = vertices.min(axis=0), vertices.max(axis=0)
+    center = (vmin + vmax) * 0.5
+    half = float((vmax - vmin).max()) * 0.5
+    qscale = half / 32767.0 if half > 0.0 else 1.0
+    quant = np.clip(np.round((vertices - center) / qscale), -32768, 32767).astype(">i2")
+
+    sections = [
+        quant.tobytes(),
+        b"".join(BLOB_POLY.pack(int(f[0]), int(f[1]), int(f[2]), int(t), *p)
+                 for f, t, p in zip(faces, face_types, planes)),
+        np.asarray(walls, dtype=">u2").tobytes(),
+        np.asarray(cell_start, dtype=">u2").tobytes(),
+        np.asarray(cell_full, dtype=np.uint8).tobytes(),
+        np.asarray(refs, dtype=">u2").tobytes(),
+    ]
+
+    offsets = []
+    pos = (BLOB_HEADER.size + 7) & ~7
+    for data in sections:
+        offsets.append(pos)
+        pos = (pos + len(data) + 7) & ~7
+
+    header = BLOB_HEADER.pack(
+        BLOB_MAGIC, BLOB_VERSION, BLOB_HAS_GRID,
+        len(vertices), len(faces), len(walls), GRID_DIM, len(refs),
+        qscale, *center.astype(np.float32), *lo, *hi,
+        *offsets,
+    )
+
+    with open(path_out, "wb") as f:
+        f.write(header)
+        for off, data in zip(offsets, sections):
+            f.write(b"\0" * (off - f.tell()))
+            f.write(data)
+        f.write(b"\0" * (pos - f.tell()))
+
+
+def face_components(faces: np.ndarray) -> list:
+    """Groups of face indices connected through shared vertices."""
+    parent = list(range(int(faces.max()) + 1 if len(faces) else 0))
+
+    def find(a):
+        while parent[a] != a:
+            parent[a] = parent[parent[a]]
+            a = parent[a]
+        return a
+
+    for f in faces:
+        r0 = find(int(f[0]))
+        for v in f[1:]:
+            r = find(int(v))
+            if r != r0:
+                parent[r] = r0
+
+    groups = {}
+    for i, f in enumerate(faces):
+        groups.setdefault(find(int(f[0])), []).append(i)
+    return list(groups.values())
+
+
+def convex_hull_xz(points: np.ndarray) -> np.ndarray:
+    """Monotone chain hull of (N, 2) points, counter-clockwise."""
+    pts = sorted(set(map(tuple, np.round(points, 6))))
+    if len(pts) < 3:
+        return np.asarray(pts, dtype=np.float64)
+
+    def cross(o, a, b):
+        return (a[0] - o[0]) * (b[1] - o[1]) - (a[1] - o[1]) * (b[0] - o[0])
+
+    lower, upper = [], []
+    for p in pts:
+        while len(lower) >= 2 and cross(lower[-2], lower[-1], p) <= 0.0:
+            lower.pop()
+        lower.append(p)
+    for p in reversed(pts):
+        while len(upper) >= 2 and cross(upper[-2], upper[-1], p) <= 0.0:
+            upper.pop()
+        upper.append(p)
+    return np.asarray(lower[:-1] + upper[:-1], dtype=np.float64)
+
+
+def obb_from_axis(points: np.ndarray, axis: np.ndarray, y0: float, y1: float):
+    """(center, half, yaw) of the box around points (N, 2 as x, z) with local X along axis."""
+    perp = np.array([-axis[1], axis[0]])
+    u = points @ axis
+    w = points @ perp
+    cu, cw = (u.min() + u.max()) * 0.5, (w.min() + w.max()) * 0.5
+    cx, cz = axis * cu + perp * cw
+    half = ((u.max() - u.min()) * 0.5, (y1 - y0) * 0.5, (w.max() - w.min()) * 0.5)
+    return (cx, (y0 + y1) * 0.5, cz), half, float(np.arctan2(axis[1], axis[0]))
+
+
+def fit_solid_obb(vertices: np.ndarray):
+    """Minimum-area XZ rectangle (one hull edge is always flush) extruded over the Y range."""
+    xz = vertices[:, [0, 2]]
+    hull = convex_hull_xz(xz)
+    best = None
+    for i in range(len(hull)):
+        edge = hull[(i + 1) % len(hull)] - hull[i]
+        length = np.linalg.norm(edge)
+        if length < 1e-9:
+            continue
+        axis = edge / length
+        perp = np.array([-axis[1], axis[0]])
+        area = np.ptp(hull @ axis) * np.ptp(hull @ perp)
+        if best is None or area < best[0]:
+            best = (area, axis)
+    axis = best[1] if best else np.array([1.0, 0.0])
+    return obb_from_axis(xz, axis, float(vertices[:, 1].min()), float(vertices[:, 1].max()))
+
+
+def wall_planes_xz(vertices: np.ndarray, faces: np.ndarray):
+    """
+    Per face XZ unit normal on the visible side (glTF winding) and the plane
+    offset along it; faces without a horizontal normal get a zero normal.
+    """
+    v0 = vertices[faces[:, 0]]
+    n = np.cross(vertices[faces[:, 1]] - v0, vertices[faces[:, 2]] - v0)[:, [0, 2]]
+    lens = np.linalg.norm(n, axis=1)
+    ok = lens > 1e-9
+    n[ok] /= lens[ok, None]
+    n[~ok] = 0.0
+    d = -np.einsum("ij,ij->i", n, v0[:, [0, 2]])
+    return n, d
+
+
+def fit_shell_obbs(vertices: np.ndarray, faces: np.ndarray, thickness: float) -> list:
+    """
+    One box per contiguous run of coplanar wall faces, set behind the face
+    (away from its visible side) so the box's inner side is the wall.
+    """
+    boxes = []
+    normals, offsets = wall_planes_xz(vertices, faces)
+    keyed = []
+    for i in range(len(faces)):
+        n = normals[i]
+        if not n.any():
+            continue
+        # Fold -pi onto pi: one wall's faces can land on either side (signed zeros)
+        angle = float(np.arctan2(n[1], n[0]))
+        if angle < -np.pi + OBB_PLANE_ANGLE_EPS:
+            angle += 2.0 * np.pi
+        keyed.append((angle, float(offsets[i]), i))
+    keyed.sort()
+
+    # Greedy grouping over the sorted (angle, distance) keys
+    groups = []
+    for angle, d, i in keyed:
+        g = groups[-1] if groups else None
+        if g and abs(angle - g["angle"]) < OBB_PLANE_ANGLE_EPS and abs(d - g["d"]) < OBB_PLANE_DIST_EPS:
+            g["faces"].append(i)
+        else:
+            groups.append({"angle": angle, "d": d, "n": normals[i], "faces": [i]})
+
+    for g in groups:
+        n = g["n"]
+        axis = np.array([-n[1], n[0]])  # along the wall
+        spans = []
+        for i in g["faces"]:
+            u = vertices[faces[i]][:, [0, 2]] @ axis
+            spans.append((u.min(), u.max(), i))
+        spans.sort()
+
+        runs = [[spans[0]]]
+        for span in spans[1:]:
+            if span[0] > max(r[1] for r in runs[-1]) + OBB_RUN_GAP:
+                runs.append([span])
+            else:
+                runs[-1].append(span)
+
+        for run in runs:
+            pts = vertices[faces[[r[2] for r in run]].ravel()]
+            xz = pts[:, [0, 2]]
+            # Flatten onto the plane, then extrude away from the visible side
+            on_plane = xz - np.outer(xz @ n + g["d"], n)
+            extruded = np.vstack([on_plane, on_plane - n * thickness])
+            boxes.append(obb_from_axis(extruded, axis, float(pts[:, 1].min()), float(pts[:, 1].max())))
+    return boxes
+
+
+def fit_room_obbs(vertices: np.ndarray, faces: np.ndarray, face_types: np.ndarray, thickness: float) -> list:
+    walls = np.nonzero(face_types == 1)[0]
+    boxes = []
+    for comp in face_components(faces[walls]):
+        comp_faces = faces[walls[comp]]
+        comp_verts = vertices[np.unique(comp_faces)]
+        normals, _ = wall_planes_xz(vertices, comp_faces)
+        # Visible sides facing away from the group's center: a solid such as a
+        # pillar, seen from the room. Facing inward: part of the room shell.
+        to_face = vertices[comp_faces].mean(axis=1)[:, [0, 2]] - comp_verts[:, [0, 2]].mean(axis=0)
+        if np.einsum("ij,ij->i", normals, to_face).sum() > 0.0:
+            boxes.append(fit_solid_obb(comp_verts))
+        else:
+            boxes.extend(fit_shell_obbs(vertices, comp_faces, thickness))
+    return boxes
+
+
+def write_room_obbs(path_out: str, vertices: np.ndarray, faces: np.ndarray, face_types: np.ndarray,
+                    thickness: float) -> int:
+    boxes = fit_room_obbs(vertices, faces, face_types, thickness)
+    if len(boxes) > OBB_MAX:
+        raise ValueError(f"{len(boxes)} room boxes, the static set holds {OBB_MAX}")
+
+    with open(path_out, "wb") as f:
+        f.write(OBB_HEADER.pack(OBB_MAGIC, OBB_VERSION, len(boxes)))
+        for center, half, yaw in boxes:
+            f.write(OBB_ENTRY.pack(*center, *half, yaw))
+    return len(boxes)
+
+
 def classify_faces(vertices: np.ndarray, faces: np.ndarray, threshold: float = 0.7) -> np.ndarray:
     """
     Classify triangles based on normal Y:
@@ -62,7 +372,7 @@ def classify_faces(vertices: np.ndarray, faces: np.ndarray, threshold: float = 0
 def main() -> int:
     ap = argparse.ArgumentParser()
     ap.add_argument("input_glb", help="Input .glb (can contain render + collision)")
-    ap.add_argument("output_collision", help="Output .collision text file")
+    ap.add_argument("output_collision", help="Output .col (binary) or .collision (text) file")
     ap.add_argument("--name", default=COLLISION_NODE_NAME, help='Node name to export (default: "COLLISION")')
     ap.add_argument("--weld-eps", type=float, default=1e-6, help="Vertex weld epsilon in model units")
     ap.add_argument(
@@ -71,8 +381,24 @@ def main() -> int:
         default=-1,
         help="Face type: 0=floor 1=wall 2=ceiling. Use -1 to auto-classify by normal (default).",
     )
+    ap.add_argument(
+        "--format",
+        choices=("auto", "bin", "text", "obb"),
+        default="auto",
+        help="Output format (default: bin for .col outputs, obb for .obb outputs, text otherwise)",
+    )
+    ap.add_argument(
+        "--obb-thickness",
+        type=float,
+        default=20.0,
+        help="Thickness of the boxes fitted behind room walls, in model units (obb format)",
+    )
     args = ap.parse_args()
 
+    # Only needed to read the .glb; the writers and fitters take plain arrays
+    # (host/fixtures/room_pillar.py imports them without it)
+    import trimesh
+
     # Load as a scene so we can pick nodes by name
     scene_or_mesh = trimesh.load(args.input_glb, force="scene")
     if not isinstance(scene_or_mesh, trimesh.Scene):
@@ -82,7 +408,7 @@ def main() -> int:
         )
         return 2
 
-    scene: trimesh.Scene = scene_or_mesh
+    scene = scene_or_mesh
 
     # Find geometries referenced by nodes named COLLISION.
     #
@@ -147,7 +473,17 @@ def main() -> int:
     else:
         types = classify_faces(V, F)
 
-    write_collision(args.output_collision, V, F, face_types=types)
+    out = args.output_collision
+    if args.format == "obb" or (args.format == "auto" and out.endswith(".obb")):
+        count = write_room_obbs(out, V, F, types, args.obb_thickness)
+        print(f"Wrote {count} room boxes from {len(F)} triangles -> {out}")
+        return 0
+
+    binary = args.format == "bin" or (args.format == "auto" and out.endswith(".col"))
+    if binary:
+        write_collision_binary(args.output_collision, V, F, face_types=types)
+    else:
+        write_collision(args.output_collision, V, F, face_types=types)
     print(f"Wrote {len(V)} vertices, {len(F)} triangles -> {args.output_collision}")
     return 0
 
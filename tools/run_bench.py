@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""
+Run the benchmark ROM (`make bench`) in an emulator and print its result line.
+
+The ROM boots straight into the boss fight, plays it with a scripted bot and
+emits (see src/dev/bench.c):
+
+@BENCH frames=<n> sync_frames=<n> sim_s=<s> min_ms=<ms> avg_ms=<ms> p99_ms=<ms> rsp_busy_ms=<ms> rdp_busy_ms=<ms> heap_sampled_max_kb=<kb> attacks=<seen>/<total>
+@BENCH_DONE
+
+Frame times leave out the sync_frames that absorbed a profiling rspq_wait().
+heap_sampled_max_kb is the largest heap use seen at step and frame
+boundaries, not the allocator's true high-water mark.
+
+The emulator must forward ISViewer output to stdout (e.g. `ares --no-file-prompt`
+or `cen64 -is-viewer`). On a headless CI box wrap it in `xvfb-run -a`.
+"""
+
+import argparse
+import json
+import shlex
+import subprocess
+import sys
+import threading
+
+
+def parse_bench_line(line: str):
+    idx = line.find("@BENCH ")
+    if idx < 0:
+        return None
+    result = {}
+    for item in line[idx + len("@BENCH "):].split():
+        key, _, value = item.partition("=")
+        if not value:
+            continue
+        try:
+            result[key] = float(value) if "." in value else int(value)
+        except ValueError:
+            result[key] = value
+    return result
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser()
+    ap.add_argument("--emu", required=True, help="Emulator command, ROM path is appended (e.g. 'xvfb-run -a ares')")
+    ap.add_argument("--rom", default="pandemonium-bench.z64", help="Benchmark ROM (default: pandemonium-bench.z64)")
+    ap.add_argument("--timeout", type=float, default=900.0, help="Seconds to wait for @BENCH_DONE (default: 900)")
+    ap.add_argument("--json", action="store_true", help="Print the result as JSON instead of the raw line")
+    args = ap.parse_args()
+
+    cmd = shlex.split(args.emu) + [args.rom]
+    proc = subprocess.Popen(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True, errors="replace")
+
+    # The watchdog kills the emulator even if it goes silent, which closes
+    # stdout and ends the read loop
+    watchdog = threading.Timer(args.timeout, proc.kill)
+    watchdog.start()
+
+    result = None
+    raw = None
+    try:
+        for line in proc.stdout:
+            if "@BENCH_WARN" in line:
+                print(line.strip(), file=sys.stderr)
+            parsed = parse_bench_line(line)
+            if parsed is not None:
+                result, raw = parsed, line[line.find("@BENCH "):].strip()
+            if "@BENCH_DONE" in line:
+                break
+    finally:
+        watchdog.cancel()
+        proc.kill()
+        proc.wait()
+
+    if result is None:
+        print(f"No @BENCH line from {args.rom} within {args.timeout:.0f}s", file=sys.stderr)
+        return 2
+
+    print(json.dumps(result) if args.json else raw)
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""
+Convert a captured debug log with FRAME_TRACE lines into a Chrome trace-event
+JSON file (open in chrome://tracing or https://ui.perfetto.dev).
+
+The game emits (see src/dev/frame_trace.c):
+
+@TP 0=input 1=save ...                     phase id -> name table (once at boot)
+@T <frame> <baseUs> <id><b|e><offUs> ...   one line per frame
+@T ... d<count>                            events dropped that frame (buffer full)
+
+Any other log lines are ignored, so the raw emulator output can be fed in as-is.
+"""
+
+import argparse
+import json
+import re
+import sys
+
+EVENT_RE = re.compile(r"^(\d+)([be])(\d+)$")
+
+
+def parse_log(lines, pid: int, tid: int):
+    names = {}
+    events = []
+    frames = 0
+    dropped = 0
+
+    for raw in lines:
+        line = raw.strip()
+        idx = line.find("@T")
+        if idx < 0:
+            continue
+        line = line[idx:]
+        parts = line.split()
+
+        if parts[0] == "@TP":
+            for item in parts[1:]:
+                key, _, name = item.partition("=")
+                if key.isdigit() and name:
+                    names[int(key)] = name
+            continue
+
+        if parts[0] != "@T" or len(parts) < 3:
+            continue
+
+        try:
+            frame = int(parts[1])
+            base = int(parts[2])
+        except ValueError:
+            continue
+
+        frames += 1
+        events.append({"name": f"frame {frame}", "ph": "i", "s": "t", "ts": base, "pid": pid, "tid": tid})
+
+        for tok in parts[3:]:
+            if tok.startswith("d") and tok[1:].isdigit():
+                dropped += int(tok[1:])
+                events.append({"name": "dropped", "ph": "i", "s": "t", "ts": base, "pid": pid, "tid": tid,
+                               "args": {"count": int(tok[1:])}})
+                continue
+            m = EVENT_RE.match(tok)
+            if not m:
+                continue
+            phase = int(m.group(1))
+            events.append({
+                "name": names.get(phase, f"phase{phase}"),
+                "ph": "B" if m.group(2) == "b" else "E",
+                "ts": base + int(m.group(3)),
+                "pid": pid,
+                "tid": tid,
+            })
+
+    return events, frames, dropped
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser()
+    ap.add_argument("input_log", help="Captured ISViewer / USB debug log ('-' for stdin)")
+    ap.add_argument("output_json", help="Output Chrome trace-event .json file")
+    ap.add_argument("--pid", type=int, default=1, help="Process id to tag events with (default: 1)")
+    ap.add_argument("--tid", type=int, default=1, help="Thread id to tag events with (default: 1)")
+    args = ap.parse_args()
+
+    if args.input_log == "-":
+        events, frames, dropped = parse_log(sys.stdin, args.pid, args.tid)
+    else:
+        with open(args.input_log, "r", encoding="utf-8", errors="replace") as f:
+            events, frames, dropped = parse_log(f, args.pid, args.tid)
+
+    if frames == 0:
+        print(f"No @T trace lines found in {args.input_log}", file=sys.stderr)
+        print("Tip: set FRAME_TRACE (and DEV_MODE) to true in src/utilities/globals.h.", file=sys.stderr)
+        return 2
+
+    meta = [
+        {"name": "process_name", "ph": "M", "pid": args.pid, "args": {"name": "N64"}},
+        {"name": "thread_name", "ph": "M", "pid": args.pid, "tid": args.tid, "args": {"name": "main loop"}},
+    ]
+
+    with open(args.output_json, "w", encoding="utf-8") as f:
+        json.dump({"traceEvents": meta + events, "displayTimeUnit": "ms"}, f)
+
+    print(f"Wrote {frames} frames, {len(events)} events -> {args.output_json}")
+    if dropped:
+        print(f"Warning: {dropped} events were dropped on device (FRAME_TRACE_MAX_EVENTS)", file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())